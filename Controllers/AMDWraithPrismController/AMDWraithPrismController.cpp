@@ -35,7 +35,7 @@ AMDWraithPrismController::AMDWraithPrismController(hid_device* dev_handle)
 
 AMDWraithPrismController::~AMDWraithPrismController()
 {
-
+    hid_close(dev);
 }
 
 char* AMDWraithPrismController::GetDeviceName()
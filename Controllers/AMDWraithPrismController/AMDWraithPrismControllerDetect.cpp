@@ -36,7 +36,7 @@ void DetectAMDWraithPrismControllers(std::vector<RGBController*>& rgb_controller
          &&(info->interface_number == 1))
 #endif
         {
-            dev = hid_open_path(info->path);
+            dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
         
             if( dev )
             {
@@ -45,10 +45,11 @@ void DetectAMDWraithPrismControllers(std::vector<RGBController*>& rgb_controller
                 RGBController_AMDWraithPrism* rgb_controller = new RGBController_AMDWraithPrism(controller);
 
                 rgb_controllers.push_back(rgb_controller);
+                ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
             }
         }
         info = info->next;
     }
 }
 
-REGISTER_DETECTOR("AMD Wraith Prism", DetectAMDWraithPrismControllers);
+REGISTER_USB_DETECTOR("AMD Wraith Prism", DetectAMDWraithPrismControllers, AMD_WRAITH_PRISM_VID);
@@ -59,7 +59,7 @@ void DetectAorusCPUCoolerControllers(std::vector<RGBController*>& rgb_controller
             &&(info->interface_number == device_list[device_idx].usb_interface))
 #endif
             {
-                hid_device* dev = hid_open_path(info->path);
+                hid_device* dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
 
                 if(dev)
                 {
@@ -73,6 +73,7 @@ void DetectAorusCPUCoolerControllers(std::vector<RGBController*>& rgb_controller
 
                             rgb_controller->name = device_list[device_idx].name;
                             rgb_controllers.push_back(rgb_controller);
+                            ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                         }
                         break;
                     }
@@ -84,4 +85,4 @@ void DetectAorusCPUCoolerControllers(std::vector<RGBController*>& rgb_controller
     }
 }
 
-REGISTER_DETECTOR("Aorus CPU Coolers", DetectAorusCPUCoolerControllers);
+REGISTER_USB_DETECTOR("Aorus CPU Coolers", DetectAorusCPUCoolerControllers, HOLTEK_VID);
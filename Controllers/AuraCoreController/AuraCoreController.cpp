@@ -17,7 +17,7 @@ AuraCoreController::AuraCoreController(hid_device* dev_handle)
 
 AuraCoreController::~AuraCoreController()
 {
-
+    hid_close(dev);
 }
 
 void AuraCoreController::SendBrightness
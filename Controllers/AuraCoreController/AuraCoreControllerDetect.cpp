@@ -45,4 +45,4 @@ void DetectAuraCoreControllers(std::vector<RGBController*>& rgb_controllers)
     }
 }
 
-REGISTER_DETECTOR("ASUS Aura Core", DetectAuraCoreControllers);
+REGISTER_USB_DETECTOR("ASUS Aura Core", DetectAuraCoreControllers, AURA_CORE_VID);
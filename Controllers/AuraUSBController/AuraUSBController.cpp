@@ -21,7 +21,7 @@ AuraUSBController::AuraUSBController(hid_device* dev_handle)
 
 AuraUSBController::~AuraUSBController()
 {
-
+    hid_close(dev);
 }
 
 unsigned int AuraUSBController::GetChannelCount()
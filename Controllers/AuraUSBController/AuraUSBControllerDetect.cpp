@@ -77,4 +77,4 @@ void DetectAuraUSBControllers(std::vector<RGBController*>& rgb_controllers)
     }
 }   /* DetectAuraUSBControllers() */
 
-REGISTER_DETECTOR("ASUS Aura USB", DetectAuraUSBControllers);
+REGISTER_USB_DETECTOR("ASUS Aura USB", DetectAuraUSBControllers, AURA_USB_VID);
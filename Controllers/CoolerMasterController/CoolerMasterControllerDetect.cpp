@@ -49,7 +49,7 @@ void DetectCoolerMasterControllers(std::vector<RGBController*>& rgb_controllers)
                 if((info->product_id        == cm_pids[cm_pid_idx][CM_PID])
                  &&(info->interface_number  == cm_pids[cm_pid_idx][CM_INTERFACE]))
                 {
-                    dev = hid_open_path(info->path);
+                    dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
                     break;
                 }
             }
@@ -60,10 +60,11 @@ void DetectCoolerMasterControllers(std::vector<RGBController*>& rgb_controllers)
             CMMP750Controller* controller                   = new CMMP750Controller(dev, info->manufacturer_string, info->product_string, info->path);
             RGBController_CMMP750Controller* rgb_controller = new RGBController_CMMP750Controller(controller);
             rgb_controllers.push_back(rgb_controller);
+            ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
         }
         info = info->next;
     }
     hid_free_enumeration(info);
 }   /* DetectCoolerMasterControllers() */
 
-REGISTER_DETECTOR("Cooler Master", DetectCoolerMasterControllers);
+REGISTER_USB_DETECTOR("Cooler Master", DetectCoolerMasterControllers, COOLERMASTER_VID);
@@ -17,6 +17,12 @@ CorsairHydroController::CorsairHydroController(libusb_device_handle* dev_handle)
     SendFirmwareRequest();
 }
 
+CorsairHydroController::~CorsairHydroController()
+{
+    libusb_release_interface(dev, 0);
+    libusb_close(dev);
+}
+
 std::string CorsairHydroController::GetFirmwareString()
 {
     return(firmware_version);
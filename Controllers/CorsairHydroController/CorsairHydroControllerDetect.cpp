@@ -71,4 +71,4 @@ void DetectCorsairHydroControllers(std::vector<RGBController*>& rgb_controllers)
     }
 }   /* DetectCorsairHydroControllers() */
 
-REGISTER_DETECTOR("Corsair Hydro Series", DetectCorsairHydroControllers);
+REGISTER_USB_DETECTOR("Corsair Hydro Series", DetectCorsairHydroControllers, CORSAIR_VID);
@@ -5,7 +5,9 @@
 \*---------------------------------------------------------*/
 
 #include "RGBController.h"
+#include <atomic>
 #include <chrono>
+#include <thread>
 #include <vector>
 #include <hidapi/hidapi.h>
 
@@ -111,6 +113,8 @@ private:
     hid_device*             dev;
     std::string             firmware_version;
     std::chrono::time_point<std::chrono::steady_clock> last_commit_time;
+    std::thread*            keepalive_thread;
+    std::atomic<bool>       keepalive_thread_run;
 
     void            SendFirmwareRequest();
 
@@ -60,7 +60,7 @@ void DetectCorsairLightingNodeControllers(std::vector<RGBController*> &rgb_contr
             if((info->vendor_id == device_list[device_idx].usb_vid)
             &&(info->product_id == device_list[device_idx].usb_pid))
             {
-                dev = hid_open_path(info->path);
+                dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
 
                 if( dev )
                 {
@@ -71,6 +71,7 @@ void DetectCorsairLightingNodeControllers(std::vector<RGBController*> &rgb_contr
                     rgb_controller->name = device_list[device_idx].name;
 
                     rgb_controllers.push_back(rgb_controller);
+                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                 }
             }
 
@@ -79,4 +80,4 @@ void DetectCorsairLightingNodeControllers(std::vector<RGBController*> &rgb_contr
     }
 }   /* DetectCorsairLightingNodeControllers() */
 
-REGISTER_DETECTOR("Corsair Lighting Node", DetectCorsairLightingNodeControllers);
+REGISTER_USB_DETECTOR("Corsair Lighting Node", DetectCorsairLightingNodeControllers, CORSAIR_VID);
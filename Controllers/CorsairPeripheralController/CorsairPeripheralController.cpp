@@ -8,6 +8,7 @@
 \*-----------------------------------------*/
 
 #include "CorsairPeripheralController.h"
+#include "RGBColorTransform.h"
 
 #include <cstring>
 
@@ -59,7 +60,7 @@ CorsairPeripheralController::CorsairPeripheralController(hid_device* dev_handle)
 
 CorsairPeripheralController::~CorsairPeripheralController()
 {
-
+    hid_close(dev);
 }
 
 device_type CorsairPeripheralController::GetDeviceType()
@@ -136,28 +137,18 @@ void CorsairPeripheralController::SetLEDsKeyboardFull(std::vector<RGBColor> colo
     /*-----------------------------------------------------*\
     | Copy red, green, and blue components into buffers     |
     \*-----------------------------------------------------*/
-    for(std::size_t color_idx = 0; color_idx < colors.size(); color_idx++)
+    unsigned int * key_map = keys;
+
+    if (logical_layout == CORSAIR_TYPE_K95_PLAT)
     {
-        RGBColor           color = colors[color_idx];
-        if (logical_layout == CORSAIR_TYPE_K95_PLAT)
-        {
-            red_val[keys_k95_plat[color_idx]] = RGBGetRValue(color);
-            grn_val[keys_k95_plat[color_idx]] = RGBGetGValue(color);
-            blu_val[keys_k95_plat[color_idx]] = RGBGetBValue(color);
-        }
-        else if (logical_layout == CORSAIR_TYPE_K95)
-        {
-            red_val[keys_k95[color_idx]] = RGBGetRValue(color);
-            grn_val[keys_k95[color_idx]] = RGBGetGValue(color);
-            blu_val[keys_k95[color_idx]] = RGBGetBValue(color);
-        }
-        else
-        {
-            red_val[keys[color_idx]] = RGBGetRValue(color);
-            grn_val[keys[color_idx]] = RGBGetGValue(color);
-            blu_val[keys[color_idx]] = RGBGetBValue(color);
-        }
+        key_map = keys_k95_plat;
     }
+    else if (logical_layout == CORSAIR_TYPE_K95)
+    {
+        key_map = keys_k95;
+    }
+
+    RGBColorsToPlanarIndexed(colors.data(), colors.size(), key_map, red_val, grn_val, blu_val);
 
     /*-----------------------------------------------------*\
     | Send red bytes                                        |
@@ -143,7 +143,7 @@ void DetectCorsairPeripheralControllers(std::vector<RGBController*>& rgb_control
             &&(info->interface_number == device_list[device_idx].usb_interface))
 #endif
             {
-                dev = hid_open_path(info->path);
+                dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
 
                 if( dev )
                 {
@@ -156,6 +156,7 @@ void DetectCorsairPeripheralControllers(std::vector<RGBController*>& rgb_control
                         rgb_controller->name = device_list[device_idx].name;
 
                         rgb_controllers.push_back(rgb_controller);
+                        ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                     }
                 }
             }
@@ -164,4 +165,4 @@ void DetectCorsairPeripheralControllers(std::vector<RGBController*>& rgb_control
     }
 }   /* DetectCorsairPeripheralControllers() */
 
-REGISTER_DETECTOR("Corsair Peripheral", DetectCorsairPeripheralControllers);
+REGISTER_USB_DETECTOR("Corsair Peripheral", DetectCorsairPeripheralControllers, CORSAIR_VID);
@@ -19,7 +19,7 @@ DuckyKeyboardController::DuckyKeyboardController(hid_device* dev_handle)
 
 DuckyKeyboardController::~DuckyKeyboardController()
 {
-    
+    hid_close(dev);
 }
 
 void DuckyKeyboardController::SendColors
@@ -63,7 +63,7 @@ void DetectDuckyKeyboardControllers(std::vector<RGBController*>& rgb_controllers
             &&(info->product_id == device_list[device_idx].usb_pid)
             &&(info->interface_number == device_list[device_idx].usb_interface))
             {
-                dev = hid_open_path(info->path);
+                dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
 
                 if( dev )
                 {
@@ -74,6 +74,7 @@ void DetectDuckyKeyboardControllers(std::vector<RGBController*>& rgb_controllers
                     rgb_controller->name = device_list[device_idx].name;
                     
                     rgb_controllers.push_back(rgb_controller);
+                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                 }
             }
             info = info->next;
@@ -81,4 +82,4 @@ void DetectDuckyKeyboardControllers(std::vector<RGBController*>& rgb_controllers
     }
 }   /* DetectDuckyKeyboardControllers() */
 
-REGISTER_DETECTOR("Ducky Keyboard", DetectDuckyKeyboardControllers);
+REGISTER_USB_DETECTOR("Ducky Keyboard", DetectDuckyKeyboardControllers, DUCKY_VID);
@@ -47,7 +47,7 @@ void DetectEKControllers(std::vector<RGBController*>& rgb_controllers)
                 if((info->product_id        == ek_pids[ek_pid_idx][EK_PID])
                  &&(info->interface_number  == ek_pids[ek_pid_idx][EK_INTERFACE]))
                 {
-                    dev = hid_open_path(info->path);
+                    dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
                     break;
                 }
             }
@@ -58,10 +58,11 @@ void DetectEKControllers(std::vector<RGBController*>& rgb_controllers)
             EKController* controller = new EKController(dev, info->manufacturer_string, info->product_string, info->path);
             RGBController_EKController* rgb_controller = new RGBController_EKController(controller);
             rgb_controllers.push_back(rgb_controller);
+            ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
         }
         info = info->next;
     }
     hid_free_enumeration(info);
 }   /* DetectEKControllers() */
 
-REGISTER_DETECTOR("EK", DetectEKControllers);
+REGISTER_USB_DETECTOR("EK", DetectEKControllers, EK_VID);
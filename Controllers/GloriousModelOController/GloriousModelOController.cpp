@@ -27,7 +27,7 @@ GloriousModelOController::GloriousModelOController(hid_device* dev_handle)
 
 GloriousModelOController::~GloriousModelOController()
 {
-
+    hid_close(dev);
 }
 
 std::string GloriousModelOController::GetDeviceName()
@@ -36,7 +36,7 @@ void DetectGloriousModelOControllers(std::vector<RGBController*>& rgb_controller
         &&(info->interface_number == 1))
 #endif
         {
-            dev = hid_open_path(info->path);
+            dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
             break;
         }
         else
@@ -54,7 +54,8 @@ void DetectGloriousModelOControllers(std::vector<RGBController*>& rgb_controller
         rgb_controller->name = "Glorious Mouse";
 
         rgb_controllers.push_back(rgb_controller);
+        ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
     }
 }   /* DetectGloriousModelOControllers() */
 
-REGISTER_DETECTOR("Glorious Model O", DetectGloriousModelOControllers);
+REGISTER_USB_DETECTOR("Glorious Model O", DetectGloriousModelOControllers, Glorious_Model_O_VID);
@@ -15,6 +15,11 @@ HoltekA070Controller::HoltekA070Controller(hid_device* dev_handle)
     dev = dev_handle;
 }
 
+HoltekA070Controller::~HoltekA070Controller()
+{
+    hid_close(dev);
+}
+
 /*-------------------------------------------------------------------------------------------------*\
 | Private packet sending functions.                                                                 |
 \*-------------------------------------------------------------------------------------------------*/
@@ -57,7 +57,7 @@ void DetectHoltekControllers(std::vector<RGBController*>& rgb_controllers)
                     &&(info->interface_number == device_list[device_idx].usb_interface))
 #endif
                     {
-                        hid_device* dev = hid_open_path(info->path);
+                        hid_device* dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
 
                         if(dev)
                         {
@@ -71,6 +71,7 @@ void DetectHoltekControllers(std::vector<RGBController*>& rgb_controllers)
 
                                     rgb_controller->name = device_list[device_idx].name;
                                     rgb_controllers.push_back(rgb_controller);
+                                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                                 }
                                 break;
                             }
@@ -86,4 +87,4 @@ void DetectHoltekControllers(std::vector<RGBController*>& rgb_controllers)
     }
 }   /* DetectHoltekControllers() */
 
-REGISTER_DETECTOR("Holtek", DetectHoltekControllers);
+REGISTER_USB_DETECTOR("Holtek", DetectHoltekControllers, HOLTEK_VID);
@@ -21,7 +21,7 @@ HyperXAlloyOriginsController::HyperXAlloyOriginsController(hid_device* dev_handl
 
 HyperXAlloyOriginsController::~HyperXAlloyOriginsController()
 {
-
+    hid_close(dev);
 }
 
 void HyperXAlloyOriginsController::SetLEDsDirect(std::vector<RGBColor> colors)
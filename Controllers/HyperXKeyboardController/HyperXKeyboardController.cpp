@@ -34,7 +34,7 @@ HyperXKeyboardController::HyperXKeyboardController(hid_device* dev_handle)
 
 HyperXKeyboardController::~HyperXKeyboardController()
 {
-
+    hid_close(dev);
 }
 
 void HyperXKeyboardController::SetMode
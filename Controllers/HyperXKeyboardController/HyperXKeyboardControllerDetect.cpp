@@ -71,7 +71,7 @@ void DetectHyperXKeyboardControllers(std::vector<RGBController*>& rgb_controller
             &&(info->interface_number == device_list[device_idx].usb_interface))
 #endif
             {
-                dev = hid_open_path(info->path);
+                dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
 
                 if( dev )
                 {
@@ -82,6 +82,7 @@ void DetectHyperXKeyboardControllers(std::vector<RGBController*>& rgb_controller
                     rgb_controller->name = device_list[device_idx].name;
 
                     rgb_controllers.push_back(rgb_controller);
+                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                 }
             }
 
@@ -90,7 +91,7 @@ void DetectHyperXKeyboardControllers(std::vector<RGBController*>& rgb_controller
             &&(info->product_id == device_list[device_idx].usb_pid)
             &&(info->interface_number == device_list[device_idx].usb_interface))
             {
-                dev = hid_open_path(info->path);
+                dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
 
                 if( dev )
                 {
@@ -101,6 +102,7 @@ void DetectHyperXKeyboardControllers(std::vector<RGBController*>& rgb_controller
                     rgb_controller->name = device_list[device_idx].name;
                     
                     rgb_controllers.push_back(rgb_controller);
+                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                 }
             }
 
@@ -109,4 +111,4 @@ void DetectHyperXKeyboardControllers(std::vector<RGBController*>& rgb_controller
     }
 }   /* DetectHyperXKeyboardControllers() */
 
-REGISTER_DETECTOR("HyperX Keyboard", DetectHyperXKeyboardControllers);
+REGISTER_USB_DETECTOR("HyperX Keyboard", DetectHyperXKeyboardControllers, HYPERX_KEYBOARD_VID);
@@ -62,7 +62,7 @@ void DetectHyperXMouseControllers(std::vector<RGBController*>& rgb_controllers)
             &&(info->interface_number == device_list[device_idx].usb_interface))
     #endif
             {
-                dev = hid_open_path(info->path);
+                dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
 
                 if( dev )
                 {
@@ -73,6 +73,7 @@ void DetectHyperXMouseControllers(std::vector<RGBController*>& rgb_controllers)
                     rgb_controller->name = device_list[device_idx].name;
                     
                     rgb_controllers.push_back(rgb_controller);
+                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                 }
             }
 
@@ -81,4 +82,4 @@ void DetectHyperXMouseControllers(std::vector<RGBController*>& rgb_controllers)
     }
 }   /* DetectHyperXMouseControllers() */
 
-REGISTER_DETECTOR("HyperX Mouse", DetectHyperXMouseControllers);
+REGISTER_USB_DETECTOR("HyperX Mouse", DetectHyperXMouseControllers, HYPERX_VID);
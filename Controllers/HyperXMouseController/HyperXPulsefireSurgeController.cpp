@@ -18,7 +18,7 @@ HyperXPulsefireSurgeController::HyperXPulsefireSurgeController(hid_device* dev_h
 
 HyperXPulsefireSurgeController::~HyperXPulsefireSurgeController()
 {
-
+    hid_close(dev);
 }
 
 /*-------------------------------------------------------------------------------------------------*\
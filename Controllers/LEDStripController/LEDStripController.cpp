@@ -5,6 +5,7 @@
 \*---------------------------------------------------------*/
 
 #include "LEDStripController.h"
+#include "RGBColorTransform.h"
 
 #include <fstream>
 #include <iostream>
@@ -106,22 +107,16 @@ char* LEDStripController::GetLEDString()
     return(led_string);
 }
 
-void LEDStripController::SetLEDs(std::vector<RGBColor> colors)
+bool LEDStripController::SetLEDs(std::vector<RGBColor> colors)
 {
     unsigned char *serial_buf;
+    int            bytes_written = -1;
 
     serial_buf = new unsigned char[(num_leds * 3) + 3];
 
     serial_buf[0] = 0xAA;
 
-    for (int idx = 0; idx < (num_leds * 3); idx += 3)
-    {
-        int pixel_idx = idx / 3;
-        RGBColor color = colors[pixel_idx];
-        serial_buf[idx + 1] = RGBGetRValue(color);
-        serial_buf[idx + 2] = RGBGetGValue(color);
-        serial_buf[idx + 3] = RGBGetBValue(color);
-    }
+    RGBColorsToBytes(colors.data(), num_leds, &serial_buf[1], RGB_ORDER_RGB);
 
     unsigned short sum = 0;
 
@@ -135,13 +130,15 @@ void LEDStripController::SetLEDs(std::vector<RGBColor> colors)
 
     if (serialport != NULL)
     {
-        serialport->serial_write((char *)serial_buf, (num_leds * 3) + 3);
+        bytes_written = serialport->serial_write((char *)serial_buf, (num_leds * 3) + 3);
         serialport->serial_flush_tx();
     }
     else if (udpport != NULL)
     {
-        udpport->udp_write((char *)serial_buf, (num_leds * 3) + 3);
+        bytes_written = udpport->udp_write((char *)serial_buf, (num_leds * 3) + 3);
     }
 
     delete[] serial_buf;
+
+    return(bytes_written == ((num_leds * 3) + 3));
 }
\ No newline at end of file
@@ -33,7 +33,7 @@ public:
     void InitializeSerial(char* portname, int baud);
     void InitializeUDP(char* clientname, char* port);
     char* GetLEDString();
-    void SetLEDs(std::vector<RGBColor> colors);
+    bool SetLEDs(std::vector<RGBColor> colors);
 
     int num_leds;
 
@@ -114,7 +114,7 @@ void DetectLogitechControllers(std::vector<RGBController*>& rgb_controllers)
                     &&(info->interface_number == device_list[device_idx].usb_interface))
 #endif
                     {
-                        hid_device* dev_usage_0x0602 = hid_open_path(info->path);
+                        hid_device* dev_usage_0x0602 = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
 
                         if(dev_usage_0x0602)
                         {
@@ -139,6 +139,7 @@ void DetectLogitechControllers(std::vector<RGBController*>& rgb_controllers)
 
                                         rgb_controller->name = device_list[device_idx].name;
                                         rgb_controllers.push_back(rgb_controller);
+                                        ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                                     }
                                 }
                                 tmp_info_0x0604 = tmp_info_0x0604->next;
@@ -150,6 +151,7 @@ void DetectLogitechControllers(std::vector<RGBController*>& rgb_controllers)
 
                             rgb_controller->name = device_list[device_idx].name;
                             rgb_controllers.push_back(rgb_controller);
+                            ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
 #endif
                         }
                     }
@@ -178,7 +180,7 @@ void DetectLogitechControllers(std::vector<RGBController*>& rgb_controllers)
                     &&(info->interface_number == device_list[device_idx].usb_interface))
 #endif
                     {
-                        hid_device* dev = hid_open_path(info->path);
+                        hid_device* dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
 
                         if(dev)
                         {
@@ -192,6 +194,7 @@ void DetectLogitechControllers(std::vector<RGBController*>& rgb_controllers)
 
                                     rgb_controller->name = device_list[device_idx].name;
                                     rgb_controllers.push_back(rgb_controller);
+                                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                                 }
                                 break;
 
@@ -203,6 +206,7 @@ void DetectLogitechControllers(std::vector<RGBController*>& rgb_controllers)
 
                                     rgb_controller->name = device_list[device_idx].name;
                                     rgb_controllers.push_back(rgb_controller);
+                                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                                 }
                                 break;
 
@@ -215,6 +219,7 @@ void DetectLogitechControllers(std::vector<RGBController*>& rgb_controllers)
 
                                     rgb_controller->name = device_list[device_idx].name;
                                     rgb_controllers.push_back(rgb_controller);
+                                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                                 }
                                 break;
 
@@ -227,6 +232,7 @@ void DetectLogitechControllers(std::vector<RGBController*>& rgb_controllers)
 
                                     rgb_controller->name = device_list[device_idx].name;
                                     rgb_controllers.push_back(rgb_controller);
+                                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                                 }
                                 break;
                             
@@ -239,6 +245,7 @@ void DetectLogitechControllers(std::vector<RGBController*>& rgb_controllers)
 
                                     rgb_controller->name = device_list[device_idx].name;
                                     rgb_controllers.push_back(rgb_controller);
+                                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                                 }
                                 break;
                             case LOGITECH_G_LIGHTSPEED_POWERPLAY_PID:
@@ -250,6 +257,7 @@ void DetectLogitechControllers(std::vector<RGBController*>& rgb_controllers)
 
                                     mouse_rgb_controller->name = device_list[device_idx].name;
                                     rgb_controllers.push_back(mouse_rgb_controller);
+                                    ResourceManager::get()->RegisterDevicePath(info->path, mouse_rgb_controller);
                                     
                                     //Add Powerplay mousemat
                                     LogitechGPowerPlayController* mousemat_controller = new LogitechGPowerPlayController(dev);
@@ -258,6 +266,7 @@ void DetectLogitechControllers(std::vector<RGBController*>& rgb_controllers)
 
                                     mousemat_rgb_controller->name = device_list[device_idx].name;
                                     rgb_controllers.push_back(mousemat_rgb_controller);
+                                    ResourceManager::get()->RegisterDevicePath(info->path, mousemat_rgb_controller);
                                 }
                                 break;
                             }
@@ -273,4 +282,4 @@ void DetectLogitechControllers(std::vector<RGBController*>& rgb_controllers)
     }
 }   /* DetectLogitechControllers() */
 
-REGISTER_DETECTOR("Logitech", DetectLogitechControllers);
+REGISTER_USB_DETECTOR("Logitech", DetectLogitechControllers, LOGITECH_VID);
@@ -16,6 +16,11 @@ LogitechG203Controller::LogitechG203Controller(hid_device* dev_handle)
     dev = dev_handle;
 }
 
+LogitechG203Controller::~LogitechG203Controller()
+{
+    hid_close(dev);
+}
+
 /*-------------------------------------------------------------------------------------------------*\
 | Private packet sending functions.                                                                 |
 \*-------------------------------------------------------------------------------------------------*/
@@ -7,6 +7,11 @@ LogitechG203LController::LogitechG203LController(hid_device* dev_handle)
     dev = dev_handle;
 }
 
+LogitechG203LController::~LogitechG203LController()
+{
+    hid_close(dev);
+}
+
 void LogitechG203LController::SendApply()
 {
     unsigned char usb_buf[20];
@@ -18,7 +18,7 @@ MSI3ZoneController::MSI3ZoneController(hid_device* dev_handle)
 
 MSI3ZoneController::~MSI3ZoneController()
 {
-
+    hid_close(dev);
 }
 
 char* MSI3ZoneController::GetDeviceName()
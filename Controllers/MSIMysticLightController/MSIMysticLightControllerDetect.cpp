@@ -81,7 +81,7 @@ void DetectMSIMysticLightControllers(std::vector<RGBController*> &rgb_controller
             if((info->vendor_id == MSI_USB_VID)
             &&(info->product_id == msi_pid_table[device_idx]))
             {
-                dev = hid_open_path(info->path);
+                dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
                 break;
             }
             else
@@ -97,6 +97,7 @@ void DetectMSIMysticLightControllers(std::vector<RGBController*> &rgb_controller
             RGBController_MSIMysticLight * rgb_controller = new RGBController_MSIMysticLight(controller);
             
             rgb_controllers.push_back(rgb_controller);
+            ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
         }
     }
 }   /* DetectMSIMysticLightControllers() */
@@ -50,6 +50,11 @@ MSIRGBController::MSIRGBController(int sioaddr)
 
     std::string board_dmi = board.getMainboard();
 
+    /*-----------------------------------------------------*\
+    | Keep the port open for the whole setup sequence       |
+    \*-----------------------------------------------------*/
+    SuperIOSession session(msi_sioaddr);
+
     /*-----------------------------------------------------*\
     | This setup step isn't well documented                 |
     | Without this, pulsing does not work                   |
@@ -117,6 +122,11 @@ void MSIRGBController::SetColor(unsigned char red, unsigned char green, unsigned
     green   = green >> 4;
     blue    = blue >> 4;
 
+    /*-----------------------------------------------------*\
+    | Keep the port open for the whole register sequence    |
+    \*-----------------------------------------------------*/
+    SuperIOSession session(msi_sioaddr);
+
     /*-----------------------------------------------------*\
     | Set logical device register to RGB controller         |
     \*-----------------------------------------------------*/
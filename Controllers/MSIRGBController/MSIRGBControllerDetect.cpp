@@ -23,6 +23,8 @@ void DetectMSIRGBControllers(std::vector<RGBController*> &rgb_controllers)
     {
         int sioaddr = sio_addrs[sioaddr_idx];
 
+        SuperIOSession session(sioaddr);
+
         superio_enter(sioaddr);
 
         int val = (superio_inb(sioaddr, SIO_REG_DEVID) << 8) | superio_inb(sioaddr, SIO_REG_DEVID + 1);
@@ -5,6 +5,7 @@
 \*---------------------------------------------------------*/
 
 #include "NZXTHue2Controller.h"
+#include "RGBColorTransform.h"
 
 #include <fstream>
 #include <iostream>
@@ -28,7 +29,7 @@ NZXTHue2Controller::NZXTHue2Controller(hid_device* dev_handle, unsigned int rgb_
 
 NZXTHue2Controller::~NZXTHue2Controller()
 {
-
+    hid_close(dev);
 }
 
 unsigned char NZXTHue2Controller::GetFanCommand
@@ -235,14 +236,7 @@ void NZXTHue2Controller::SetChannelLEDs
     /*-----------------------------------------------------*\
     | Fill in color data (up to 40 colors)                  |
     \*-----------------------------------------------------*/
-    for (std::size_t idx = 0; idx < num_colors; idx++)
-    {
-        int pixel_idx = idx * 3;
-        RGBColor color = colors[idx];
-        color_data[pixel_idx + 0x00] = RGBGetGValue(color);
-        color_data[pixel_idx + 0x01] = RGBGetRValue(color);
-        color_data[pixel_idx + 0x02] = RGBGetBValue(color);
-    }
+    RGBColorsToBytes(colors, num_colors, color_data, RGB_ORDER_GRB);
 
     /*-----------------------------------------------------*\
     | Send first group of color data                        |
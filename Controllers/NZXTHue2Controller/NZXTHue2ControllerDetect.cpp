@@ -60,7 +60,7 @@ void DetectNZXTHue2Controllers(std::vector<RGBController*> &rgb_controllers)
             if((info->vendor_id == device_list[device_idx].usb_vid)
             &&(info->product_id == device_list[device_idx].usb_pid))
             {
-                dev = hid_open_path(info->path);
+                dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
 
                 if( dev )
                 {
@@ -71,6 +71,7 @@ void DetectNZXTHue2Controllers(std::vector<RGBController*> &rgb_controllers)
                     rgb_controller->name = device_list[device_idx].name;
                     
                     rgb_controllers.push_back(rgb_controller);
+                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                 }
             }
             info = info->next;
@@ -78,4 +79,4 @@ void DetectNZXTHue2Controllers(std::vector<RGBController*> &rgb_controllers)
     }
 }   /* DetectNZXTHue2Controllers() */
 
-REGISTER_DETECTOR("NZXT Hue 2", DetectNZXTHue2Controllers);
+REGISTER_USB_DETECTOR("NZXT Hue 2", DetectNZXTHue2Controllers, NZXT_VID);
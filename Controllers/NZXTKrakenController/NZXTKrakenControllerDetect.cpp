@@ -54,7 +54,7 @@ void DetectNZXTKrakenControllers(std::vector<RGBController*> &rgb_controllers)
             if((info->vendor_id == device_list[device_idx].usb_vid)
             &&(info->product_id == device_list[device_idx].usb_pid))
             {
-                dev = hid_open_path(info->path);
+                dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
                 
                 if( dev )
                 {
@@ -65,6 +65,7 @@ void DetectNZXTKrakenControllers(std::vector<RGBController*> &rgb_controllers)
                     rgb_controller->name = device_list[device_idx].name;
                     
                     rgb_controllers.push_back(rgb_controller);
+                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                 }
             }
             info = info->next;
@@ -72,4 +73,4 @@ void DetectNZXTKrakenControllers(std::vector<RGBController*> &rgb_controllers)
     }
 }   /* DetectNZXTKrakenControllers() */
 
-REGISTER_DETECTOR("NZXT Kraken", DetectNZXTKrakenControllers);
+REGISTER_USB_DETECTOR("NZXT Kraken", DetectNZXTKrakenControllers, NZXT_KRAKEN_VID);
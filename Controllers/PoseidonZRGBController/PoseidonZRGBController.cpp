@@ -29,7 +29,7 @@ PoseidonZRGBController::PoseidonZRGBController(hid_device* dev_handle)
 
 PoseidonZRGBController::~PoseidonZRGBController()
 {
-
+    hid_close(dev);
 }
 
 void PoseidonZRGBController::SetMode(unsigned char mode, unsigned char direction, unsigned char speed)
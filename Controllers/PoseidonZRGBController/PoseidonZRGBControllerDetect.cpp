@@ -38,7 +38,7 @@ void DetectPoseidonZRGBControllers(std::vector<RGBController*>& rgb_controllers)
          &&(info->interface_number == 1))
 #endif
         {
-            dev = hid_open_path(info->path);
+            dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
             if( dev )
             {
                 PoseidonZRGBController* controller = new PoseidonZRGBController(dev);
@@ -46,6 +46,7 @@ void DetectPoseidonZRGBControllers(std::vector<RGBController*>& rgb_controllers)
                 RGBController_PoseidonZRGB* rgb_controller = new RGBController_PoseidonZRGB(controller);
 
                 rgb_controllers.push_back(rgb_controller);
+                ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
             }
         }
             info = info->next;
@@ -53,4 +54,4 @@ void DetectPoseidonZRGBControllers(std::vector<RGBController*>& rgb_controllers)
 
 }   /* DetectPoseidonZRGBControllers() */
 
-REGISTER_DETECTOR("Thermaltake Poseidon Z RGB", DetectPoseidonZRGBControllers);
+REGISTER_USB_DETECTOR("Thermaltake Poseidon Z RGB", DetectPoseidonZRGBControllers, TT_POSEIDON_Z_RGB_VID);
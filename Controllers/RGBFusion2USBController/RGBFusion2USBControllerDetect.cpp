@@ -54,13 +54,14 @@ void DetectRGBFusion2USBControllers(std::vector<RGBController*> &rgb_controllers
             &&(info->product_id        == tmpPID))
 #endif
             {
-                dev = hid_open_path(info->path);
+                dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
                 
                 if (dev)
                 {
                     RGBFusion2USBController * controller = new RGBFusion2USBController(dev, info->path, MB_info.getMainboard());
                     RGBController_RGBFusion2USB * rgb_controller = new RGBController_RGBFusion2USB(controller);
                     rgb_controllers.push_back(rgb_controller);
+                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                 }
             }
             info = info->next;
@@ -70,4 +71,4 @@ void DetectRGBFusion2USBControllers(std::vector<RGBController*> &rgb_controllers
     hid_free_enumeration(info);
 }   /* DetectRGBFusion2USBControllers() */
 
-REGISTER_DETECTOR("Gigabyte RGB Fusion 2 USB", DetectRGBFusion2USBControllers);
+REGISTER_USB_DETECTOR("Gigabyte RGB Fusion 2 USB", DetectRGBFusion2USBControllers, IT8297_VID);
@@ -91,7 +91,7 @@ void DetectRedragonControllers(std::vector<RGBController*>& rgb_controllers)
             &&(info->interface_number == device_list[device_idx].usb_interface))
 #endif
             {
-                dev = hid_open_path(info->path);
+                dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
 
                 if( dev )
                 {
@@ -105,6 +105,7 @@ void DetectRedragonControllers(std::vector<RGBController*>& rgb_controllers)
 
                             rgb_controller->name = device_list[device_idx].name;
                             rgb_controllers.push_back(rgb_controller);
+                            ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                             }
                             break;
 
@@ -116,6 +117,7 @@ void DetectRedragonControllers(std::vector<RGBController*>& rgb_controllers)
 
                             rgb_controller->name = device_list[device_idx].name;
                             rgb_controllers.push_back(rgb_controller);
+                            ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                             }
                             break;
                     }
@@ -126,4 +128,4 @@ void DetectRedragonControllers(std::vector<RGBController*>& rgb_controllers)
     }
 }   /* DetectRedragonControllers() */
 
-REGISTER_DETECTOR("Redragon Peripheral", DetectRedragonControllers);
+REGISTER_USB_DETECTOR("Redragon Peripheral", DetectRedragonControllers, REDRAGON_KEYBOARD_VID, REDRAGON_MOUSE_VID);
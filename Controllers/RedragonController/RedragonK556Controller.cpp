@@ -7,6 +7,11 @@ RedragonK556Controller::RedragonK556Controller(hid_device* dev_handle)
     dev = dev_handle;
 }
 
+RedragonK556Controller::~RedragonK556Controller()
+{
+    hid_close(dev);
+}
+
 void RedragonK556Controller::SetKeyboardColors
     (
     unsigned char *     color_data,
@@ -12,6 +12,11 @@ RedragonM711Controller::RedragonM711Controller(hid_device* dev_handle)
     SendMouseApply();
 }
 
+RedragonM711Controller::~RedragonM711Controller()
+{
+    hid_close(dev);
+}
+
 void RedragonM711Controller::SendMouseColor
     (
     unsigned char       red,
@@ -113,7 +113,7 @@ void DetectSteelSeriesControllers(std::vector<RGBController*>& rgb_controllers)
             &&(info->product_id == device_list[device_idx].usb_pid)
             &&(info->interface_number == device_list[device_idx].usb_interface))
             {
-                dev = hid_open_path(info->path);
+                dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
                 break;
             }
             else
@@ -133,6 +133,7 @@ void DetectSteelSeriesControllers(std::vector<RGBController*>& rgb_controllers)
                     RGBController_SteelSeriesApex* rgb_controller = new RGBController_SteelSeriesApex(controller);
                     rgb_controller->name = device_list[device_idx].name;
                     rgb_controllers.push_back(rgb_controller);
+                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                     }
                     break;
 
@@ -143,6 +144,7 @@ void DetectSteelSeriesControllers(std::vector<RGBController*>& rgb_controllers)
                     RGBController_SteelSeriesSiberia* rgb_controller = new RGBController_SteelSeriesSiberia(controller);
                     rgb_controller->name = device_list[device_idx].name;
                     rgb_controllers.push_back(rgb_controller);
+                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                     }
                     break;
 
@@ -153,6 +155,7 @@ void DetectSteelSeriesControllers(std::vector<RGBController*>& rgb_controllers)
                     RGBController_SteelSeriesRival* rgb_controller = new RGBController_SteelSeriesRival(controller);
                     rgb_controller->name = device_list[device_idx].name;
                     rgb_controllers.push_back(rgb_controller);
+                    ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
                     }
                     break;
 
@@ -164,4 +167,4 @@ void DetectSteelSeriesControllers(std::vector<RGBController*>& rgb_controllers)
     }
 }   /* DetectSteelSeriesControllers() */
 
-REGISTER_DETECTOR("SteelSeries", DetectSteelSeriesControllers);
+REGISTER_USB_DETECTOR("SteelSeries", DetectSteelSeriesControllers, STEELSERIES_VID);
@@ -39,7 +39,7 @@ SteelSeriesRivalController::SteelSeriesRivalController
 
 SteelSeriesRivalController::~SteelSeriesRivalController()
 {
-
+    hid_close(dev);
 }
 
 char* SteelSeriesRivalController::GetDeviceName()
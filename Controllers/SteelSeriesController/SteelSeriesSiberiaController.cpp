@@ -43,6 +43,7 @@ SteelSeriesSiberiaController::SteelSeriesSiberiaController
 
 SteelSeriesSiberiaController::~SteelSeriesSiberiaController()
 {
+    hid_close(dev);
 }
 
 char* SteelSeriesSiberiaController::GetDeviceName()
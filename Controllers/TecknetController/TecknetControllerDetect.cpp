@@ -67,7 +67,7 @@ void DetectTecknetControllers(std::vector<RGBController*>& rgb_controllers)
                 &&(info->product_id         == tecknet_pids[pid_idx][TECKNET_PID]))
 #endif
                 {
-                    dev = hid_open_path(info->path);
+                    dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
                     break;
                 }
             }
@@ -78,10 +78,11 @@ void DetectTecknetControllers(std::vector<RGBController*>& rgb_controllers)
             TecknetController* controller = new TecknetController(dev, info->path);
             RGBController_Tecknet* rgb_controller = new RGBController_Tecknet(controller);
             rgb_controllers.push_back(rgb_controller);
+            ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
         }
         info = info->next;
     }
     hid_free_enumeration(info);
 }   /* DetectTecknetControllers) */
 
-REGISTER_DETECTOR("Tecknet", DetectTecknetControllers);
+REGISTER_USB_DETECTOR("Tecknet", DetectTecknetControllers, TECKNET_VID);
@@ -20,7 +20,7 @@ ThermaltakeRiingController::ThermaltakeRiingController(hid_device* dev_handle)
 
 ThermaltakeRiingController::~ThermaltakeRiingController()
 {
-
+    hid_close(dev);
 }
 
 void ThermaltakeRiingController::SetChannelLEDs(unsigned char channel, RGBColor * colors, unsigned int num_colors)
@@ -36,7 +36,7 @@ void DetectThermaltakeRiingControllers(std::vector<RGBController*>& rgb_controll
             if((info->vendor_id == THERMALTAKE_RIING_VID)
             &&(info->product_id == pid))
             {
-                dev = hid_open_path(info->path);
+                dev = ResourceManager::get()->IsDevicePathOpen(info->path) ? NULL : hid_open_path(info->path);
                 break;
             }
             else
@@ -52,8 +52,9 @@ void DetectThermaltakeRiingControllers(std::vector<RGBController*>& rgb_controll
             RGBController_ThermaltakeRiing* rgb_controller = new RGBController_ThermaltakeRiing(controller);
 
             rgb_controllers.push_back(rgb_controller);
+            ResourceManager::get()->RegisterDevicePath(info->path, rgb_controller);
         }
     }
 }   /* DetectThermaltakeRiingControllers() */
 
-REGISTER_DETECTOR("Thermaltake Riing", DetectThermaltakeRiingControllers);
+REGISTER_USB_DETECTOR("Thermaltake Riing", DetectThermaltakeRiingControllers, THERMALTAKE_RIING_VID);
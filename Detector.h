@@ -3,5 +3,6 @@
 #include "DeviceDetector.h"
 
 #define REGISTER_DETECTOR(name, func) static DeviceDetector device_detector_obj(name, func)
+#define REGISTER_USB_DETECTOR(name, func, ...) static DeviceDetector device_detector_obj(name, func, { __VA_ARGS__ })
 #define REGISTER_I2C_DETECTOR(name, func) static I2CDeviceDetector device_detector_obj(name, func)
 #define REGISTER_I2C_BUS_DETECTOR(func) static I2CBusDetector device_detector_obj(func)
@@ -9,9 +9,9 @@
 class DeviceDetector
 {
 public:
-    DeviceDetector(std::string name, DeviceDetectorFunction detector)
+    DeviceDetector(std::string name, DeviceDetectorFunction detector, std::vector<unsigned short> hotplug_vids = std::vector<unsigned short>())
 	{
-        ResourceManager::get()->RegisterDeviceDetector(name, detector);
+        ResourceManager::get()->RegisterDeviceDetector(name, detector, hotplug_vids);
 	}
 };
 
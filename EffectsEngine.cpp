@@ -0,0 +1,320 @@
+/*-----------------------------------------*\
+|  EffectsEngine.cpp                        |
+|                                           |
+|  Server-side lighting effects renderer.   |
+|  Renders effects directly into the        |
+|  RGBController color buffers so SDK       |
+|  clients only need to send parameters     |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "EffectsEngine.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+/*-----------------------------------------------------*\
+| Hue values are integers in [0, 1536), six segments of |
+| 256 steps each, so conversion needs no floating point |
+\*-----------------------------------------------------*/
+#define HUE_RANGE               1536
+
+static inline RGBColor HueToRGB(unsigned int hue, unsigned int brightness)
+{
+    unsigned int segment    = hue >> 8;
+    unsigned int ramp       = hue & 0xFF;
+    unsigned int red        = 0;
+    unsigned int green      = 0;
+    unsigned int blue       = 0;
+
+    switch(segment)
+    {
+        case 0: red = 255;          green = ramp;       blue = 0;           break;
+        case 1: red = 255 - ramp;   green = 255;        blue = 0;           break;
+        case 2: red = 0;            green = 255;        blue = ramp;        break;
+        case 3: red = 0;            green = 255 - ramp; blue = 255;         break;
+        case 4: red = ramp;         green = 0;          blue = 255;         break;
+        default:red = 255;          green = 0;          blue = 255 - ramp;  break;
+    }
+
+    red     = (red   * brightness) >> 8;
+    green   = (green * brightness) >> 8;
+    blue    = (blue  * brightness) >> 8;
+
+    return(ToRGBColor(red, green, blue));
+}
+
+static inline RGBColor ScaleColor(RGBColor color, unsigned int scale)
+{
+    unsigned int red    = (RGBGetRValue(color) * scale) >> 8;
+    unsigned int green  = (RGBGetGValue(color) * scale) >> 8;
+    unsigned int blue   = (RGBGetBValue(color) * scale) >> 8;
+
+    return(ToRGBColor(red, green, blue));
+}
+
+EffectsEngine::EffectsEngine(std::vector<RGBController *>& control, std::mutex& control_mutex) : controllers(control), ControllersMutex(control_mutex)
+{
+    active_effects  = 0;
+    RenderThread    = NULL;
+    render_running  = false;
+
+    /*-----------------------------------------------------*\
+    | Precompute one breathing cycle, a raised cosine from  |
+    | 0 up to 255 and back                                  |
+    \*-----------------------------------------------------*/
+    for(unsigned int lut_idx = 0; lut_idx < 256; lut_idx++)
+    {
+        breathing_lut[lut_idx] = (unsigned char)(127.5f - 127.5f * cosf(lut_idx * 2.0f * 3.14159265f / 256.0f));
+    }
+}
+
+EffectsEngine::~EffectsEngine()
+{
+    Stop();
+}
+
+void EffectsEngine::SetEffect(unsigned int dev_idx, EffectParameters& params)
+{
+    if(dev_idx >= controllers.size() || params.effect >= ENGINE_EFFECT_COUNT)
+    {
+        return;
+    }
+
+    EffectsMutex.lock();
+
+    /*-----------------------------------------------------*\
+    | Grow the parameter list only when devices are added   |
+    \*-----------------------------------------------------*/
+    if(effects.size() < controllers.size())
+    {
+        EffectParameters none;
+
+        memset(&none, 0, sizeof(none));
+        effects.resize(controllers.size(), none);
+    }
+
+    if(effects[dev_idx].effect != ENGINE_EFFECT_NONE)
+    {
+        active_effects--;
+    }
+
+    effects[dev_idx] = params;
+
+    if(effects[dev_idx].wave_length == 0)
+    {
+        effects[dev_idx].wave_length = 1;
+    }
+
+    if(effects[dev_idx].effect != ENGINE_EFFECT_NONE)
+    {
+        active_effects++;
+    }
+
+    bool start = (active_effects > 0);
+
+    EffectsMutex.unlock();
+
+    /*-----------------------------------------------------*\
+    | Effects render in per-LED mode                        |
+    \*-----------------------------------------------------*/
+    if(params.effect != ENGINE_EFFECT_NONE)
+    {
+        controllers[dev_idx]->SetCustomMode();
+        controllers[dev_idx]->ForceUpdateMode();
+    }
+
+    if(start)
+    {
+        Start();
+    }
+}
+
+EffectParameters EffectsEngine::GetEffect(unsigned int dev_idx)
+{
+    EffectParameters params;
+
+    memset(&params, 0, sizeof(params));
+
+    EffectsMutex.lock();
+
+    if(dev_idx < effects.size())
+    {
+        params = effects[dev_idx];
+    }
+
+    EffectsMutex.unlock();
+
+    return(params);
+}
+
+void EffectsEngine::Start()
+{
+    if(render_running.exchange(true))
+    {
+        return;
+    }
+
+    if(RenderThread != NULL)
+    {
+        RenderThread->join();
+        delete RenderThread;
+    }
+
+    RenderThread = new std::thread(&EffectsEngine::RenderThreadFunction, this);
+}
+
+void EffectsEngine::Stop()
+{
+    render_running = false;
+
+    if(RenderThread != NULL)
+    {
+        RenderThread->join();
+        delete RenderThread;
+        RenderThread = NULL;
+    }
+}
+
+void EffectsEngine::RenderThreadFunction()
+{
+    /*-----------------------------------------------------*\
+    | Fixed timestep loop.  Effects are a function of the   |
+    | tick count only, so a late frame never changes the    |
+    | animation speed.  If the loop falls more than a few   |
+    | frames behind, skip ahead instead of bursting         |
+    \*-----------------------------------------------------*/
+    const std::chrono::nanoseconds          frame_time(1000000000 / EFFECTS_ENGINE_RATE);
+    std::chrono::steady_clock::time_point   next_frame  = std::chrono::steady_clock::now();
+    unsigned long long                      tick        = 0;
+
+    while(render_running.load())
+    {
+        RenderFrame(tick);
+
+        tick++;
+        next_frame += frame_time;
+
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+        if(now - next_frame > 4 * frame_time)
+        {
+            unsigned long long skipped = (now - next_frame) / frame_time;
+
+            tick       += skipped;
+            next_frame += skipped * frame_time;
+        }
+
+        std::this_thread::sleep_until(next_frame);
+
+        /*-----------------------------------------------------*\
+        | Stop rendering once all effects have been cleared     |
+        \*-----------------------------------------------------*/
+        EffectsMutex.lock();
+
+        if(active_effects == 0)
+        {
+            render_running = false;
+        }
+
+        EffectsMutex.unlock();
+    }
+}
+
+void EffectsEngine::RenderFrame(unsigned long long tick)
+{
+    /*-----------------------------------------------------*\
+    | The list lock is always taken before the effects lock |
+    \*-----------------------------------------------------*/
+    ControllersMutex.lock();
+    EffectsMutex.lock();
+
+    std::size_t                     num_devices = std::min(effects.size(), controllers.size());
+    std::vector<RGBController *>    rendered_controllers;
+
+    for(std::size_t dev_idx = 0; dev_idx < num_devices; dev_idx++)
+    {
+        EffectParameters& params     = effects[dev_idx];
+        RGBController*    controller = controllers[dev_idx];
+
+        if(params.effect == ENGINE_EFFECT_NONE || controller->colors.size() == 0)
+        {
+            continue;
+        }
+
+        /*-----------------------------------------------------*\
+        | Phase of the effect cycle in [0, 65536)               |
+        \*-----------------------------------------------------*/
+        unsigned int phase = (unsigned int)(((tick * params.speed) << 16) / (60 * EFFECTS_ENGINE_RATE)) & 0xFFFF;
+
+        /*-----------------------------------------------------*\
+        | Render into the device's staged frame                 |
+        \*-----------------------------------------------------*/
+        RGBColor*       colors      = controller->BeginStagedFrame();
+        std::size_t     num_colors  = controller->colors.size();
+
+        switch(params.effect)
+        {
+            case ENGINE_EFFECT_WAVE:
+                RenderWave(colors, num_colors, params, phase);
+                break;
+
+            case ENGINE_EFFECT_BREATHING:
+                RenderBreathing(colors, num_colors, params, phase);
+                break;
+
+            case ENGINE_EFFECT_SPECTRUM:
+                RenderSpectrum(colors, num_colors, params, phase);
+                break;
+        }
+
+        controller->StageLEDs();
+
+        rendered_controllers.push_back(controller);
+    }
+
+    /*-----------------------------------------------------*\
+    | Release every rendered device together so effects     |
+    | that span devices stay in step                        |
+    \*-----------------------------------------------------*/
+    RGBController::CommitStagedLEDs(rendered_controllers);
+
+    EffectsMutex.unlock();
+    ControllersMutex.unlock();
+}
+
+void EffectsEngine::RenderWave(RGBColor* colors, std::size_t num_colors, EffectParameters& params, unsigned int phase)
+{
+    unsigned int    base_hue    = (phase * HUE_RANGE) >> 16;
+    unsigned int    hue_step    = (HUE_RANGE << 8) / params.wave_length;
+
+    for(std::size_t led_idx = 0; led_idx < num_colors; led_idx++)
+    {
+        unsigned int hue = (base_hue + ((led_idx * hue_step) >> 8)) % HUE_RANGE;
+
+        colors[led_idx] = HueToRGB(hue, params.brightness);
+    }
+}
+
+void EffectsEngine::RenderBreathing(RGBColor* colors, std::size_t num_colors, EffectParameters& params, unsigned int phase)
+{
+    unsigned int    scale       = (breathing_lut[phase >> 8] * params.brightness) >> 8;
+    RGBColor        color       = ScaleColor(params.color, scale);
+
+    for(std::size_t led_idx = 0; led_idx < num_colors; led_idx++)
+    {
+        colors[led_idx] = color;
+    }
+}
+
+void EffectsEngine::RenderSpectrum(RGBColor* colors, std::size_t num_colors, EffectParameters& params, unsigned int phase)
+{
+    RGBColor        color       = HueToRGB((phase * HUE_RANGE) >> 16, params.brightness);
+
+    for(std::size_t led_idx = 0; led_idx < num_colors; led_idx++)
+    {
+        colors[led_idx] = color;
+    }
+}
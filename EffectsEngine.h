@@ -0,0 +1,79 @@
+/*-----------------------------------------*\
+|  EffectsEngine.h                          |
+|                                           |
+|  Server-side lighting effects renderer    |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#pragma once
+
+#include "RGBController.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*-----------------------------------------------------*\
+| Render rate of the effects engine in frames/second    |
+\*-----------------------------------------------------*/
+#define EFFECTS_ENGINE_RATE     60
+
+enum
+{
+    ENGINE_EFFECT_NONE          = 0,    /* No effect, device is left alone                  */
+    ENGINE_EFFECT_WAVE          = 1,    /* Rainbow moving across the LEDs                   */
+    ENGINE_EFFECT_BREATHING     = 2,    /* Single color fading in and out                   */
+    ENGINE_EFFECT_SPECTRUM      = 3,    /* All LEDs cycling through the rainbow together    */
+    ENGINE_EFFECT_COUNT
+};
+
+/*-----------------------------------------------------*\
+| Effect parameters, sent as-is over the SDK            |
+\*-----------------------------------------------------*/
+typedef struct
+{
+    unsigned int    effect;                             /* ENGINE_EFFECT_* value                    */
+    unsigned int    speed;                              /* Cycles per minute                        */
+    unsigned int    brightness;                         /* Output brightness, 0-255                 */
+    RGBColor        color;                              /* Color used by the breathing effect       */
+    unsigned int    wave_length;                        /* LEDs per rainbow cycle for the wave      */
+} EffectParameters;
+
+class EffectsEngine
+{
+public:
+    EffectsEngine(std::vector<RGBController *>& control, std::mutex& control_mutex);
+    ~EffectsEngine();
+
+    /*-----------------------------------------------------*\
+    | The caller must hold the controller list lock         |
+    \*-----------------------------------------------------*/
+    void                        SetEffect(unsigned int dev_idx, EffectParameters& params);
+    EffectParameters            GetEffect(unsigned int dev_idx);
+
+    void                        Start();
+    void                        Stop();
+
+    void                        RenderThreadFunction();
+
+private:
+    std::vector<RGBController *>&   controllers;
+    std::mutex&                     ControllersMutex;
+
+    std::mutex                      EffectsMutex;
+    std::vector<EffectParameters>   effects;
+    unsigned int                    active_effects;
+
+    std::thread *                   RenderThread;
+    std::atomic<bool>               render_running;
+
+    unsigned char                   breathing_lut[256];
+
+    void                        RenderFrame(unsigned long long tick);
+
+    void                        RenderWave(RGBColor* colors, std::size_t num_colors, EffectParameters& params, unsigned int phase);
+    void                        RenderBreathing(RGBColor* colors, std::size_t num_colors, EffectParameters& params, unsigned int phase);
+    void                        RenderSpectrum(RGBColor* colors, std::size_t num_colors, EffectParameters& params, unsigned int phase);
+};
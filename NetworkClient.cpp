@@ -8,6 +8,7 @@
 
 #include "NetworkClient.h"
 #include "RGBController_Network.h"
+#include "ResourceManager.h"
 #include <cstring>
 
 #ifdef _WIN32
@@ -34,6 +35,19 @@ NetworkClient::NetworkClient(std::vector<RGBController *>& control) : controller
     client_sock             = -1;
     server_connected        = false;
     server_controller_count = 0;
+    server_protocol_version = 0;
+    server_capabilities     = 0;
+    protocol_version_received = false;
+    controller_count_received = false;
+    controller_data_received  = false;
+    controller_stats_received = false;
+    shared_memory_received    = false;
+    shared_memory_active      = false;
+    stream_received           = false;
+    stream_enabled            = false;
+    stream_active             = false;
+    stream_sequence           = 0;
+    stream_sock               = INVALID_SOCKET;
 
     ListenThread            = NULL;
     ConnectionThread        = NULL;
@@ -111,6 +125,14 @@ void NetworkClient::SetPort(unsigned short new_port)
     }
 }
 
+void NetworkClient::SetStreamEnabled(bool enabled)
+{
+    /*-------------------------------------------------*\
+    | Takes effect on the next connection               |
+    \*-------------------------------------------------*/
+    stream_enabled = enabled;
+}
+
 void NetworkClient::StartClient()
 {
     //Start a TCP server and launch threads
@@ -132,15 +154,21 @@ void NetworkClient::StartClient()
 
 void NetworkClient::StopClient()
 {
-    server_connected = false;
     client_active    = false;
 
+    /*-------------------------------------------------*\
+    | Close the socket before clearing the connected    |
+    | flag, otherwise it is never closed and the listen |
+    | thread only sees the stop after its recv timeout  |
+    \*-------------------------------------------------*/
     if (server_connected)
     {
         shutdown(client_sock, SD_RECEIVE);
         closesocket(client_sock);
     }
 
+    server_connected = false;
+
     if(ListenThread)
         ListenThread->join();
     ConnectionThread->join();
@@ -191,6 +219,8 @@ void NetworkClient::ConnectionThreadFunction()
 
         if(server_initialized == false && server_connected == true)
         {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
             requested_controllers   = 0;
             server_controller_count = 0;
 
@@ -200,41 +230,163 @@ void NetworkClient::ConnectionThreadFunction()
             //Once server is connected, send client string
             SendData_ClientString();
 
-            //Request number of controllers
+            /*-------------------------------------------------*\
+            | Ask for the protocol version and the controller   |
+            | count together.  Servers from before the version  |
+            | exchange ignore the version request, and a server |
+            | answers requests in order, so if the count comes  |
+            | back without a version reply the server is on     |
+            | version 0.  No timeout is needed to find out      |
+            \*-------------------------------------------------*/
+            {
+                std::lock_guard<std::mutex> lock(ReplyMutex);
+                protocol_version_received = false;
+                server_protocol_version   = 0;
+                server_capabilities       = 0;
+                controller_count_received = false;
+            }
+
+            SendRequest_ProtocolVersion();
             SendRequest_ControllerCount();
 
             //Wait for server controller count
-            while(server_controller_count == 0)
             {
-                std::this_thread::sleep_for(5ms);
+                std::unique_lock<std::mutex> lock(ReplyMutex);
+
+                while(!controller_count_received && server_connected)
+                {
+                    ReplyCondition.wait_for(lock, 100ms);
+                }
+            }
+
+            if(!server_connected)
+            {
+                continue;
             }
 
+            printf("Client: Server protocol version %d, capabilities 0x%08X\r\n", server_protocol_version, server_capabilities);
+
             printf("Client: Received controller count from server: %d\r\n", server_controller_count);
 
-            //Once count is received, request controllers
+            /*-------------------------------------------------*\
+            | Send all of the controller data requests at once  |
+            | rather than waiting for each reply.  The server   |
+            | answers requests in order, so replies arrive in   |
+            | device index order                                |
+            \*-------------------------------------------------*/
             while(requested_controllers < server_controller_count)
             {
-                printf("Client: Requesting controller %d\r\n", requested_controllers);
-
-                controller_data_received = false;
                 SendRequest_ControllerData(requested_controllers);
 
-                //Wait until controller is received
-                while(controller_data_received == false)
+                requested_controllers++;
+            }
+
+            //Wait until all controllers are received
+            {
+                std::unique_lock<std::mutex> lock(ReplyMutex);
+
+                while(server_controllers.size() < server_controller_count && server_connected)
                 {
-                    std::this_thread::sleep_for(5ms);
+                    ReplyCondition.wait_for(lock, 100ms);
                 }
+            }
 
-                requested_controllers++;
+            if(!server_connected)
+            {
+                continue;
+            }
+
+            printf("Client: Received %d controllers in %.1f ms\r\n", server_controller_count, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+
+            /*-------------------------------------------------*\
+            | A server on this host can hand out a shared color |
+            | region so LED updates skip the socket             |
+            \*-------------------------------------------------*/
+            if(HasServerCapability(NET_CAPABILITY_SHARED_MEMORY)
+            && NetworkSharedMemory::IsSupported()
+            && ((strcmp(port_ip, "127.0.0.1") == 0) || (strcmp(port_ip, "localhost") == 0)))
+            {
+                {
+                    std::lock_guard<std::mutex> lock(ReplyMutex);
+                    shared_memory_received = false;
+                }
+
+                SendRequest_SharedMemory();
+
+                {
+                    std::unique_lock<std::mutex> lock(ReplyMutex);
+
+                    ReplyCondition.wait_for(lock, 500ms, [this]() { return(shared_memory_received || !server_connected); });
+                }
+
+                if(shared_memory_active)
+                {
+                    printf("Client: Using shared memory region %s\r\n", shared_memory.GetName());
+                }
+            }
+
+            /*-------------------------------------------------*\
+            | Clients that would rather drop a late frame than  |
+            | wait for it can send colors over UDP.  Everything |
+            | else stays on the TCP connection                  |
+            \*-------------------------------------------------*/
+            if(stream_enabled && HasServerCapability(NET_CAPABILITY_UDP_STREAM))
+            {
+                {
+                    std::lock_guard<std::mutex> lock(ReplyMutex);
+                    stream_received             = false;
+                    stream_info.stream_token    = 0;
+                }
+
+                SendRequest_Stream();
+
+                {
+                    std::unique_lock<std::mutex> lock(ReplyMutex);
+
+                    ReplyCondition.wait_for(lock, 500ms, [this]() { return(stream_received || !server_connected); });
+                }
+
+                if(stream_info.stream_token != 0)
+                {
+                    char        stream_port_str[6];
+                    addrinfo    hints       = {};
+                    addrinfo *  stream_addr = NULL;
+
+                    snprintf(stream_port_str, 6, "%d", stream_info.stream_port);
+
+                    hints.ai_family     = AF_INET;
+                    hints.ai_socktype   = SOCK_DGRAM;
+
+                    if(getaddrinfo(port_ip, stream_port_str, &hints, &stream_addr) == 0)
+                    {
+                        stream_sock = socket(AF_INET, SOCK_DGRAM, 0);
+
+                        if((stream_sock != INVALID_SOCKET)
+                        && (connect(stream_sock, stream_addr->ai_addr, stream_addr->ai_addrlen) != SOCKET_ERROR))
+                        {
+                            stream_active = true;
+
+                            printf("Client: Streaming colors over UDP port %hu\r\n", stream_info.stream_port);
+                        }
+
+                        freeaddrinfo(stream_addr);
+                    }
+                }
             }
 
             //All controllers received, add them to master list
             printf("Client: All controllers received, adding them to master list\r\n");
+            ResourceManager::get()->GetRGBControllersMutex().lock();
+            ReplyMutex.lock();
+
             for(std::size_t controller_idx = 0; controller_idx < server_controllers.size(); controller_idx++)
             {
                 controllers.push_back(server_controllers[controller_idx]);
             }
 
+            ReplyMutex.unlock();
+            ResourceManager::get()->GetRGBControllersMutex().unlock();
+
             server_initialized = true;
 
             /*-------------------------------------------------*\
@@ -387,6 +539,10 @@ void NetworkClient::ListenThreadFunction()
         //Entire request received, select functionality based on request ID
         switch(header.pkt_id)
         {
+            case NET_PACKET_ID_REQUEST_PROTOCOL_VERSION:
+                ProcessReply_ProtocolVersion(header.pkt_size, data);
+                break;
+
             case NET_PACKET_ID_REQUEST_CONTROLLER_COUNT:
                 ProcessReply_ControllerCount(header.pkt_size, data);
                 break;
@@ -394,6 +550,18 @@ void NetworkClient::ListenThreadFunction()
             case NET_PACKET_ID_REQUEST_CONTROLLER_DATA:
                 ProcessReply_ControllerData(header.pkt_size, data, header.pkt_dev_idx);
                 break;
+
+            case NET_PACKET_ID_REQUEST_CONTROLLER_STATS:
+                ProcessReply_ControllerStats(header.pkt_size, data, header.pkt_dev_idx);
+                break;
+
+            case NET_PACKET_ID_REQUEST_SHARED_MEMORY:
+                ProcessReply_SharedMemory(header.pkt_size, data);
+                break;
+
+            case NET_PACKET_ID_REQUEST_STREAM:
+                ProcessReply_Stream(header.pkt_size, data);
+                break;
         }
 
         delete[] data;
@@ -404,21 +572,60 @@ listen_done:
     server_initialized = false;
     server_connected = false;
 
-    for(size_t server_controller_idx = 0; server_controller_idx < server_controllers.size(); server_controller_idx++)
+    /*-------------------------------------------------*\
+    | Wake up anything waiting on a reply               |
+    \*-------------------------------------------------*/
+    {
+        std::lock_guard<std::mutex> lock(ReplyMutex);
+        ReplyCondition.notify_all();
+    }
+
+    /*-------------------------------------------------*\
+    | Take the controllers out of the reply list under  |
+    | the same lock the reply handlers use              |
+    \*-------------------------------------------------*/
+    std::vector<RGBController *> closed_controllers;
+
+    {
+        std::lock_guard<std::mutex> lock(ReplyMutex);
+        closed_controllers.swap(server_controllers);
+    }
+
+    ResourceManager::get()->GetRGBControllersMutex().lock();
+
+    for(size_t server_controller_idx = 0; server_controller_idx < closed_controllers.size(); server_controller_idx++)
     {
         for(size_t controller_idx = 0; controller_idx < controllers.size(); controller_idx++)
         {
-            if(controllers[controller_idx] == server_controllers[server_controller_idx])
+            if(controllers[controller_idx] == closed_controllers[server_controller_idx])
             {
                 controllers.erase(controllers.begin() + controller_idx);
                 break;
             }
         }
+    }
+
+    ResourceManager::get()->GetRGBControllersMutex().unlock();
 
-        delete server_controllers[server_controller_idx];
+    for(size_t server_controller_idx = 0; server_controller_idx < closed_controllers.size(); server_controller_idx++)
+    {
+        delete closed_controllers[server_controller_idx];
     }
 
-    server_controllers.clear();
+    /*-------------------------------------------------*\
+    | The controllers are gone, so nothing is writing   |
+    | the shared region any more                        |
+    \*-------------------------------------------------*/
+    shared_memory_active = false;
+    shared_memory.Close();
+
+    stream_active = false;
+
+    if(stream_sock != INVALID_SOCKET)
+    {
+        closesocket(stream_sock);
+        stream_sock = INVALID_SOCKET;
+    }
 
     /*-------------------------------------------------*\
     | Client info has changed, call the callbacks       |
@@ -428,31 +635,75 @@ listen_done:
 
 void NetworkClient::WaitOnControllerData()
 {
-    for(int i = 0; i < 1000; i++)
+    std::unique_lock<std::mutex> lock(ReplyMutex);
+
+    ReplyCondition.wait_for(lock, 1s, [this]() { return(controller_data_received || !server_connected); });
+
+    return;
+}
+
+void NetworkClient::WaitOnControllerStats()
+{
+    std::unique_lock<std::mutex> lock(ReplyMutex);
+
+    ReplyCondition.wait_for(lock, 1s, [this]() { return(controller_stats_received || !server_connected); });
+
+    return;
+}
+
+unsigned int NetworkClient::GetProtocolVersion()
+{
+    return(server_protocol_version);
+}
+
+bool NetworkClient::HasServerCapability(unsigned int capability)
+{
+    return((server_capabilities & capability) == capability);
+}
+
+void NetworkClient::ProcessReply_ProtocolVersion(unsigned int data_size, char * data)
+{
+    std::lock_guard<std::mutex> lock(ReplyMutex);
+
+    if((data != NULL) && (data_size >= sizeof(NetProtocolVersion)))
     {
-        if(controller_data_received)
-        {
-            break;
-        }
-        std::this_thread::sleep_for(1ms);
+        NetProtocolVersion reply;
+
+        memcpy(&reply, data, sizeof(NetProtocolVersion));
+
+        server_protocol_version = (reply.protocol_version < OPENRGB_SDK_PROTOCOL_VERSION) ? reply.protocol_version : OPENRGB_SDK_PROTOCOL_VERSION;
+        server_capabilities     = reply.capabilities & OPENRGB_SDK_CAPABILITIES;
     }
 
-    return;
+    protocol_version_received = true;
+    ReplyCondition.notify_all();
 }
 
 void NetworkClient::ProcessReply_ControllerCount(unsigned int data_size, char * data)
 {
+    std::lock_guard<std::mutex> lock(ReplyMutex);
+
     if(data_size == sizeof(unsigned int))
     {
         memcpy(&server_controller_count, data, sizeof(unsigned int));
     }
+
+    controller_count_received = true;
+    ReplyCondition.notify_all();
 }
 
-void NetworkClient::ProcessReply_ControllerData(unsigned int /*data_size*/, char * data, unsigned int dev_idx)
+void NetworkClient::ProcessReply_ControllerData(unsigned int data_size, char * data, unsigned int dev_idx)
 {
     RGBController_Network * new_controller = new RGBController_Network(this, dev_idx);
 
-    new_controller->ReadDeviceDescription((unsigned char *)data);
+    /*---------------------------------------------------------*\
+    | A malformed description leaves the controller empty.  It  |
+    | is still added so device indices stay in step with the    |
+    | server                                                    |
+    \*---------------------------------------------------------*/
+    new_controller->ReadDeviceDescription((unsigned char *)data, data_size);
+
+    std::lock_guard<std::mutex> lock(ReplyMutex);
 
     if(dev_idx >= server_controllers.size())
     {
@@ -465,6 +716,57 @@ void NetworkClient::ProcessReply_ControllerData(unsigned int /*data_size*/, char
     }
 
     controller_data_received = true;
+    ReplyCondition.notify_all();
+}
+
+void NetworkClient::ProcessReply_ControllerStats(unsigned int data_size, char * data, unsigned int dev_idx)
+{
+    std::lock_guard<std::mutex> lock(ReplyMutex);
+
+    if((data != NULL) && (dev_idx < server_controllers.size()))
+    {
+        RGBControllerStatsSnapshot stats;
+
+        if(RGBControllerStats::ReadDescription((unsigned char *)data, data_size, &stats))
+        {
+            ((RGBController_Network *)server_controllers[dev_idx])->SetRemoteStats(stats);
+        }
+    }
+
+    controller_stats_received = true;
+    ReplyCondition.notify_all();
+}
+
+void NetworkClient::ProcessReply_SharedMemory(unsigned int data_size, char * data)
+{
+    std::lock_guard<std::mutex> lock(ReplyMutex);
+
+    /*-------------------------------------------------*\
+    | An empty name means the server declined           |
+    \*-------------------------------------------------*/
+    if((data != NULL) && (data_size > 1) && (data[data_size - 1] == '\0'))
+    {
+        if(shared_memory.Open(data))
+        {
+            shared_memory_active = true;
+        }
+    }
+
+    shared_memory_received = true;
+    ReplyCondition.notify_all();
+}
+
+void NetworkClient::ProcessReply_Stream(unsigned int data_size, char * data)
+{
+    std::lock_guard<std::mutex> lock(ReplyMutex);
+
+    if((data != NULL) && (data_size == sizeof(NetStreamInfo)))
+    {
+        memcpy(&stream_info, data, sizeof(NetStreamInfo));
+    }
+
+    stream_received = true;
+    ReplyCondition.notify_all();
 }
 
 void NetworkClient::SendData_ClientString()
@@ -480,8 +782,27 @@ void NetworkClient::SendData_ClientString()
     reply_hdr.pkt_id       = NET_PACKET_ID_SET_CLIENT_NAME;
     reply_hdr.pkt_size     = strlen(client_name.c_str()) + 1;
 
-    send(client_sock, (char *)&reply_hdr, sizeof(NetPacketHeader), MSG_NOSIGNAL);
-    send(client_sock, (char *)client_name.c_str(), reply_hdr.pkt_size, MSG_NOSIGNAL);
+    SendPacket(&reply_hdr, (char *)client_name.c_str(), reply_hdr.pkt_size);
+}
+
+void NetworkClient::SendRequest_ProtocolVersion()
+{
+    NetPacketHeader     reply_hdr;
+    NetProtocolVersion  request_data;
+
+    reply_hdr.pkt_magic[0] = 'O';
+    reply_hdr.pkt_magic[1] = 'R';
+    reply_hdr.pkt_magic[2] = 'G';
+    reply_hdr.pkt_magic[3] = 'B';
+
+    reply_hdr.pkt_dev_idx  = 0;
+    reply_hdr.pkt_id       = NET_PACKET_ID_REQUEST_PROTOCOL_VERSION;
+    reply_hdr.pkt_size     = sizeof(NetProtocolVersion);
+
+    request_data.protocol_version   = OPENRGB_SDK_PROTOCOL_VERSION;
+    request_data.capabilities       = OPENRGB_SDK_CAPABILITIES;
+
+    SendPacket(&reply_hdr, (char *)&request_data, sizeof(NetProtocolVersion));
 }
 
 void NetworkClient::SendRequest_ControllerCount()
@@ -497,14 +818,17 @@ void NetworkClient::SendRequest_ControllerCount()
     reply_hdr.pkt_id       = NET_PACKET_ID_REQUEST_CONTROLLER_COUNT;
     reply_hdr.pkt_size     = 0;
 
-    send(client_sock, (char *)&reply_hdr, sizeof(NetPacketHeader), MSG_NOSIGNAL);
+    SendPacket(&reply_hdr, NULL, 0);
 }
 
 void NetworkClient::SendRequest_ControllerData(unsigned int dev_idx)
 {
     NetPacketHeader reply_hdr;
 
-    controller_data_received = false;
+    {
+        std::lock_guard<std::mutex> lock(ReplyMutex);
+        controller_data_received = false;
+    }
 
     reply_hdr.pkt_magic[0] = 'O';
     reply_hdr.pkt_magic[1] = 'R';
@@ -515,7 +839,60 @@ void NetworkClient::SendRequest_ControllerData(unsigned int dev_idx)
     reply_hdr.pkt_id       = NET_PACKET_ID_REQUEST_CONTROLLER_DATA;
     reply_hdr.pkt_size     = 0;
 
-    send(client_sock, (char *)&reply_hdr, sizeof(NetPacketHeader), MSG_NOSIGNAL);
+    SendPacket(&reply_hdr, NULL, 0);
+}
+
+void NetworkClient::SendRequest_ControllerStats(unsigned int dev_idx)
+{
+    NetPacketHeader reply_hdr;
+
+    {
+        std::lock_guard<std::mutex> lock(ReplyMutex);
+        controller_stats_received = false;
+    }
+
+    reply_hdr.pkt_magic[0] = 'O';
+    reply_hdr.pkt_magic[1] = 'R';
+    reply_hdr.pkt_magic[2] = 'G';
+    reply_hdr.pkt_magic[3] = 'B';
+
+    reply_hdr.pkt_dev_idx  = dev_idx;
+    reply_hdr.pkt_id       = NET_PACKET_ID_REQUEST_CONTROLLER_STATS;
+    reply_hdr.pkt_size     = 0;
+
+    SendPacket(&reply_hdr, NULL, 0);
+}
+
+void NetworkClient::SendRequest_SharedMemory()
+{
+    NetPacketHeader reply_hdr;
+
+    reply_hdr.pkt_magic[0] = 'O';
+    reply_hdr.pkt_magic[1] = 'R';
+    reply_hdr.pkt_magic[2] = 'G';
+    reply_hdr.pkt_magic[3] = 'B';
+
+    reply_hdr.pkt_dev_idx  = 0;
+    reply_hdr.pkt_id       = NET_PACKET_ID_REQUEST_SHARED_MEMORY;
+    reply_hdr.pkt_size     = 0;
+
+    SendPacket(&reply_hdr, NULL, 0);
+}
+
+void NetworkClient::SendRequest_Stream()
+{
+    NetPacketHeader reply_hdr;
+
+    reply_hdr.pkt_magic[0] = 'O';
+    reply_hdr.pkt_magic[1] = 'R';
+    reply_hdr.pkt_magic[2] = 'G';
+    reply_hdr.pkt_magic[3] = 'B';
+
+    reply_hdr.pkt_dev_idx  = 0;
+    reply_hdr.pkt_id       = NET_PACKET_ID_REQUEST_STREAM;
+    reply_hdr.pkt_size     = 0;
+
+    SendPacket(&reply_hdr, NULL, 0);
 }
 
 void NetworkClient::SendRequest_RGBController_ResizeZone(unsigned int dev_idx, int zone, int new_size)
@@ -535,8 +912,7 @@ void NetworkClient::SendRequest_RGBController_ResizeZone(unsigned int dev_idx, i
     reply_data[0]          = zone;
     reply_data[1]          = new_size;
 
-    send(client_sock, (char *)&reply_hdr, sizeof(NetPacketHeader), MSG_NOSIGNAL);
-    send(client_sock, (char *)&reply_data, sizeof(reply_data), MSG_NOSIGNAL);
+    SendPacket(&reply_hdr, (char *)&reply_data, sizeof(reply_data));
 }
 
 void NetworkClient::SendRequest_RGBController_UpdateLEDs(unsigned int dev_idx, unsigned char * data, unsigned int size)
@@ -552,8 +928,7 @@ void NetworkClient::SendRequest_RGBController_UpdateLEDs(unsigned int dev_idx, u
     reply_hdr.pkt_id       = NET_PACKET_ID_RGBCONTROLLER_UPDATELEDS;
     reply_hdr.pkt_size     = size;
 
-    send(client_sock, (char *)&reply_hdr, sizeof(NetPacketHeader), MSG_NOSIGNAL);
-    send(client_sock, (char *)data, size, 0);
+    SendPacket(&reply_hdr, (char *)data, size);
 }
 
 void NetworkClient::SendRequest_RGBController_UpdateZoneLEDs(unsigned int dev_idx, unsigned char * data, unsigned int size)
@@ -569,8 +944,7 @@ void NetworkClient::SendRequest_RGBController_UpdateZoneLEDs(unsigned int dev_id
     reply_hdr.pkt_id       = NET_PACKET_ID_RGBCONTROLLER_UPDATEZONELEDS;
     reply_hdr.pkt_size     = size;
 
-    send(client_sock, (char *)&reply_hdr, sizeof(NetPacketHeader), MSG_NOSIGNAL);
-    send(client_sock, (char *)data, size, MSG_NOSIGNAL);
+    SendPacket(&reply_hdr, (char *)data, size);
 }
 
 void NetworkClient::SendRequest_RGBController_UpdateSingleLED(unsigned int dev_idx, unsigned char * data, unsigned int size)
@@ -586,8 +960,131 @@ void NetworkClient::SendRequest_RGBController_UpdateSingleLED(unsigned int dev_i
     reply_hdr.pkt_id       = NET_PACKET_ID_RGBCONTROLLER_UPDATESINGLELED;
     reply_hdr.pkt_size     = size;
 
-    send(client_sock, (char *)&reply_hdr, sizeof(NetPacketHeader), MSG_NOSIGNAL);
-    send(client_sock, (char *)data, size, MSG_NOSIGNAL);
+    SendPacket(&reply_hdr, (char *)data, size);
+}
+
+void NetworkClient::SendRequest_RGBController_StageLEDs(unsigned int dev_idx, unsigned char * data, unsigned int size)
+{
+    /*-------------------------------------------------*\
+    | Servers without frame commit get a plain update   |
+    \*-------------------------------------------------*/
+    if(!HasServerCapability(NET_CAPABILITY_FRAME_COMMIT))
+    {
+        SendRequest_RGBController_UpdateLEDs(dev_idx, data, size);
+        return;
+    }
+
+    NetPacketHeader reply_hdr;
+
+    reply_hdr.pkt_magic[0] = 'O';
+    reply_hdr.pkt_magic[1] = 'R';
+    reply_hdr.pkt_magic[2] = 'G';
+    reply_hdr.pkt_magic[3] = 'B';
+
+    reply_hdr.pkt_dev_idx  = dev_idx;
+    reply_hdr.pkt_id       = NET_PACKET_ID_RGBCONTROLLER_STAGELEDS;
+    reply_hdr.pkt_size     = size;
+
+    SendPacket(&reply_hdr, (char *)data, size);
+}
+
+void NetworkClient::SendRequest_CommitFrame()
+{
+    if(!HasServerCapability(NET_CAPABILITY_FRAME_COMMIT))
+    {
+        return;
+    }
+
+    NetPacketHeader reply_hdr;
+
+    reply_hdr.pkt_magic[0] = 'O';
+    reply_hdr.pkt_magic[1] = 'R';
+    reply_hdr.pkt_magic[2] = 'G';
+    reply_hdr.pkt_magic[3] = 'B';
+
+    reply_hdr.pkt_dev_idx  = 0;
+    reply_hdr.pkt_id       = NET_PACKET_ID_COMMIT_FRAME;
+    reply_hdr.pkt_size     = 0;
+
+    SendPacket(&reply_hdr, NULL, 0);
+}
+
+void NetworkClient::SendRequest_UpdateLEDsBatch(std::vector<unsigned int>& dev_idxs, std::vector<unsigned char *>& color_descriptions)
+{
+    /*-------------------------------------------------*\
+    | Servers without batch support get one update per  |
+    | device                                            |
+    \*-------------------------------------------------*/
+    if(!HasServerCapability(NET_CAPABILITY_BATCH_UPDATE))
+    {
+        for(std::size_t device_idx = 0; device_idx < dev_idxs.size(); device_idx++)
+        {
+            unsigned int size;
+
+            memcpy(&size, color_descriptions[device_idx], sizeof(unsigned int));
+
+            SendRequest_RGBController_UpdateLEDs(dev_idxs[device_idx], color_descriptions[device_idx], size);
+        }
+        return;
+    }
+
+    /*-------------------------------------------------*\
+    | Calculate data size                               |
+    \*-------------------------------------------------*/
+    unsigned int    data_size   = 0;
+    unsigned int    data_ptr    = 0;
+    unsigned short  num_devices = dev_idxs.size();
+
+    data_size += sizeof(data_size);
+    data_size += sizeof(num_devices);
+
+    for(std::size_t device_idx = 0; device_idx < num_devices; device_idx++)
+    {
+        unsigned int size;
+
+        memcpy(&size, color_descriptions[device_idx], sizeof(unsigned int));
+
+        data_size += sizeof(unsigned int) + size;
+    }
+
+    /*-------------------------------------------------*\
+    | Build the batch description                       |
+    \*-------------------------------------------------*/
+    unsigned char * data_buf = new unsigned char[data_size];
+
+    memcpy(&data_buf[data_ptr], &data_size, sizeof(data_size));
+    data_ptr += sizeof(data_size);
+
+    memcpy(&data_buf[data_ptr], &num_devices, sizeof(num_devices));
+    data_ptr += sizeof(num_devices);
+
+    for(std::size_t device_idx = 0; device_idx < num_devices; device_idx++)
+    {
+        unsigned int size;
+
+        memcpy(&size, color_descriptions[device_idx], sizeof(unsigned int));
+
+        memcpy(&data_buf[data_ptr], &dev_idxs[device_idx], sizeof(unsigned int));
+        data_ptr += sizeof(unsigned int);
+
+        memcpy(&data_buf[data_ptr], color_descriptions[device_idx], size);
+        data_ptr += size;
+    }
+
+    NetPacketHeader reply_hdr;
+
+    reply_hdr.pkt_magic[0] = 'O';
+    reply_hdr.pkt_magic[1] = 'R';
+    reply_hdr.pkt_magic[2] = 'G';
+    reply_hdr.pkt_magic[3] = 'B';
+
+    reply_hdr.pkt_dev_idx  = 0;
+    reply_hdr.pkt_id       = NET_PACKET_ID_UPDATELEDS_BATCH;
+    reply_hdr.pkt_size     = data_size;
+
+    SendPacket(&reply_hdr, (char *)data_buf, data_size);
+
+    delete[] data_buf;
 }
 
 void NetworkClient::SendRequest_RGBController_SetCustomMode(unsigned int dev_idx)
@@ -603,7 +1100,7 @@ void NetworkClient::SendRequest_RGBController_SetCustomMode(unsigned int dev_idx
     reply_hdr.pkt_id       = NET_PACKET_ID_RGBCONTROLLER_SETCUSTOMMODE;
     reply_hdr.pkt_size     = 0;
 
-    send(client_sock, (char *)&reply_hdr, sizeof(NetPacketHeader), MSG_NOSIGNAL);
+    SendPacket(&reply_hdr, NULL, 0);
 }
 
 void NetworkClient::SendRequest_RGBController_UpdateMode(unsigned int dev_idx, unsigned char * data, unsigned int size)
@@ -619,6 +1116,142 @@ void NetworkClient::SendRequest_RGBController_UpdateMode(unsigned int dev_idx, u
     reply_hdr.pkt_id       = NET_PACKET_ID_RGBCONTROLLER_UPDATEMODE;
     reply_hdr.pkt_size     = size;
 
-    send(client_sock, (char *)&reply_hdr, sizeof(NetPacketHeader), MSG_NOSIGNAL);
-    send(client_sock, (char *)data, size, MSG_NOSIGNAL);
+    SendPacket(&reply_hdr, (char *)data, size);
+}
+
+void NetworkClient::SendRequest_RGBController_SetOutputStage(unsigned int dev_idx, RGBOutputStageParams& params)
+{
+    if(!HasServerCapability(NET_CAPABILITY_OUTPUT_STAGE))
+    {
+        return;
+    }
+
+    NetPacketHeader reply_hdr;
+
+    reply_hdr.pkt_magic[0] = 'O';
+    reply_hdr.pkt_magic[1] = 'R';
+    reply_hdr.pkt_magic[2] = 'G';
+    reply_hdr.pkt_magic[3] = 'B';
+
+    reply_hdr.pkt_dev_idx  = dev_idx;
+    reply_hdr.pkt_id       = NET_PACKET_ID_RGBCONTROLLER_SETOUTPUTSTAGE;
+    reply_hdr.pkt_size     = sizeof(RGBOutputStageParams);
+
+    SendPacket(&reply_hdr, (char *)&params, sizeof(RGBOutputStageParams));
+}
+
+void NetworkClient::SendRequest_SetGlobalBrightness(unsigned int brightness)
+{
+    if(!HasServerCapability(NET_CAPABILITY_OUTPUT_STAGE))
+    {
+        return;
+    }
+
+    NetPacketHeader reply_hdr;
+
+    reply_hdr.pkt_magic[0] = 'O';
+    reply_hdr.pkt_magic[1] = 'R';
+    reply_hdr.pkt_magic[2] = 'G';
+    reply_hdr.pkt_magic[3] = 'B';
+
+    reply_hdr.pkt_dev_idx  = 0;
+    reply_hdr.pkt_id       = NET_PACKET_ID_SET_GLOBAL_BRIGHTNESS;
+    reply_hdr.pkt_size     = sizeof(unsigned int);
+
+    SendPacket(&reply_hdr, (char *)&brightness, sizeof(unsigned int));
+}
+
+void NetworkClient::SendRequest_Effects_SetEffect(unsigned int dev_idx, EffectParameters& params)
+{
+    if(!HasServerCapability(NET_CAPABILITY_EFFECTS))
+    {
+        return;
+    }
+
+    NetPacketHeader reply_hdr;
+
+    reply_hdr.pkt_magic[0] = 'O';
+    reply_hdr.pkt_magic[1] = 'R';
+    reply_hdr.pkt_magic[2] = 'G';
+    reply_hdr.pkt_magic[3] = 'B';
+
+    reply_hdr.pkt_dev_idx  = dev_idx;
+    reply_hdr.pkt_id       = NET_PACKET_ID_EFFECTS_SETEFFECT;
+    reply_hdr.pkt_size     = sizeof(EffectParameters);
+
+    SendPacket(&reply_hdr, (char *)&params, sizeof(EffectParameters));
+}
+
+bool NetworkClient::SharedMemory_UpdateLEDs(unsigned int dev_idx, const RGBColor * colors, unsigned int num_colors)
+{
+    /*-------------------------------------------------*\
+    | Fall back to the socket if there is no region or  |
+    | the device no longer matches its slot             |
+    \*-------------------------------------------------*/
+    if(!shared_memory_active.load())
+    {
+        return(false);
+    }
+
+    if(!shared_memory.WriteColors(dev_idx, colors, num_colors))
+    {
+        return(false);
+    }
+
+    shared_memory.Ring();
+
+    return(true);
+}
+
+bool NetworkClient::SendStream_UpdateLEDs(unsigned int dev_idx, unsigned char * data, unsigned int size)
+{
+    if(!stream_active.load() || ((sizeof(NetStreamHeader) + size) > 65507))
+    {
+        return(false);
+    }
+
+    /*-------------------------------------------------*\
+    | One datagram per update, header then colors       |
+    \*-------------------------------------------------*/
+    std::vector<char> datagram(sizeof(NetStreamHeader) + size);
+
+    NetStreamHeader stream_hdr;
+
+    stream_hdr.pkt_magic[0] = 'O';
+    stream_hdr.pkt_magic[1] = 'R';
+    stream_hdr.pkt_magic[2] = 'G';
+    stream_hdr.pkt_magic[3] = 'S';
+
+    stream_hdr.stream_token = stream_info.stream_token;
+    stream_hdr.pkt_dev_idx  = dev_idx;
+    stream_hdr.sequence     = ++stream_sequence;
+
+    memcpy(&datagram[0], &stream_hdr, sizeof(NetStreamHeader));
+    memcpy(&datagram[sizeof(NetStreamHeader)], data, size);
+
+    /*-------------------------------------------------*\
+    | A lost datagram is fine, the next frame replaces  |
+    | it                                                |
+    \*-------------------------------------------------*/
+    send(stream_sock, &datagram[0], datagram.size(), MSG_NOSIGNAL);
+
+    return(true);
+}
+
+void NetworkClient::SendPacket(NetPacketHeader * header, const char * data, unsigned int size)
+{
+    /*-------------------------------------------------*\
+    | Device threads send at the same time, keep each   |
+    | packet in one piece                               |
+    \*-------------------------------------------------*/
+    std::lock_guard<std::mutex> lock(SendMutex);
+
+    if(!net_send_packet(client_sock, (const char *)header, sizeof(NetPacketHeader), data, size))
+    {
+        /*-------------------------------------------------*\
+        | The connection is broken, let the listen thread   |
+        | notice and reconnect                              |
+        \*-------------------------------------------------*/
+        shutdown(client_sock, SD_RECEIVE);
+    }
 }
@@ -7,9 +7,13 @@
 \*-----------------------------------------*/
 
 #include "RGBController.h"
+#include "EffectsEngine.h"
 #include "NetworkProtocol.h"
+#include "NetworkSharedMemory.h"
 #include "net_port.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <thread>
 
@@ -35,6 +39,7 @@ public:
     void            SetIP(const char *new_ip);
     void            SetName(const char *new_name);
     void            SetPort(unsigned short new_port);
+    void            SetStreamEnabled(bool enabled);
 
     void            StartClient();
     void            StopClient();
@@ -43,25 +48,48 @@ public:
     void            ListenThreadFunction();
 
     void            WaitOnControllerData();
+    void            WaitOnControllerStats();
+
+    unsigned int    GetProtocolVersion();
+    bool            HasServerCapability(unsigned int capability);
     
+    void        ProcessReply_ProtocolVersion(unsigned int data_size, char * data);
     void        ProcessReply_ControllerCount(unsigned int data_size, char * data);
     void        ProcessReply_ControllerData(unsigned int data_size, char * data, unsigned int dev_idx);
+    void        ProcessReply_ControllerStats(unsigned int data_size, char * data, unsigned int dev_idx);
+    void        ProcessReply_SharedMemory(unsigned int data_size, char * data);
+    void        ProcessReply_Stream(unsigned int data_size, char * data);
     
     void        SendData_ClientString();
 
+    void        SendRequest_ProtocolVersion();
     void        SendRequest_ControllerCount();
     void        SendRequest_ControllerData(unsigned int dev_idx);
+    void        SendRequest_ControllerStats(unsigned int dev_idx);
+    void        SendRequest_SharedMemory();
+    void        SendRequest_Stream();
 
     void        SendRequest_RGBController_ResizeZone(unsigned int dev_idx, int zone, int new_size);
 
     void        SendRequest_RGBController_UpdateLEDs(unsigned int dev_idx, unsigned char * data, unsigned int size);
     void        SendRequest_RGBController_UpdateZoneLEDs(unsigned int dev_idx, unsigned char * data, unsigned int size);
     void        SendRequest_RGBController_UpdateSingleLED(unsigned int dev_idx, unsigned char * data, unsigned int size);
+    void        SendRequest_RGBController_StageLEDs(unsigned int dev_idx, unsigned char * data, unsigned int size);
+    void        SendRequest_CommitFrame();
+    void        SendRequest_UpdateLEDsBatch(std::vector<unsigned int>& dev_idxs, std::vector<unsigned char *>& color_descriptions);
 
     void        SendRequest_RGBController_SetCustomMode(unsigned int dev_idx);
 
     void        SendRequest_RGBController_UpdateMode(unsigned int dev_idx, unsigned char * data, unsigned int size);
 
+    void        SendRequest_RGBController_SetOutputStage(unsigned int dev_idx, RGBOutputStageParams& params);
+    void        SendRequest_SetGlobalBrightness(unsigned int brightness);
+
+    void        SendRequest_Effects_SetEffect(unsigned int dev_idx, EffectParameters& params);
+
+    bool        SharedMemory_UpdateLEDs(unsigned int dev_idx, const RGBColor * colors, unsigned int num_colors);
+    bool        SendStream_UpdateLEDs(unsigned int dev_idx, unsigned char * data, unsigned int size);
+
     std::vector<RGBController *>  server_controllers;
 
 protected:
@@ -75,17 +103,40 @@ private:
     char            port_ip[20];
     unsigned short  port_num;
     bool            client_active;
+    bool            protocol_version_received;
+    bool            controller_count_received;
     bool            controller_data_received;
+    bool            controller_stats_received;
+    bool            shared_memory_received;
+    bool            stream_received;
+    bool            stream_enabled;
     bool            server_connected;
     bool            server_initialized;
     unsigned int    server_controller_count;
+    unsigned int    server_protocol_version;
+    unsigned int    server_capabilities;
+
+    NetworkSharedMemory shared_memory;
+    std::atomic<bool>   shared_memory_active;
+
+    SOCKET                      stream_sock;
+    NetStreamInfo               stream_info;
+    std::atomic<bool>           stream_active;
+    std::atomic<unsigned int>   stream_sequence;
 
     std::thread *   ConnectionThread;
     std::thread *   ListenThread;
 
+    std::mutex                          ReplyMutex;
+    std::condition_variable             ReplyCondition;
+
     std::mutex                          ClientInfoChangeMutex;
     std::vector<NetClientCallback>      ClientInfoChangeCallbacks;
     std::vector<void *>                 ClientInfoChangeCallbackArgs;
 
+    std::mutex                          SendMutex;
+
     int recv_select(SOCKET s, char *buf, int len, int flags);
+
+    void SendPacket(NetPacketHeader * header, const char * data, unsigned int size);
 };
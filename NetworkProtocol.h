@@ -14,6 +14,38 @@
 \*-----------------------------------------*/
 #define OPENRGB_SDK_PORT 6742
 
+/*-----------------------------------------*\
+| SDK protocol version.  A peer that never  |
+| requests the protocol version is treated  |
+| as version 0 with no capabilities         |
+\*-----------------------------------------*/
+#define OPENRGB_SDK_PROTOCOL_VERSION 1
+
+/*------------------------------------------------------------------*\
+| Capability flags, exchanged with the protocol version.  Packets    |
+| covered by a flag are only sent to peers that reported it          |
+\*------------------------------------------------------------------*/
+enum
+{
+    NET_CAPABILITY_CONTROLLER_STATS     = (1 << 0), /* REQUEST_CONTROLLER_STATS         */
+    NET_CAPABILITY_OUTPUT_STAGE         = (1 << 1), /* SETOUTPUTSTAGE, brightness       */
+    NET_CAPABILITY_FRAME_COMMIT         = (1 << 2), /* STAGELEDS and COMMIT_FRAME       */
+    NET_CAPABILITY_EFFECTS              = (1 << 3), /* Server-side effects engine       */
+    NET_CAPABILITY_BATCH_UPDATE         = (1 << 4), /* UPDATELEDS_BATCH                 */
+    NET_CAPABILITY_SHARED_MEMORY        = (1 << 5), /* Shared color region, same host   */
+    NET_CAPABILITY_UDP_STREAM           = (1 << 6), /* UDP color stream                 */
+    NET_CAPABILITY_COMPACT_DESCRIPTION  = (1 << 7), /* Compact controller data          */
+};
+
+#define OPENRGB_SDK_CAPABILITIES        ( NET_CAPABILITY_CONTROLLER_STATS   \
+                                        | NET_CAPABILITY_OUTPUT_STAGE       \
+                                        | NET_CAPABILITY_FRAME_COMMIT       \
+                                        | NET_CAPABILITY_EFFECTS            \
+                                        | NET_CAPABILITY_BATCH_UPDATE       \
+                                        | NET_CAPABILITY_SHARED_MEMORY      \
+                                        | NET_CAPABILITY_UDP_STREAM         \
+                                        | NET_CAPABILITY_COMPACT_DESCRIPTION)
+
 typedef struct NetPacketHeader
 {
     char                pkt_magic[4];               /* Magic value "ORGB" identifies beginning of packet    */
@@ -22,6 +54,42 @@ typedef struct NetPacketHeader
     unsigned int        pkt_size;                   /* Packet size                                          */
 } NetPacketHeader;
 
+/*---------------------------------------------------------*\
+| Payload of NET_PACKET_ID_REQUEST_PROTOCOL_VERSION in both |
+| directions.  The reply carries the server's version and   |
+| the capabilities both sides support                       |
+\*---------------------------------------------------------*/
+typedef struct NetProtocolVersion
+{
+    unsigned int        protocol_version;           /* Highest protocol version supported by the sender     */
+    unsigned int        capabilities;               /* NET_CAPABILITY flags                                 */
+} NetProtocolVersion;
+
+/*---------------------------------------------------------*\
+| Reply to NET_PACKET_ID_REQUEST_STREAM.  A zero token      |
+| means the server declined                                 |
+\*---------------------------------------------------------*/
+typedef struct NetStreamInfo
+{
+    unsigned int        stream_token;               /* Identifies this client's datagrams                   */
+    unsigned short      stream_port;                /* UDP port to send datagrams to                        */
+    unsigned short      reserved;
+} NetStreamInfo;
+
+/*---------------------------------------------------------*\
+| Header of each UDP stream datagram, followed by a color   |
+| description as sent with UPDATELEDS.  Datagrams with a    |
+| sequence no newer than the last one applied to the same   |
+| device are dropped                                        |
+\*---------------------------------------------------------*/
+typedef struct NetStreamHeader
+{
+    char                pkt_magic[4];               /* Magic value "ORGS" identifies a stream datagram      */
+    unsigned int        stream_token;               /* Token from NET_PACKET_ID_REQUEST_STREAM              */
+    unsigned int        pkt_dev_idx;                /* Device index                                         */
+    unsigned int        sequence;                   /* Increases with every datagram the client sends       */
+} NetStreamHeader;
+
 enum
 {
     /*----------------------------------------------------------------------------------------------------------*\
@@ -29,7 +97,14 @@ enum
     \*----------------------------------------------------------------------------------------------------------*/
     NET_PACKET_ID_REQUEST_CONTROLLER_COUNT      = 0,    /* Request RGBController device count from server       */
     NET_PACKET_ID_REQUEST_CONTROLLER_DATA       = 1,    /* Request RGBController data block                     */
+    NET_PACKET_ID_REQUEST_CONTROLLER_STATS      = 2,    /* Request RGBController timing statistics              */
+    NET_PACKET_ID_REQUEST_PROTOCOL_VERSION      = 40,   /* Exchange protocol version and capabilities           */
+    NET_PACKET_ID_REQUEST_SHARED_MEMORY         = 41,   /* Request a shared color region name, same host only   */
+    NET_PACKET_ID_REQUEST_STREAM                = 42,   /* Request a token for the UDP color stream             */
     NET_PACKET_ID_SET_CLIENT_NAME               = 50,   /* Send client name string to server                    */
+    NET_PACKET_ID_SET_GLOBAL_BRIGHTNESS         = 51,   /* Set brightness applied to all devices, 0-255         */
+    NET_PACKET_ID_COMMIT_FRAME                  = 52,   /* Send all staged frames at once                       */
+    NET_PACKET_ID_UPDATELEDS_BATCH              = 53,   /* UpdateLEDs() on many devices, sent together          */
 
     /*----------------------------------------------------------------------------------------------------------*\
     | RGBController class functions                                                                              |
@@ -39,7 +114,15 @@ enum
     NET_PACKET_ID_RGBCONTROLLER_UPDATELEDS      = 1050, /* RGBController::UpdateLEDs()                          */
     NET_PACKET_ID_RGBCONTROLLER_UPDATEZONELEDS  = 1051, /* RGBController::UpdateZoneLEDs()                      */
     NET_PACKET_ID_RGBCONTROLLER_UPDATESINGLELED = 1052, /* RGBController::UpdateSingleLED()                     */
+    NET_PACKET_ID_RGBCONTROLLER_STAGELEDS       = 1053, /* RGBController::StageLEDs()                           */
 
     NET_PACKET_ID_RGBCONTROLLER_SETCUSTOMMODE   = 1100, /* RGBController::SetCustomMode()                       */
     NET_PACKET_ID_RGBCONTROLLER_UPDATEMODE      = 1101, /* RGBController::UpdateMode()                          */
+
+    NET_PACKET_ID_RGBCONTROLLER_SETOUTPUTSTAGE  = 1150, /* RGBController::SetOutputStage()                      */
+
+    /*----------------------------------------------------------------------------------------------------------*\
+    | Effects engine functions                                                                                   |
+    \*----------------------------------------------------------------------------------------------------------*/
+    NET_PACKET_ID_EFFECTS_SETEFFECT             = 2000, /* EffectsEngine::SetEffect()                           */
 };
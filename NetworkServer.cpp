@@ -7,6 +7,7 @@
 \*-----------------------------------------*/
 
 #include "NetworkServer.h"
+#include <algorithm>
 #include <cstring>
 
 #ifndef WIN32
@@ -21,8 +22,9 @@
 #include <errno.h>
 #include <stdlib.h>
 #include <iostream>
+#include <random>
 
-const char yes = 1;
+const int yes = 1;
 
 #ifdef WIN32
 #include <Windows.h>
@@ -33,10 +35,13 @@ const char yes = 1;
 using namespace std::chrono_literals;
 
 
-NetworkServer::NetworkServer(std::vector<RGBController *>& control) : controllers(control)
+NetworkServer::NetworkServer(std::vector<RGBController *>& control, std::mutex& control_mutex) : controllers(control), ControllersMutex(control_mutex)
 {
     port_num      = OPENRGB_SDK_PORT;
     server_online = false;
+    effects       = NULL;
+    stream_sock   = INVALID_SOCKET;
+    StreamThread  = NULL;
 }
 
 void NetworkServer::ClientInfoChanged()
@@ -123,6 +128,11 @@ void NetworkServer::SetPort(unsigned short new_port)
     }
 }
 
+void NetworkServer::SetEffectsEngine(EffectsEngine * effects_ptr)
+{
+    effects = effects_ptr;
+}
+
 void NetworkServer::StartServer()
 {
     //Start a TCP server and launch threads
@@ -173,7 +183,7 @@ void NetworkServer::StartServer()
     /*-------------------------------------------------*\
     | Set socket options - no delay                     |
     \*-------------------------------------------------*/
-    setsockopt(server_sock, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+    setsockopt(server_sock, IPPROTO_TCP, TCP_NODELAY, (const char *)&yes, sizeof(yes));
 
     server_online = true;
 
@@ -182,17 +192,64 @@ void NetworkServer::StartServer()
     \*-------------------------------------------------*/
     ConnectionThread = new std::thread(&NetworkServer::ConnectionThreadFunction, this);
     ConnectionThread->detach();
+
+    /*-------------------------------------------------*\
+    | Open the UDP color stream on the same port number |
+    | as the TCP server.  The server works without it,  |
+    | clients just aren't offered the stream            |
+    \*-------------------------------------------------*/
+    stream_sock = socket(AF_INET, SOCK_DGRAM, 0);
+
+    if(stream_sock != INVALID_SOCKET)
+    {
+        if(bind(stream_sock, (sockaddr*)&myAddress, sizeof(myAddress)) == SOCKET_ERROR)
+        {
+            printf("Warning: Could not bind UDP stream socket on port %hu\n", GetPort());
+            closesocket(stream_sock);
+            stream_sock = INVALID_SOCKET;
+        }
+        else
+        {
+            StreamThread = new std::thread(&NetworkServer::StreamThreadFunction, this);
+        }
+    }
 }
 
 void NetworkServer::StopServer()
 {
     server_online = false;
 
+    /*-------------------------------------------------*\
+    | Stop the stream thread before taking the client   |
+    | list lock, which it takes for each datagram.      |
+    | Shutting the socket down wakes it from select,    |
+    | and the socket is closed once it has exited so    |
+    | its descriptor can't be reused while in use       |
+    \*-------------------------------------------------*/
+    if(stream_sock != INVALID_SOCKET)
+    {
+        shutdown(stream_sock, SD_RECEIVE);
+    }
+
+    if(StreamThread != NULL)
+    {
+        StreamThread->join();
+        delete StreamThread;
+        StreamThread = NULL;
+    }
+
+    if(stream_sock != INVALID_SOCKET)
+    {
+        closesocket(stream_sock);
+        stream_sock = INVALID_SOCKET;
+    }
+
     ServerClientsMutex.lock();
     for(unsigned int client_idx = 0; client_idx < ServerClients.size(); client_idx++)
     {
         shutdown(ServerClients[client_idx]->client_sock, SD_RECEIVE);
         closesocket(ServerClients[client_idx]->client_sock);
+        StopSharedMemory(ServerClients[client_idx]);
         delete ServerClients[client_idx];
     }
 
@@ -254,12 +311,25 @@ void NetworkServer::ConnectionThreadFunction()
         \*-------------------------------------------------*/
         u_long arg = 0;
         ioctlsocket(client_info->client_sock, FIONBIO, &arg);
-        setsockopt(client_info->client_sock, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+        setsockopt(client_info->client_sock, IPPROTO_TCP, TCP_NODELAY, (const char *)&yes, sizeof(yes));
 
         inet_ntop(AF_INET, &client_addr.sin_addr, client_info->client_ip, INET_ADDRSTRLEN);
 
         client_info->client_string = "Client";
 
+        /*-------------------------------------------------*\
+        | Clients start at protocol version 0 and only get  |
+        | newer packets after requesting the version        |
+        \*-------------------------------------------------*/
+        client_info->client_protocol_version    = 0;
+        client_info->client_capabilities        = 0;
+
+        client_info->shared_memory              = NULL;
+        client_info->shared_memory_thread       = NULL;
+        client_info->shared_memory_running      = false;
+
+        client_info->stream_token               = 0;
+
         /* We need to lock before the thread could possibly finish */
         ServerClientsMutex.lock();
 
@@ -457,7 +527,23 @@ void NetworkServer::ListenThreadFunction(NetworkClientInfo * client_info)
                 break;
 
             case NET_PACKET_ID_REQUEST_CONTROLLER_DATA:
-                SendReply_ControllerData(client_sock, header.pkt_dev_idx);
+                SendReply_ControllerData(client_sock, header.pkt_dev_idx, (client_info->client_capabilities & NET_CAPABILITY_COMPACT_DESCRIPTION) != 0);
+                break;
+
+            case NET_PACKET_ID_REQUEST_CONTROLLER_STATS:
+                SendReply_ControllerStats(client_sock, header.pkt_dev_idx);
+                break;
+
+            case NET_PACKET_ID_REQUEST_PROTOCOL_VERSION:
+                ProcessRequest_ProtocolVersion(client_info, header.pkt_size, data);
+                break;
+
+            case NET_PACKET_ID_REQUEST_SHARED_MEMORY:
+                ProcessRequest_SharedMemory(client_info);
+                break;
+
+            case NET_PACKET_ID_REQUEST_STREAM:
+                ProcessRequest_Stream(client_info);
                 break;
 
             case NET_PACKET_ID_SET_CLIENT_NAME:
@@ -475,6 +561,8 @@ void NetworkServer::ListenThreadFunction(NetworkClientInfo * client_info)
                     break;
                 }
 
+                ControllersMutex.lock();
+
                 if((header.pkt_dev_idx < controllers.size()) && (header.pkt_size == (2 * sizeof(int))))
                 {
                     int zone;
@@ -485,6 +573,8 @@ void NetworkServer::ListenThreadFunction(NetworkClientInfo * client_info)
 
                     controllers[header.pkt_dev_idx]->ResizeZone(zone, new_size);
                 }
+
+                ControllersMutex.unlock();
                 break;
 
             case NET_PACKET_ID_RGBCONTROLLER_UPDATELEDS:
@@ -493,52 +583,122 @@ void NetworkServer::ListenThreadFunction(NetworkClientInfo * client_info)
                     break;
                 }
 
+                ControllersMutex.lock();
+
                 if(header.pkt_dev_idx < controllers.size())
                 {
                     controllers[header.pkt_dev_idx]->SetColorDescription((unsigned char *)data);
                     controllers[header.pkt_dev_idx]->UpdateLEDs();
                 }
+
+                ControllersMutex.unlock();
                 break;
 
-            case NET_PACKET_ID_RGBCONTROLLER_UPDATEZONELEDS:
+            case NET_PACKET_ID_RGBCONTROLLER_STAGELEDS:
                 if(data == NULL)
                 {
                     break;
                 }
 
+                ControllersMutex.lock();
+
                 if(header.pkt_dev_idx < controllers.size())
                 {
-                    int zone;
+                    controllers[header.pkt_dev_idx]->StageColorDescription((unsigned char *)data);
 
-                    memcpy(&zone, &data[sizeof(unsigned int)], sizeof(int));
+                    if(std::find(client_info->staged_devices.begin(), client_info->staged_devices.end(), header.pkt_dev_idx) == client_info->staged_devices.end())
+                    {
+                        client_info->staged_devices.push_back(header.pkt_dev_idx);
+                    }
+                }
 
-                    controllers[header.pkt_dev_idx]->SetZoneColorDescription((unsigned char *)data);
-                    controllers[header.pkt_dev_idx]->UpdateZoneLEDs(zone);
+                ControllersMutex.unlock();
+                break;
+
+            case NET_PACKET_ID_COMMIT_FRAME:
+                {
+                    /*-----------------------------------------*\
+                    | Only release the devices this client      |
+                    | staged, other clients' frames stay held   |
+                    \*-----------------------------------------*/
+                    ControllersMutex.lock();
+
+                    std::vector<RGBController *> staged_controllers;
+
+                    for(std::size_t staged_idx = 0; staged_idx < client_info->staged_devices.size(); staged_idx++)
+                    {
+                        if(client_info->staged_devices[staged_idx] < controllers.size())
+                        {
+                            staged_controllers.push_back(controllers[client_info->staged_devices[staged_idx]]);
+                        }
+                    }
+
+                    client_info->staged_devices.clear();
+
+                    RGBController::CommitStagedLEDs(staged_controllers);
+
+                    ControllersMutex.unlock();
                 }
                 break;
 
-            case NET_PACKET_ID_RGBCONTROLLER_UPDATESINGLELED:
+            case NET_PACKET_ID_UPDATELEDS_BATCH:
+                if(data == NULL)
+                {
+                    break;
+                }
+
+                ProcessRequest_UpdateLEDsBatch(header.pkt_size, data);
+                break;
+
+            case NET_PACKET_ID_RGBCONTROLLER_UPDATEZONELEDS:
                 if(data == NULL)
                 {
                     break;
                 }
 
+                /*---------------------------------------------------------*\
+                | Colors are published to the device thread, which sends    |
+                | the whole frame, instead of calling the driver's partial  |
+                | update from this thread                                   |
+                \*---------------------------------------------------------*/
+                ControllersMutex.lock();
+
                 if(header.pkt_dev_idx < controllers.size())
                 {
-                    int led;
+                    controllers[header.pkt_dev_idx]->SetZoneColorDescription((unsigned char *)data);
+                    controllers[header.pkt_dev_idx]->UpdateLEDs();
+                }
+
+                ControllersMutex.unlock();
+                break;
+
+            case NET_PACKET_ID_RGBCONTROLLER_UPDATESINGLELED:
+                if(data == NULL)
+                {
+                    break;
+                }
 
-                    memcpy(&led, data, sizeof(int));
+                ControllersMutex.lock();
 
+                if(header.pkt_dev_idx < controllers.size())
+                {
                     controllers[header.pkt_dev_idx]->SetSingleLEDColorDescription((unsigned char *)data);
-                    controllers[header.pkt_dev_idx]->UpdateSingleLED(led);
+                    controllers[header.pkt_dev_idx]->UpdateLEDs();
                 }
+
+                ControllersMutex.unlock();
                 break;
 
             case NET_PACKET_ID_RGBCONTROLLER_SETCUSTOMMODE:
+                ControllersMutex.lock();
+
                 if(header.pkt_dev_idx < controllers.size())
                 {
                     controllers[header.pkt_dev_idx]->SetCustomMode();
+                    controllers[header.pkt_dev_idx]->InvalidateMode();
                 }
+
+                ControllersMutex.unlock();
                 break;
 
             case NET_PACKET_ID_RGBCONTROLLER_UPDATEMODE:
@@ -547,11 +707,80 @@ void NetworkServer::ListenThreadFunction(NetworkClientInfo * client_info)
                     break;
                 }
 
+                ControllersMutex.lock();
+
                 if(header.pkt_dev_idx < controllers.size())
                 {
                     controllers[header.pkt_dev_idx]->SetModeDescription((unsigned char *)data);
                     controllers[header.pkt_dev_idx]->UpdateMode();
                 }
+
+                ControllersMutex.unlock();
+                break;
+
+            case NET_PACKET_ID_RGBCONTROLLER_SETOUTPUTSTAGE:
+                if(data == NULL)
+                {
+                    break;
+                }
+
+                ControllersMutex.lock();
+
+                if((header.pkt_dev_idx < controllers.size()) && (header.pkt_size == sizeof(RGBOutputStageParams)))
+                {
+                    RGBOutputStageParams params;
+
+                    memcpy(&params, data, sizeof(RGBOutputStageParams));
+
+                    controllers[header.pkt_dev_idx]->SetOutputStage(params);
+                }
+
+                ControllersMutex.unlock();
+                break;
+
+            case NET_PACKET_ID_SET_GLOBAL_BRIGHTNESS:
+                if(data == NULL)
+                {
+                    break;
+                }
+
+                ControllersMutex.lock();
+
+                if(header.pkt_size == sizeof(unsigned int))
+                {
+                    unsigned int brightness;
+
+                    memcpy(&brightness, data, sizeof(unsigned int));
+
+                    RGBOutputStage::SetGlobalBrightness(brightness);
+
+                    for(std::size_t controller_idx = 0; controller_idx < controllers.size(); controller_idx++)
+                    {
+                        controllers[controller_idx]->RefreshOutput();
+                    }
+                }
+
+                ControllersMutex.unlock();
+                break;
+
+            case NET_PACKET_ID_EFFECTS_SETEFFECT:
+                if(data == NULL || effects == NULL)
+                {
+                    break;
+                }
+
+                ControllersMutex.lock();
+
+                if((header.pkt_dev_idx < controllers.size()) && (header.pkt_size == sizeof(EffectParameters)))
+                {
+                    EffectParameters params;
+
+                    memcpy(&params, data, sizeof(EffectParameters));
+
+                    effects->SetEffect(header.pkt_dev_idx, params);
+                }
+
+                ControllersMutex.unlock();
                 break;
         }
 
@@ -569,6 +798,7 @@ listen_done:
     {
         if(ServerClients[this_idx] == client_info)
         {
+            StopSharedMemory(client_info);
             delete client_info->client_listen_thread;
             delete client_info;
             ServerClients.erase(ServerClients.begin() + this_idx);
@@ -603,6 +833,462 @@ void NetworkServer::ProcessRequest_ClientString(SOCKET client_sock, unsigned int
     ClientInfoChanged();
 }
 
+unsigned int NetworkServer::GetCapabilities()
+{
+    unsigned int capabilities = OPENRGB_SDK_CAPABILITIES;
+
+    if(effects == NULL)
+    {
+        capabilities &= ~NET_CAPABILITY_EFFECTS;
+    }
+
+    if(!NetworkSharedMemory::IsSupported())
+    {
+        capabilities &= ~NET_CAPABILITY_SHARED_MEMORY;
+    }
+
+    if(stream_sock == INVALID_SOCKET)
+    {
+        capabilities &= ~NET_CAPABILITY_UDP_STREAM;
+    }
+
+    return(capabilities);
+}
+
+void NetworkServer::ProcessRequest_ProtocolVersion(NetworkClientInfo * client_info, unsigned int data_size, char * data)
+{
+    NetProtocolVersion request;
+
+    /*-------------------------------------------------*\
+    | The capability field is optional, a request with  |
+    | only a version has no capabilities                |
+    \*-------------------------------------------------*/
+    request.protocol_version    = 0;
+    request.capabilities        = 0;
+
+    if(data != NULL)
+    {
+        memcpy(&request, data, (data_size < sizeof(request)) ? data_size : sizeof(request));
+    }
+
+    /*-------------------------------------------------*\
+    | Use the lower of the two versions and the         |
+    | capabilities both sides support                   |
+    \*-------------------------------------------------*/
+    NetProtocolVersion reply;
+
+    reply.protocol_version      = OPENRGB_SDK_PROTOCOL_VERSION;
+    reply.capabilities          = request.capabilities & GetCapabilities();
+
+    ServerClientsMutex.lock();
+    client_info->client_protocol_version    = (request.protocol_version < OPENRGB_SDK_PROTOCOL_VERSION) ? request.protocol_version : OPENRGB_SDK_PROTOCOL_VERSION;
+    client_info->client_capabilities        = reply.capabilities;
+    ServerClientsMutex.unlock();
+
+    printf("Server: Client protocol version %d, capabilities 0x%08X\r\n", request.protocol_version, reply.capabilities);
+
+    NetPacketHeader reply_hdr;
+
+    reply_hdr.pkt_magic[0] = 'O';
+    reply_hdr.pkt_magic[1] = 'R';
+    reply_hdr.pkt_magic[2] = 'G';
+    reply_hdr.pkt_magic[3] = 'B';
+
+    reply_hdr.pkt_dev_idx  = 0;
+    reply_hdr.pkt_id       = NET_PACKET_ID_REQUEST_PROTOCOL_VERSION;
+    reply_hdr.pkt_size     = sizeof(NetProtocolVersion);
+
+    SendPacket(client_info->client_sock, &reply_hdr, (const char *)&reply, sizeof(NetProtocolVersion));
+}
+
+/*---------------------------------------------------------*\
+| Batch description layout                                  |
+|   unsigned int        data_size                           |
+|   unsigned short      num_devices                         |
+|   for each device:                                        |
+|       unsigned int    dev_idx                             |
+|       color description, as sent with UPDATELEDS          |
+\*---------------------------------------------------------*/
+void NetworkServer::ProcessRequest_UpdateLEDsBatch(unsigned int data_size, char * data)
+{
+    unsigned int    data_ptr    = sizeof(unsigned int);
+    unsigned short  num_devices;
+
+    if(data_size < (sizeof(unsigned int) + sizeof(num_devices)))
+    {
+        return;
+    }
+
+    memcpy(&num_devices, &data[data_ptr], sizeof(num_devices));
+    data_ptr += sizeof(num_devices);
+
+    /*---------------------------------------------------------*\
+    | Check every entry before applying any of them, so a bad   |
+    | batch changes nothing                                     |
+    \*---------------------------------------------------------*/
+    std::vector<unsigned int> entry_offsets;
+
+    ControllersMutex.lock();
+
+    for(unsigned int device_idx = 0; device_idx < num_devices; device_idx++)
+    {
+        unsigned int    dev_idx;
+        unsigned int    color_size;
+        unsigned short  num_colors;
+
+        if((data_size - data_ptr) < (sizeof(dev_idx) + sizeof(color_size) + sizeof(num_colors)))
+        {
+            ControllersMutex.unlock();
+            return;
+        }
+
+        memcpy(&dev_idx, &data[data_ptr], sizeof(dev_idx));
+        memcpy(&color_size, &data[data_ptr + sizeof(dev_idx)], sizeof(color_size));
+        memcpy(&num_colors, &data[data_ptr + sizeof(dev_idx) + sizeof(color_size)], sizeof(num_colors));
+
+        if((dev_idx >= controllers.size())
+        || (color_size > (data_size - data_ptr - sizeof(dev_idx)))
+        || (color_size < (sizeof(color_size) + sizeof(num_colors) + (num_colors * sizeof(RGBColor))))
+        || (num_colors > controllers[dev_idx]->colors.size()))
+        {
+            ControllersMutex.unlock();
+            return;
+        }
+
+        entry_offsets.push_back(data_ptr);
+
+        data_ptr += sizeof(dev_idx) + color_size;
+    }
+
+    /*---------------------------------------------------------*\
+    | Stage every device and send them together.  Only the      |
+    | devices in the batch are committed                        |
+    \*---------------------------------------------------------*/
+    std::vector<RGBController *> batch_controllers;
+
+    for(std::size_t entry_idx = 0; entry_idx < entry_offsets.size(); entry_idx++)
+    {
+        unsigned int dev_idx;
+
+        memcpy(&dev_idx, &data[entry_offsets[entry_idx]], sizeof(dev_idx));
+
+        controllers[dev_idx]->StageColorDescription((unsigned char *)&data[entry_offsets[entry_idx] + sizeof(dev_idx)]);
+
+        batch_controllers.push_back(controllers[dev_idx]);
+    }
+
+    RGBController::CommitStagedLEDs(batch_controllers);
+
+    ControllersMutex.unlock();
+}
+
+void NetworkServer::ProcessRequest_SharedMemory(NetworkClientInfo * client_info)
+{
+    static std::atomic<unsigned int> region_count(0);
+
+    std::string name;
+
+    /*-------------------------------------------------*\
+    | Only clients on this host can map the region, and |
+    | only after agreeing on the capability             |
+    \*-------------------------------------------------*/
+    if((client_info->client_capabilities & NET_CAPABILITY_SHARED_MEMORY)
+    && (strcmp(client_info->client_ip, "127.0.0.1") == 0))
+    {
+        StopSharedMemory(client_info);
+
+        NetworkSharedMemory * shared_memory = new NetworkSharedMemory();
+
+#ifdef WIN32
+        name = "";
+#else
+        name = "/OpenRGB-" + std::to_string(getpid()) + "-" + std::to_string(region_count++);
+#endif
+
+        ControllersMutex.lock();
+
+        bool created = shared_memory->Create(name.c_str(), controllers);
+
+        ControllersMutex.unlock();
+
+        if(created)
+        {
+            client_info->shared_memory          = shared_memory;
+            client_info->shared_memory_running  = true;
+            client_info->shared_memory_thread   = new std::thread(&NetworkServer::SharedMemoryThreadFunction, this, client_info);
+
+            printf("Server: Shared memory region %s for %d controllers\r\n", name.c_str(), shared_memory->GetNumSlots());
+        }
+        else
+        {
+            delete shared_memory;
+            name = "";
+        }
+    }
+
+    /*-------------------------------------------------*\
+    | Reply with the region name, or an empty string if |
+    | the client should keep using the socket           |
+    \*-------------------------------------------------*/
+    NetPacketHeader reply_hdr;
+
+    reply_hdr.pkt_magic[0] = 'O';
+    reply_hdr.pkt_magic[1] = 'R';
+    reply_hdr.pkt_magic[2] = 'G';
+    reply_hdr.pkt_magic[3] = 'B';
+
+    reply_hdr.pkt_dev_idx  = 0;
+    reply_hdr.pkt_id       = NET_PACKET_ID_REQUEST_SHARED_MEMORY;
+    reply_hdr.pkt_size     = name.size() + 1;
+
+    SendPacket(client_info->client_sock, &reply_hdr, name.c_str(), name.size() + 1);
+}
+
+void NetworkServer::SharedMemoryThreadFunction(NetworkClientInfo * client_info)
+{
+    NetworkSharedMemory *       shared_memory   = client_info->shared_memory;
+    unsigned int                doorbell        = 0;
+    std::vector<unsigned int>   last_sequence(shared_memory->GetNumSlots(), 0);
+    std::vector<RGBColor>       slot_colors;
+
+    while(client_info->shared_memory_running.load())
+    {
+        /*-------------------------------------------------*\
+        | Sleep until the client rings, waking now and then |
+        | to notice the client going away                   |
+        \*-------------------------------------------------*/
+        doorbell = shared_memory->Wait(doorbell, 100ms);
+
+        ControllersMutex.lock();
+
+        for(unsigned int slot_idx = 0; slot_idx < last_sequence.size(); slot_idx++)
+        {
+            unsigned int sequence = shared_memory->GetSlotSequence(slot_idx);
+
+            if((sequence == last_sequence[slot_idx])
+            || (slot_idx >= controllers.size())
+            || (shared_memory->GetSlotColors(slot_idx) != controllers[slot_idx]->colors.size()))
+            {
+                continue;
+            }
+
+            /*-------------------------------------------------*\
+            | Read into a local buffer first.  If the client    |
+            | was mid-write the torn read is dropped, the slot  |
+            | stays unseen and is read again after its next     |
+            | doorbell                                          |
+            \*-------------------------------------------------*/
+            RGBController * controller  = controllers[slot_idx];
+
+            slot_colors.resize(controller->colors.size());
+
+            if(!shared_memory->ReadColors(slot_idx, slot_colors.data(), slot_colors.size(), sequence))
+            {
+                continue;
+            }
+
+            last_sequence[slot_idx] = sequence;
+
+            RGBColor * frame = controller->BeginFrame();
+
+            memcpy(frame, slot_colors.data(), slot_colors.size() * sizeof(RGBColor));
+
+            controller->PublishFrame();
+
+            controller->UpdateLEDs();
+        }
+
+        ControllersMutex.unlock();
+    }
+}
+
+void NetworkServer::ProcessRequest_Stream(NetworkClientInfo * client_info)
+{
+    static std::mt19937 token_generator(std::random_device{}());
+
+    NetStreamInfo reply;
+
+    reply.stream_token  = 0;
+    reply.stream_port   = port_num;
+    reply.reserved      = 0;
+
+    if(client_info->client_capabilities & NET_CAPABILITY_UDP_STREAM)
+    {
+        ServerClientsMutex.lock();
+
+        /*-------------------------------------------------*\
+        | Zero is reserved for "declined"                   |
+        \*-------------------------------------------------*/
+        while(reply.stream_token == 0)
+        {
+            reply.stream_token = token_generator();
+        }
+
+        client_info->stream_token = reply.stream_token;
+
+        ControllersMutex.lock();
+        client_info->stream_sequence.assign(controllers.size(), 0);
+        ControllersMutex.unlock();
+
+        ServerClientsMutex.unlock();
+    }
+
+    NetPacketHeader reply_hdr;
+
+    reply_hdr.pkt_magic[0] = 'O';
+    reply_hdr.pkt_magic[1] = 'R';
+    reply_hdr.pkt_magic[2] = 'G';
+    reply_hdr.pkt_magic[3] = 'B';
+
+    reply_hdr.pkt_dev_idx  = 0;
+    reply_hdr.pkt_id       = NET_PACKET_ID_REQUEST_STREAM;
+    reply_hdr.pkt_size     = sizeof(NetStreamInfo);
+
+    SendPacket(client_info->client_sock, &reply_hdr, (const char *)&reply, sizeof(NetStreamInfo));
+}
+
+void NetworkServer::StreamThreadFunction()
+{
+    SOCKET      sock        = stream_sock;
+    char *      data        = new char[65536];
+
+    printf("Network stream thread started on port %hu\n", GetPort());
+
+    while(server_online == true)
+    {
+        fd_set              set;
+        struct timeval      timeout;
+
+        timeout.tv_sec      = 1;
+        timeout.tv_usec     = 0;
+
+        FD_ZERO(&set);
+        FD_SET(sock, &set);
+
+        int rv = select(sock + 1, &set, NULL, NULL, &timeout);
+
+        if(rv == SOCKET_ERROR)
+        {
+            break;
+        }
+        else if(rv == 0)
+        {
+            continue;
+        }
+
+        sockaddr_in source;
+        socklen_t   source_len  = sizeof(source);
+
+        int bytes_read = recvfrom(sock, data, 65536, 0, (sockaddr *)&source, &source_len);
+
+        if(bytes_read > 0)
+        {
+            ProcessStreamDatagram(data, bytes_read, &source);
+        }
+    }
+
+    delete[] data;
+
+    printf("Stream thread closed\r\n");
+}
+
+void NetworkServer::ProcessStreamDatagram(char * data, int data_size, sockaddr_in * source)
+{
+    NetStreamHeader header;
+    unsigned int    color_size;
+    unsigned short  num_colors;
+
+    /*-------------------------------------------------*\
+    | Datagrams can come from anywhere, check them      |
+    | fully before touching a controller                |
+    \*-------------------------------------------------*/
+    if((unsigned int)data_size < (sizeof(header) + sizeof(color_size) + sizeof(num_colors)))
+    {
+        return;
+    }
+
+    memcpy(&header, data, sizeof(header));
+    memcpy(&color_size, &data[sizeof(header)], sizeof(color_size));
+    memcpy(&num_colors, &data[sizeof(header) + sizeof(color_size)], sizeof(num_colors));
+
+    if((header.pkt_magic[0] != 'O') || (header.pkt_magic[1] != 'R') || (header.pkt_magic[2] != 'G') || (header.pkt_magic[3] != 'S')
+    || (header.stream_token == 0)
+    || (color_size != (data_size - sizeof(header)))
+    || (color_size < (sizeof(color_size) + sizeof(num_colors) + (num_colors * sizeof(RGBColor)))))
+    {
+        return;
+    }
+
+    /*-------------------------------------------------*\
+    | Match the token to a client at the same address   |
+    | and drop anything older than what was applied     |
+    \*-------------------------------------------------*/
+    char source_ip[INET_ADDRSTRLEN];
+    bool fresh = false;
+
+    inet_ntop(AF_INET, &source->sin_addr, source_ip, INET_ADDRSTRLEN);
+
+    ServerClientsMutex.lock();
+
+    for(unsigned int client_idx = 0; client_idx < ServerClients.size(); client_idx++)
+    {
+        NetworkClientInfo * client_info = ServerClients[client_idx];
+
+        if((client_info->stream_token == header.stream_token)
+        && (strcmp(client_info->client_ip, source_ip) == 0)
+        && (header.pkt_dev_idx < client_info->stream_sequence.size()))
+        {
+            unsigned int& last_sequence = client_info->stream_sequence[header.pkt_dev_idx];
+
+            if((int)(header.sequence - last_sequence) > 0)
+            {
+                last_sequence   = header.sequence;
+                fresh           = true;
+            }
+            break;
+        }
+    }
+
+    ServerClientsMutex.unlock();
+
+    /*-------------------------------------------------*\
+    | Check the device against the list only once the   |
+    | sender is known, the list lock is shared with     |
+    | every other server thread                         |
+    \*-------------------------------------------------*/
+    if(fresh)
+    {
+        ControllersMutex.lock();
+
+        if((header.pkt_dev_idx < controllers.size())
+        && (num_colors <= controllers[header.pkt_dev_idx]->colors.size()))
+        {
+            controllers[header.pkt_dev_idx]->SetColorDescription((unsigned char *)&data[sizeof(header)]);
+            controllers[header.pkt_dev_idx]->UpdateLEDs();
+        }
+
+        ControllersMutex.unlock();
+    }
+}
+
+void NetworkServer::StopSharedMemory(NetworkClientInfo * client_info)
+{
+    client_info->shared_memory_running = false;
+
+    if(client_info->shared_memory_thread != NULL)
+    {
+        client_info->shared_memory_thread->join();
+        delete client_info->shared_memory_thread;
+        client_info->shared_memory_thread = NULL;
+    }
+
+    if(client_info->shared_memory != NULL)
+    {
+        delete client_info->shared_memory;
+        client_info->shared_memory = NULL;
+    }
+}
+
 void NetworkServer::SendReply_ControllerCount(SOCKET client_sock)
 {
     NetPacketHeader reply_hdr;
@@ -617,18 +1303,34 @@ void NetworkServer::SendReply_ControllerCount(SOCKET client_sock)
     reply_hdr.pkt_id       = NET_PACKET_ID_REQUEST_CONTROLLER_COUNT;
     reply_hdr.pkt_size     = sizeof(unsigned int);
 
+    ControllersMutex.lock();
     reply_data             = controllers.size();
+    ControllersMutex.unlock();
 
-    send(client_sock, (const char *)&reply_hdr, sizeof(NetPacketHeader), 0);
-    send(client_sock, (const char *)&reply_data, sizeof(unsigned int), 0);
+    SendPacket(client_sock, &reply_hdr, (const char *)&reply_data, sizeof(unsigned int));
 }
 
-void NetworkServer::SendReply_ControllerData(SOCKET client_sock, unsigned int dev_idx)
+void NetworkServer::SendReply_ControllerData(SOCKET client_sock, unsigned int dev_idx, bool compact)
 {
+    unsigned char *reply_data = NULL;
+
+    /*-------------------------------------------------*\
+    | Build the description under the list lock and     |
+    | send it after, so a slow client can't hold up the |
+    | other users of the controller list                |
+    \*-------------------------------------------------*/
+    ControllersMutex.lock();
+
     if(dev_idx < controllers.size())
+    {
+        reply_data = compact ? controllers[dev_idx]->GetDeviceDescriptionCompact() : controllers[dev_idx]->GetDeviceDescription();
+    }
+
+    ControllersMutex.unlock();
+
+    if(reply_data != NULL)
     {
         NetPacketHeader reply_hdr;
-        unsigned char *reply_data = controllers[dev_idx]->GetDeviceDescription();
         unsigned int   reply_size;
 
         memcpy(&reply_size, reply_data, sizeof(reply_size));
@@ -642,7 +1344,57 @@ void NetworkServer::SendReply_ControllerData(SOCKET client_sock, unsigned int de
         reply_hdr.pkt_id       = NET_PACKET_ID_REQUEST_CONTROLLER_DATA;
         reply_hdr.pkt_size     = reply_size;
 
-        send(client_sock, (const char *)&reply_hdr, sizeof(NetPacketHeader), 0);
-        send(client_sock, (const char *)reply_data, reply_size, 0);
+        SendPacket(client_sock, &reply_hdr, (const char *)reply_data, reply_size);
+
+        delete[] reply_data;
+    }
+}
+
+void NetworkServer::SendReply_ControllerStats(SOCKET client_sock, unsigned int dev_idx)
+{
+    RGBControllerStatsSnapshot  stats;
+    bool                        valid       = false;
+
+    ControllersMutex.lock();
+
+    if(dev_idx < controllers.size())
+    {
+        stats = controllers[dev_idx]->GetStats();
+        valid = true;
+    }
+
+    ControllersMutex.unlock();
+
+    if(valid)
+    {
+        NetPacketHeader             reply_hdr;
+        unsigned char *             reply_data  = RGBControllerStats::GetDescription(stats);
+        unsigned int                reply_size;
+
+        memcpy(&reply_size, reply_data, sizeof(reply_size));
+
+        reply_hdr.pkt_magic[0] = 'O';
+        reply_hdr.pkt_magic[1] = 'R';
+        reply_hdr.pkt_magic[2] = 'G';
+        reply_hdr.pkt_magic[3] = 'B';
+
+        reply_hdr.pkt_dev_idx  = dev_idx;
+        reply_hdr.pkt_id       = NET_PACKET_ID_REQUEST_CONTROLLER_STATS;
+        reply_hdr.pkt_size     = reply_size;
+
+        SendPacket(client_sock, &reply_hdr, (const char *)reply_data, reply_size);
+
+        delete[] reply_data;
+    }
+}
+
+void NetworkServer::SendPacket(SOCKET client_sock, NetPacketHeader * header, const char * data, unsigned int size)
+{
+    if(!net_send_packet(client_sock, (const char *)header, sizeof(NetPacketHeader), data, size))
+    {
+        /*-------------------------------------------------*\
+        | The connection is broken, end its listen thread   |
+        \*-------------------------------------------------*/
+        shutdown(client_sock, SD_RECEIVE);
     }
 }
@@ -7,9 +7,12 @@
 \*-----------------------------------------*/
 
 #include "RGBController.h"
+#include "EffectsEngine.h"
 #include "NetworkProtocol.h"
+#include "NetworkSharedMemory.h"
 #include "net_port.h"
 
+#include <atomic>
 #include <mutex>
 #include <thread>
 #include <chrono>
@@ -24,12 +27,23 @@ struct NetworkClientInfo
     std::thread *   client_listen_thread;
     std::string     client_string;
     char            client_ip[INET_ADDRSTRLEN];
+    unsigned int    client_protocol_version;
+    unsigned int    client_capabilities;
+
+    NetworkSharedMemory *   shared_memory;
+    std::thread *           shared_memory_thread;
+    std::atomic<bool>       shared_memory_running;
+
+    unsigned int                stream_token;
+    std::vector<unsigned int>   stream_sequence;
+
+    std::vector<unsigned int>   staged_devices;             /* Devices staged since the last commit */
 };
 
 class NetworkServer
 {
 public:
-    NetworkServer(std::vector<RGBController *>& control);
+    NetworkServer(std::vector<RGBController *>& control, std::mutex& control_mutex);
 
     unsigned short                      GetPort();
     bool                                GetOnline();
@@ -41,27 +55,40 @@ public:
     void                                RegisterClientInfoChangeCallback(NetServerCallback, void * new_callback_arg);
 
     void                                SetPort(unsigned short new_port);
+    void                                SetEffectsEngine(EffectsEngine * effects_ptr);
 
     void                                StartServer();
     void                                StopServer();
 
     void                                ConnectionThreadFunction();
     void                                ListenThreadFunction(NetworkClientInfo * client_sock);
+    void                                SharedMemoryThreadFunction(NetworkClientInfo * client_info);
+    void                                StreamThreadFunction();
 
     void                                ProcessRequest_ClientString(SOCKET client_sock, unsigned int data_size, char * data);
+    void                                ProcessRequest_ProtocolVersion(NetworkClientInfo * client_info, unsigned int data_size, char * data);
+    void                                ProcessRequest_UpdateLEDsBatch(unsigned int data_size, char * data);
+    void                                ProcessRequest_SharedMemory(NetworkClientInfo * client_info);
+    void                                ProcessRequest_Stream(NetworkClientInfo * client_info);
+
+    unsigned int                        GetCapabilities();
 
     void                                SendReply_ControllerCount(SOCKET client_sock);
-    void                                SendReply_ControllerData(SOCKET client_sock, unsigned int dev_idx);
+    void                                SendReply_ControllerData(SOCKET client_sock, unsigned int dev_idx, bool compact);
+    void                                SendReply_ControllerStats(SOCKET client_sock, unsigned int dev_idx);
 
 protected:
     unsigned short                      port_num;
-    bool                                server_online;
+    std::atomic<bool>                   server_online;
 
     std::vector<RGBController *>&       controllers;
+    std::mutex&                         ControllersMutex;
+    EffectsEngine *                     effects;
 
     std::mutex                          ServerClientsMutex;
     std::vector<NetworkClientInfo *>    ServerClients;
     std::thread *                       ConnectionThread;
+    std::thread *                       StreamThread;
 
     std::mutex                          ClientInfoChangeMutex;
     std::vector<NetServerCallback>      ClientInfoChangeCallbacks;
@@ -73,7 +100,12 @@ private:
 #endif
 
     SOCKET          server_sock;
+    SOCKET          stream_sock;
 
     int             accept_select(int sockfd, struct sockaddr *addr, socklen_t *addrlen);
     int             recv_select(SOCKET s, char *buf, int len, int flags);
+
+    void            StopSharedMemory(NetworkClientInfo * client_info);
+    void            SendPacket(SOCKET client_sock, NetPacketHeader * header, const char * data, unsigned int size);
+    void            ProcessStreamDatagram(char * data, int data_size, sockaddr_in * source);
 };
@@ -0,0 +1,377 @@
+/*-----------------------------------------*\
+|  NetworkSharedMemory.cpp                  |
+|                                           |
+|  Shared color region for SDK clients on   |
+|  the same host as the server              |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "NetworkSharedMemory.h"
+
+#include <cstring>
+#include <new>
+#include <thread>
+
+#ifdef __linux__
+#include <climits>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/*---------------------------------------------------------*\
+| Color arrays start on their own cache line so a client    |
+| writing one slot doesn't slow down reads of its neighbour |
+\*---------------------------------------------------------*/
+#define NET_SHARED_MEMORY_ALIGN         64
+
+static_assert(sizeof(std::atomic<unsigned int>) == sizeof(unsigned int), "shared memory atomics must be plain words");
+
+NetworkSharedMemory::NetworkSharedMemory()
+{
+    owner       = false;
+    region      = NULL;
+    region_size = 0;
+    header      = NULL;
+    slot_table  = NULL;
+}
+
+NetworkSharedMemory::~NetworkSharedMemory()
+{
+    Close();
+}
+
+bool NetworkSharedMemory::IsSupported()
+{
+#ifdef __linux__
+    return(std::atomic<unsigned int>().is_lock_free());
+#else
+    return(false);
+#endif
+}
+
+bool NetworkSharedMemory::Create(const char * new_name, std::vector<RGBController *>& controllers)
+{
+#ifdef __linux__
+    Close();
+
+    /*---------------------------------------------------------*\
+    | Lay out the header, the slots and then the colors         |
+    \*---------------------------------------------------------*/
+    std::size_t offset = sizeof(NetSharedMemoryHeader) + controllers.size() * sizeof(NetSharedMemorySlot);
+
+    std::vector<unsigned int> offsets(controllers.size());
+
+    for(std::size_t slot_idx = 0; slot_idx < controllers.size(); slot_idx++)
+    {
+        offset            = (offset + NET_SHARED_MEMORY_ALIGN - 1) & ~((std::size_t)NET_SHARED_MEMORY_ALIGN - 1);
+        offsets[slot_idx] = (unsigned int)offset;
+        offset           += controllers[slot_idx]->colors.size() * sizeof(RGBColor);
+    }
+
+    /*---------------------------------------------------------*\
+    | Only the user running the server may map the region       |
+    \*---------------------------------------------------------*/
+    int fd = shm_open(new_name, O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+
+    if(fd < 0)
+    {
+        return(false);
+    }
+
+    if(ftruncate(fd, offset) != 0)
+    {
+        close(fd);
+        shm_unlink(new_name);
+        return(false);
+    }
+
+    void * map = mmap(NULL, offset, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if(map == MAP_FAILED)
+    {
+        shm_unlink(new_name);
+        return(false);
+    }
+
+    name        = new_name;
+    owner       = true;
+    region      = (unsigned char *)map;
+    region_size = offset;
+
+    header      = new(region) NetSharedMemoryHeader;
+    slot_table  = (NetSharedMemorySlot *)(region + sizeof(NetSharedMemoryHeader));
+
+    header->doorbell    = 0;
+    header->num_slots   = controllers.size();
+    header->reserved    = 0;
+
+    slot_offsets.resize(controllers.size());
+    slot_num_colors.resize(controllers.size());
+
+    for(std::size_t slot_idx = 0; slot_idx < controllers.size(); slot_idx++)
+    {
+        new(&slot_table[slot_idx]) NetSharedMemorySlot;
+
+        slot_table[slot_idx].sequence    = 0;
+        slot_table[slot_idx].num_colors  = controllers[slot_idx]->colors.size();
+        slot_table[slot_idx].offset      = offsets[slot_idx];
+        slot_table[slot_idx].reserved    = 0;
+
+        slot_offsets[slot_idx]      = offsets[slot_idx];
+        slot_num_colors[slot_idx]   = controllers[slot_idx]->colors.size();
+    }
+
+    /*---------------------------------------------------------*\
+    | Write the magic last so a client never sees a partially   |
+    | built region                                              |
+    \*---------------------------------------------------------*/
+    std::atomic_thread_fence(std::memory_order_release);
+
+    header->magic       = NET_SHARED_MEMORY_MAGIC;
+
+    return(true);
+#else
+    (void)new_name;
+    (void)controllers;
+
+    return(false);
+#endif
+}
+
+bool NetworkSharedMemory::Open(const char * new_name)
+{
+#ifdef __linux__
+    Close();
+
+    int fd = shm_open(new_name, O_RDWR, 0);
+
+    if(fd < 0)
+    {
+        return(false);
+    }
+
+    struct stat st;
+
+    if((fstat(fd, &st) != 0) || ((std::size_t)st.st_size < sizeof(NetSharedMemoryHeader)))
+    {
+        close(fd);
+        return(false);
+    }
+
+    void * map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if(map == MAP_FAILED)
+    {
+        return(false);
+    }
+
+    name        = new_name;
+    owner       = false;
+    region      = (unsigned char *)map;
+    region_size = st.st_size;
+
+    header      = (NetSharedMemoryHeader *)region;
+    slot_table  = (NetSharedMemorySlot *)(region + sizeof(NetSharedMemoryHeader));
+
+    /*---------------------------------------------------------*\
+    | Check the layout once and keep a copy of it, the values   |
+    | in the region are not read again                          |
+    \*---------------------------------------------------------*/
+    unsigned int num_slots = header->num_slots;
+
+    bool valid = (header->magic == NET_SHARED_MEMORY_MAGIC)
+              && (num_slots <= ((region_size - sizeof(NetSharedMemoryHeader)) / sizeof(NetSharedMemorySlot)));
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if(valid)
+    {
+        slot_offsets.resize(num_slots);
+        slot_num_colors.resize(num_slots);
+    }
+
+    for(unsigned int slot_idx = 0; valid && (slot_idx < num_slots); slot_idx++)
+    {
+        slot_offsets[slot_idx]      = slot_table[slot_idx].offset;
+        slot_num_colors[slot_idx]   = slot_table[slot_idx].num_colors;
+
+        std::size_t end = (std::size_t)slot_offsets[slot_idx] + (std::size_t)slot_num_colors[slot_idx] * sizeof(RGBColor);
+
+        valid = (end <= region_size);
+    }
+
+    if(!valid)
+    {
+        Close();
+        return(false);
+    }
+
+    return(true);
+#else
+    (void)new_name;
+
+    return(false);
+#endif
+}
+
+void NetworkSharedMemory::Close()
+{
+#ifdef __linux__
+    if(region != NULL)
+    {
+        munmap(region, region_size);
+    }
+
+    if(owner)
+    {
+        shm_unlink(name.c_str());
+    }
+#endif
+
+    name.clear();
+    slot_offsets.clear();
+    slot_num_colors.clear();
+
+    owner       = false;
+    region      = NULL;
+    region_size = 0;
+    header      = NULL;
+    slot_table  = NULL;
+}
+
+const char * NetworkSharedMemory::GetName()
+{
+    return(name.c_str());
+}
+
+unsigned int NetworkSharedMemory::GetNumSlots()
+{
+    return(slot_offsets.size());
+}
+
+unsigned int NetworkSharedMemory::GetSlotColors(unsigned int slot)
+{
+    if(slot >= GetNumSlots())
+    {
+        return(0);
+    }
+
+    return(slot_num_colors[slot]);
+}
+
+unsigned int NetworkSharedMemory::GetSlotSequence(unsigned int slot)
+{
+    if(slot >= GetNumSlots())
+    {
+        return(0);
+    }
+
+    return(slot_table[slot].sequence.load(std::memory_order_acquire));
+}
+
+bool NetworkSharedMemory::WriteColors(unsigned int slot, const RGBColor * colors, unsigned int num_colors)
+{
+    if((slot >= GetNumSlots()) || (num_colors != slot_num_colors[slot]))
+    {
+        return(false);
+    }
+
+    /*---------------------------------------------------------*\
+    | Each slot has a single writer, the client device thread   |
+    | for that controller                                       |
+    \*---------------------------------------------------------*/
+    unsigned int sequence = slot_table[slot].sequence.load(std::memory_order_relaxed);
+
+    slot_table[slot].sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    memcpy(region + slot_offsets[slot], colors, num_colors * sizeof(RGBColor));
+
+    slot_table[slot].sequence.store(sequence + 2, std::memory_order_release);
+
+    return(true);
+}
+
+bool NetworkSharedMemory::ReadColors(unsigned int slot, RGBColor * colors, unsigned int num_colors, unsigned int& sequence)
+{
+    if((slot >= GetNumSlots()) || (num_colors != slot_num_colors[slot]))
+    {
+        return(false);
+    }
+
+    /*---------------------------------------------------------*\
+    | Retry a few times if the client was writing, after that   |
+    | give up and wait for its next doorbell                    |
+    \*---------------------------------------------------------*/
+    for(unsigned int attempt = 0; attempt < 4; attempt++)
+    {
+        unsigned int before = slot_table[slot].sequence.load(std::memory_order_acquire);
+
+        if(before & 1)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        memcpy(colors, region + slot_offsets[slot], num_colors * sizeof(RGBColor));
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if(slot_table[slot].sequence.load(std::memory_order_relaxed) == before)
+        {
+            sequence = before;
+            return(true);
+        }
+    }
+
+    return(false);
+}
+
+void NetworkSharedMemory::Ring()
+{
+    if(header == NULL)
+    {
+        return;
+    }
+
+    header->doorbell.fetch_add(1, std::memory_order_release);
+
+#ifdef __linux__
+    syscall(SYS_futex, &header->doorbell, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#endif
+}
+
+unsigned int NetworkSharedMemory::Wait(unsigned int last_doorbell, std::chrono::milliseconds timeout)
+{
+    if(header == NULL)
+    {
+        std::this_thread::sleep_for(timeout);
+        return(last_doorbell);
+    }
+
+#ifdef __linux__
+    /*---------------------------------------------------------*\
+    | The futex returns straight away if the doorbell has moved |
+    | since last_doorbell was read                              |
+    \*---------------------------------------------------------*/
+    struct timespec ts;
+
+    ts.tv_sec   = timeout.count() / 1000;
+    ts.tv_nsec  = (timeout.count() % 1000) * 1000000;
+
+    syscall(SYS_futex, &header->doorbell, FUTEX_WAIT, last_doorbell, &ts, NULL, 0);
+#else
+    std::this_thread::sleep_for(timeout);
+#endif
+
+    return(header->doorbell.load(std::memory_order_acquire));
+}
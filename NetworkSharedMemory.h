@@ -0,0 +1,90 @@
+/*-----------------------------------------*\
+|  NetworkSharedMemory.h                    |
+|                                           |
+|  Shared color region for SDK clients on   |
+|  the same host as the server              |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#pragma once
+
+#include "RGBController.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#define NET_SHARED_MEMORY_MAGIC         0x4247524F      /* "ORGB"                           */
+
+/*---------------------------------------------------------*\
+| One slot per controller.  sequence is odd while the       |
+| client is writing the slot's colors and even once they    |
+| are complete                                              |
+\*---------------------------------------------------------*/
+typedef struct
+{
+    std::atomic<unsigned int>   sequence;
+    unsigned int                num_colors;             /* Fixed when the region is created         */
+    unsigned int                offset;                 /* Byte offset of the colors in the region  */
+    unsigned int                reserved;
+} NetSharedMemorySlot;
+
+/*---------------------------------------------------------*\
+| Region header, followed by num_slots slots and then the   |
+| color arrays.  The client bumps doorbell after writing    |
+| any slot and the server sleeps on it                      |
+\*---------------------------------------------------------*/
+typedef struct
+{
+    unsigned int                magic;
+    std::atomic<unsigned int>   doorbell;
+    unsigned int                num_slots;
+    unsigned int                reserved;
+} NetSharedMemoryHeader;
+
+class NetworkSharedMemory
+{
+public:
+    NetworkSharedMemory();
+    ~NetworkSharedMemory();
+
+    static bool                 IsSupported();
+
+    /*---------------------------------------------------------*\
+    | The server creates the region sized for its controllers,  |
+    | the client opens it by the name the server sends back     |
+    \*---------------------------------------------------------*/
+    bool                        Create(const char * new_name, std::vector<RGBController *>& controllers);
+    bool                        Open(const char * new_name);
+    void                        Close();
+
+    const char *                GetName();
+    unsigned int                GetNumSlots();
+    unsigned int                GetSlotColors(unsigned int slot);
+    unsigned int                GetSlotSequence(unsigned int slot);
+
+    bool                        WriteColors(unsigned int slot, const RGBColor * colors, unsigned int num_colors);
+    bool                        ReadColors(unsigned int slot, RGBColor * colors, unsigned int num_colors, unsigned int& sequence);
+
+    void                        Ring();
+    unsigned int                Wait(unsigned int last_doorbell, std::chrono::milliseconds timeout);
+
+private:
+    std::string                 name;
+    bool                        owner;
+    unsigned char *             region;
+    std::size_t                 region_size;
+
+    NetSharedMemoryHeader *     header;
+    NetSharedMemorySlot *       slot_table;
+
+    /*---------------------------------------------------------*\
+    | Private copies of the layout.  The other process can      |
+    | write the mapped header and slots, so offsets and sizes   |
+    | are never read back from the region                       |
+    \*---------------------------------------------------------*/
+    std::vector<unsigned int>   slot_offsets;
+    std::vector<unsigned int>   slot_num_colors;
+};
@@ -98,9 +98,11 @@ INCLUDEPATH +=                                                          \
 
 HEADERS +=                                                              \
     dependencies/ColorWheel/ColorWheel.h                                \
+    EffectsEngine.h                                                     \
     NetworkClient.h                                                     \
     NetworkProtocol.h                                                   \
     NetworkServer.h                                                     \
+    NetworkSharedMemory.h                                               \
     ProfileManager.h                                                    \
     ResourceManager.h                                                   \
     Detector.h                                                          \
@@ -182,6 +184,10 @@ HEADERS +=                                                              \
     Controllers/TecknetController/TecknetController.h                   \
     Controllers/ThermaltakeRiingController/ThermaltakeRiingController.h \
     RGBController/RGBController.h                                       \
+    RGBController/RGBColorTransform.h                                   \
+    RGBController/RGBControllerStats.h                                  \
+    RGBController/RGBDescriptionCodec.h                                 \
+    RGBController/RGBOutputStage.h                                      \
     RGBController/RGBController_AMDWraithPrism.h                        \
     RGBController/RGBController_AorusATC800.h                           \
     RGBController/RGBController_AuraUSB.h                               \
@@ -250,8 +256,10 @@ SOURCES +=                                                              \
     dependencies/libe131/src/e131.c                                     \
     main.cpp                                                            \
     cli.cpp                                                             \
+    EffectsEngine.cpp                                                   \
     NetworkClient.cpp                                                   \
     NetworkServer.cpp                                                   \
+    NetworkSharedMemory.cpp                                             \
     ProfileManager.cpp                                                  \
     ResourceManager.cpp                                                 \
     qt/OpenRGBClientInfoPage.cpp                                        \
@@ -375,6 +383,10 @@ SOURCES +=                                                              \
     Controllers/ThermaltakeRiingController/ThermaltakeRiingController.cpp \
     Controllers/ThermaltakeRiingController/ThermaltakeRiingControllerDetect.cpp \
     RGBController/RGBController.cpp                                     \
+    RGBController/RGBColorTransform.cpp                                 \
+    RGBController/RGBControllerStats.cpp                                \
+    RGBController/RGBDescriptionCodec.cpp                               \
+    RGBController/RGBOutputStage.cpp                                    \
     RGBController/DebugControllerDetect.cpp                             \
     RGBController/E131ControllerDetect.cpp                              \
     RGBController/RGBController_AMDWraithPrism.cpp                      \
@@ -576,6 +588,7 @@ unix:!macx {
     LIBS +=                                                             \
     -lusb-1.0                                                           \
     -lstdc++fs                                                          \
+    -lrt                                                                \
 
     #-------------------------------------------------------------------#
     # Determine which hidapi to use based on availability               #
@@ -635,3 +648,43 @@ unix:macx {
     LIBS +=                                                             \
     -L/usr/local/lib -lusb-1.0 -lhidapi                                 \
 }
+
+#-----------------------------------------------------------------------#
+# Mock hidapi Configuration                                             #
+#   qmake CONFIG+=hidapi_mock replaces hidapi with an in-process fake   #
+#   backend for benchmarking HID controllers (--hid-benchmark)          #
+#-----------------------------------------------------------------------#
+CONFIG(hidapi_mock) {
+    message("Mock hidapi Mode")
+
+    LIBS -=                                                             \
+    -lhidapi                                                            \
+    -lhidapi-hidraw                                                     \
+    -lhidapi-libusb                                                     \
+
+    DEFINES +=                                                          \
+    HIDAPI_MOCK                                                         \
+
+    INCLUDEPATH +=                                                      \
+    dependencies/hidapi                                                 \
+    hidapi_mock/                                                        \
+
+    HEADERS +=                                                          \
+    hidapi_mock/hidapi_mock.h                                           \
+
+    SOURCES +=                                                          \
+    hidapi_mock/hidapi_mock.cpp                                         \
+    hidapi_mock/hidapi_mock_devices.cpp                                 \
+}
+
+#-----------------------------------------------------------------------#
+# Mock Super IO Configuration                                           #
+#   qmake CONFIG+=superio_mock replaces /dev/port with an in-memory     #
+#   fake that counts port access system calls                           #
+#-----------------------------------------------------------------------#
+CONFIG(superio_mock) {
+    message("Mock Super IO Mode")
+
+    DEFINES +=                                                          \
+    SUPERIO_MOCK                                                        \
+}
@@ -4,10 +4,152 @@
 #include <experimental/filesystem>
 #include <fstream>
 #include <iostream>
+#include <algorithm>
 #include <cstring>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace fs = std::experimental::filesystem;
 
+/*---------------------------------------------------------*\
+| Read-only view of a profile file.  The file is memory     |
+| mapped where available                                    |
+\*---------------------------------------------------------*/
+class ProfileFileMap
+{
+public:
+    ProfileFileMap(std::string filename)
+    {
+        data = NULL;
+        size = 0;
+
+#ifdef _WIN32
+        file    = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        mapping = NULL;
+
+        if(file != INVALID_HANDLE_VALUE)
+        {
+            LARGE_INTEGER file_size;
+
+            if(GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0)
+            {
+                mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+                if(mapping != NULL)
+                {
+                    data = (const unsigned char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                    size = (data != NULL) ? (std::size_t)file_size.QuadPart : 0;
+                }
+            }
+        }
+#else
+        int fd = open(filename.c_str(), O_RDONLY);
+
+        if(fd >= 0)
+        {
+            struct stat file_stat;
+
+            if(fstat(fd, &file_stat) == 0 && file_stat.st_size > 0)
+            {
+                void * map = mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+                if(map != MAP_FAILED)
+                {
+                    data = (const unsigned char *)map;
+                    size = file_stat.st_size;
+                }
+            }
+
+            close(fd);
+        }
+#endif
+    }
+
+    ~ProfileFileMap()
+    {
+#ifdef _WIN32
+        if(data != NULL)
+        {
+            UnmapViewOfFile(data);
+        }
+
+        if(mapping != NULL)
+        {
+            CloseHandle(mapping);
+        }
+
+        if(file != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(file);
+        }
+#else
+        if(data != NULL)
+        {
+            munmap((void *)data, size);
+        }
+#endif
+    }
+
+    const unsigned char *   data;
+    std::size_t             size;
+
+private:
+#ifdef _WIN32
+    HANDLE                  file;
+    HANDLE                  mapping;
+#endif
+};
+
+/*---------------------------------------------------------*\
+| Check that count elements of elem_size fit at offset      |
+\*---------------------------------------------------------*/
+static bool ProfileDataContains(std::size_t size, unsigned int offset, unsigned int count, std::size_t elem_size)
+{
+    return((offset <= size) && (count <= (size - offset) / elem_size));
+}
+
+/*---------------------------------------------------------*\
+| v2 entries don't store the mode's speed and color limits, |
+| so check the saved settings against the live mode before  |
+| handing them to the driver.  Some drivers count speed     |
+| down, so the limits may be in either order                |
+\*---------------------------------------------------------*/
+static bool ProfileModeEntryFits(const ProfileModeEntry& mode_entry, const mode& live_mode)
+{
+    unsigned int speed_low  = std::min(live_mode.speed_min, live_mode.speed_max);
+    unsigned int speed_high = std::max(live_mode.speed_min, live_mode.speed_max);
+
+    if((mode_entry.value != live_mode.value)
+     ||(mode_entry.flags != live_mode.flags))
+    {
+        return(false);
+    }
+
+    if((live_mode.flags & MODE_FLAG_HAS_SPEED)
+    && ((mode_entry.speed < speed_low) || (mode_entry.speed > speed_high)))
+    {
+        return(false);
+    }
+
+    return((mode_entry.num_colors >= live_mode.colors_min)
+        && (mode_entry.num_colors <= live_mode.colors_max));
+}
+
+static void AppendProfileData(std::vector<unsigned char>& profile_data, const void * data, std::size_t size)
+{
+    const unsigned char * bytes = (const unsigned char *)data;
+
+    profile_data.insert(profile_data.end(), bytes, bytes + size);
+}
+
 ProfileManager::ProfileManager(std::vector<RGBController *>& control) : controllers(control)
 {
     UpdateProfileList();
@@ -15,7 +157,10 @@ ProfileManager::ProfileManager(std::vector<RGBController *>& control) : controll
 
 ProfileManager::~ProfileManager()
 {
-
+    for(std::map<std::string, ProfileScene *>::iterator it = scene_cache.begin(); it != scene_cache.end(); it++)
+    {
+        delete it->second;
+    }
 }
 
 bool ProfileManager::SaveProfile(std::string profile_name)
@@ -31,32 +176,101 @@ bool ProfileManager::SaveProfile(std::string profile_name)
         std::ofstream controller_file(profile_name, std::ios::out | std::ios::binary);
 
         /*---------------------------------------------------------*\
-        | Write header                                              |
+        | Build the profile in memory, starting with the header     |
+        | and an empty index which is filled in per controller     |
         | 16 bytes - "OPENRGB_PROFILE"                              |
         | 4 bytes - Version, unsigned int                           |
+        | 4 bytes - Number of devices, unsigned int                 |
         \*---------------------------------------------------------*/
-        unsigned int profile_version = 1;
-        controller_file.write("OPENRGB_PROFILE", 16);
-        controller_file.write((char *)&profile_version, sizeof(unsigned int));
+        unsigned int                profile_version = PROFILE_VERSION;
+        unsigned int                num_devices     = controllers.size();
+        std::vector<unsigned char>  profile_data(PROFILE_HEADER_SIZE + (num_devices * sizeof(ProfileIndexEntry)), 0);
+
+        memcpy(&profile_data[0], "OPENRGB_PROFILE", 16);
+        memcpy(&profile_data[16], &profile_version, sizeof(unsigned int));
+        memcpy(&profile_data[20], &num_devices, sizeof(unsigned int));
 
         /*---------------------------------------------------------*\
         | Write controller data for each controller                 |
         \*---------------------------------------------------------*/
         for(std::size_t controller_index = 0; controller_index < controllers.size(); controller_index++)
         {
-            unsigned char *controller_data = controllers[controller_index]->GetDeviceDescription();
-            unsigned int controller_size;
+            RGBController *     controller_ptr = controllers[controller_index];
+            ProfileIndexEntry   entry;
+
+            memset(&entry, 0, sizeof(entry));
+
+            entry.hash          = GetControllerHash(controller_ptr);
+            entry.active_mode   = controller_ptr->active_mode;
+
+            /*---------------------------------------------------------*\
+            | Zone section                                              |
+            \*---------------------------------------------------------*/
+            entry.num_zones     = controller_ptr->zones.size();
+            entry.zones_offset  = profile_data.size();
+
+            for(std::size_t zone_idx = 0; zone_idx < controller_ptr->zones.size(); zone_idx++)
+            {
+                ProfileZoneEntry zone_entry;
+
+                zone_entry.type         = controller_ptr->zones[zone_idx].type;
+                zone_entry.leds_min     = controller_ptr->zones[zone_idx].leds_min;
+                zone_entry.leds_max     = controller_ptr->zones[zone_idx].leds_max;
+                zone_entry.leds_count   = controller_ptr->zones[zone_idx].leds_count;
 
-            memcpy(&controller_size, controller_data, sizeof(controller_size));
+                AppendProfileData(profile_data, &zone_entry, sizeof(zone_entry));
+            }
+
+            /*---------------------------------------------------------*\
+            | Mode section, entries followed by their colors            |
+            \*---------------------------------------------------------*/
+            entry.num_modes     = controller_ptr->modes.size();
+            entry.modes_offset  = profile_data.size();
 
-            controller_file.write((const char *)controller_data, controller_size);
+            profile_data.resize(profile_data.size() + (entry.num_modes * sizeof(ProfileModeEntry)), 0);
+
+            for(std::size_t mode_idx = 0; mode_idx < controller_ptr->modes.size(); mode_idx++)
+            {
+                ProfileModeEntry mode_entry;
+
+                mode_entry.value        = controller_ptr->modes[mode_idx].value;
+                mode_entry.flags        = controller_ptr->modes[mode_idx].flags;
+                mode_entry.speed        = controller_ptr->modes[mode_idx].speed;
+                mode_entry.direction    = controller_ptr->modes[mode_idx].direction;
+                mode_entry.color_mode   = controller_ptr->modes[mode_idx].color_mode;
+                mode_entry.num_colors   = controller_ptr->modes[mode_idx].colors.size();
+                mode_entry.colors_offset= profile_data.size();
+
+                AppendProfileData(profile_data, controller_ptr->modes[mode_idx].colors.data(), mode_entry.num_colors * sizeof(RGBColor));
+
+                memcpy(&profile_data[entry.modes_offset + (mode_idx * sizeof(ProfileModeEntry))], &mode_entry, sizeof(mode_entry));
+            }
+
+            /*---------------------------------------------------------*\
+            | Color section, the last frame written rather than colors, |
+            | which the device thread may not have caught up to yet     |
+            \*---------------------------------------------------------*/
+            std::vector<RGBColor> frame = controller_ptr->GetLEDs();
+
+            entry.num_colors    = frame.size();
+            entry.colors_offset = profile_data.size();
+
+            AppendProfileData(profile_data, frame.data(), entry.num_colors * sizeof(RGBColor));
+
+            memcpy(&profile_data[PROFILE_HEADER_SIZE + (controller_index * sizeof(ProfileIndexEntry))], &entry, sizeof(entry));
         }
 
+        controller_file.write((const char *)profile_data.data(), profile_data.size());
+
         /*---------------------------------------------------------*\
         | Close the file when done                                  |
         \*---------------------------------------------------------*/
         controller_file.close();
 
+        SceneMutex.lock();
+        InvalidateScene(profile_name);
+        SceneMutex.unlock();
+
         /*---------------------------------------------------------*\
         | Update the profile list                                   |
         \*---------------------------------------------------------*/
@@ -72,21 +286,41 @@ bool ProfileManager::SaveProfile(std::string profile_name)
 
 bool ProfileManager::LoadProfile(std::string profile_name)
 {
-    return(LoadProfileWithOptions(profile_name, false, true));
+    return(LoadProfileWithOptions(profile_name, false, true, false));
 }
 
 bool ProfileManager::LoadSizeFromProfile(std::string profile_name)
 {
-    return(LoadProfileWithOptions(profile_name, true, false));
+    return(LoadProfileWithOptions(profile_name, true, false, false));
+}
+
+bool ProfileManager::ActivateProfile(std::string profile_name)
+{
+    return(LoadProfileWithOptions(profile_name, false, true, true));
 }
 
 bool ProfileManager::LoadProfileWithOptions
     (
     std::string     profile_name,
     bool            load_size,
-    bool            load_settings
+    bool            load_settings,
+    bool            activate
     )
 {
+    /*---------------------------------------------------------*\
+    | v2 profiles are applied from the scene cache              |
+    \*---------------------------------------------------------*/
+    {
+        std::lock_guard<std::mutex> lock(SceneMutex);
+
+        ProfileScene* scene = GetScene(profile_name);
+
+        if(scene != NULL)
+        {
+            return(ApplyScene(scene, load_size, load_settings, activate));
+        }
+    }
+
     std::vector<RGBController*> temp_controllers;
     std::vector<bool>           temp_controller_used;
     unsigned int                controller_size;
@@ -123,6 +357,15 @@ bool ProfileManager::LoadProfileWithOptions
             {
                 controller_file.read((char *)&controller_size, sizeof(controller_size));
 
+                /*---------------------------------------------------------*\
+                | A truncated or zero size entry can't be skipped over,     |
+                | stop reading the file there                               |
+                \*---------------------------------------------------------*/
+                if(!controller_file || (controller_size < (2 * sizeof(unsigned int))))
+                {
+                    break;
+                }
+
                 unsigned char *controller_data = new unsigned char[controller_size];
 
                 controller_file.seekg(controller_offset);
@@ -131,10 +374,15 @@ bool ProfileManager::LoadProfileWithOptions
 
                 RGBController_Dummy *temp_controller = new RGBController_Dummy();
 
-                temp_controller->ReadDeviceDescription(controller_data);
-
-                temp_controllers.push_back(temp_controller);
-                temp_controller_used.push_back(false);
+                if(temp_controller->ReadDeviceDescription(controller_data, controller_file.gcount()))
+                {
+                    temp_controllers.push_back(temp_controller);
+                    temp_controller_used.push_back(false);
+                }
+                else
+                {
+                    delete temp_controller;
+                }
 
                 delete[] controller_data;
 
@@ -230,10 +478,14 @@ bool ProfileManager::LoadProfileWithOptions
                             \*---------------------------------------------------------*/
                             if(temp_controller->colors.size() == controller_ptr->colors.size())
                             {
+                                RGBColor* frame = controller_ptr->BeginFrame();
+
                                 for(std::size_t color_index = 0; color_index < temp_controller->colors.size(); color_index++)
                                 {
-                                    controller_ptr->colors[color_index] = temp_controller->colors[color_index];
+                                    frame[color_index] = temp_controller->colors[color_index];
                                 }
+
+                                controller_ptr->PublishFrame();
                             }
 
                             temp_controller_used[temp_index] = true;
@@ -246,13 +498,297 @@ bool ProfileManager::LoadProfileWithOptions
         }
     }
 
+    /*---------------------------------------------------------*\
+    | Queue the new settings on every device                    |
+    \*---------------------------------------------------------*/
+    if(ret_val && activate)
+    {
+        for(std::size_t controller_index = 0; controller_index < controllers.size(); controller_index++)
+        {
+            RGBController *controller_ptr = controllers[controller_index];
+
+            controller_ptr->ForceUpdateMode();
+
+            if(controller_ptr->modes.size() > (std::size_t)controller_ptr->active_mode
+            && controller_ptr->modes[controller_ptr->active_mode].color_mode == MODE_COLORS_PER_LED)
+            {
+                controller_ptr->UpdateLEDs();
+            }
+        }
+    }
+
+    /*---------------------------------------------------------*\
+    | Free the temporary controllers                            |
+    \*---------------------------------------------------------*/
+    for(std::size_t temp_index = 0; temp_index < temp_controllers.size(); temp_index++)
+    {
+        delete temp_controllers[temp_index];
+    }
+
     return(ret_val);
 }
 
+ProfileScene* ProfileManager::GetScene(std::string profile_name)
+{
+    /*---------------------------------------------------------*\
+    | Use the cached scene if the file hasn't changed           |
+    \*---------------------------------------------------------*/
+    std::error_code     ec;
+    fs::file_time_type  write_time  = fs::last_write_time(profile_name, ec);
+
+    if(ec)
+    {
+        InvalidateScene(profile_name);
+        return(NULL);
+    }
+
+    unsigned long long  file_size   = fs::file_size(profile_name, ec);
+    long long           mtime       = write_time.time_since_epoch().count();
+
+    std::map<std::string, ProfileScene *>::iterator it = scene_cache.find(profile_name);
+
+    if(it != scene_cache.end())
+    {
+        if(it->second->mtime == mtime && it->second->size == file_size)
+        {
+            return(it->second);
+        }
+
+        InvalidateScene(profile_name);
+    }
+
+    /*---------------------------------------------------------*\
+    | Only v2 profiles are cached                               |
+    \*---------------------------------------------------------*/
+    ProfileFileMap profile_file(profile_name);
+
+    if(profile_file.data == NULL || profile_file.size < PROFILE_HEADER_SIZE)
+    {
+        return(NULL);
+    }
+
+    unsigned int header_version;
+    unsigned int num_devices;
+
+    memcpy(&header_version, &profile_file.data[16], sizeof(unsigned int));
+    memcpy(&num_devices, &profile_file.data[20], sizeof(unsigned int));
+
+    if((memcmp(profile_file.data, "OPENRGB_PROFILE", 16) != 0)
+     ||(header_version != PROFILE_VERSION)
+     ||(!ProfileDataContains(profile_file.size, PROFILE_HEADER_SIZE, num_devices, sizeof(ProfileIndexEntry))))
+    {
+        return(NULL);
+    }
+
+    ProfileScene* scene = new ProfileScene();
+
+    scene->mtime    = mtime;
+    scene->size     = file_size;
+    scene->data.assign(profile_file.data, profile_file.data + profile_file.size);
+
+    /*---------------------------------------------------------*\
+    | Index every entry whose sections are all in bounds.       |
+    | Identical devices share a hash, so keep a list per hash   |
+    | and hand out entries in file order                        |
+    \*---------------------------------------------------------*/
+    const unsigned char *       data    = scene->data.data();
+    const ProfileIndexEntry *   index   = (const ProfileIndexEntry *)&data[PROFILE_HEADER_SIZE];
+
+    for(unsigned int entry_idx = 0; entry_idx < num_devices; entry_idx++)
+    {
+        const ProfileIndexEntry& entry = index[entry_idx];
+
+        bool valid = ProfileDataContains(scene->data.size(), entry.zones_offset, entry.num_zones, sizeof(ProfileZoneEntry))
+                  && ProfileDataContains(scene->data.size(), entry.modes_offset, entry.num_modes, sizeof(ProfileModeEntry))
+                  && ProfileDataContains(scene->data.size(), entry.colors_offset, entry.num_colors, sizeof(RGBColor));
+
+        if(valid)
+        {
+            const ProfileModeEntry * mode_entries = (const ProfileModeEntry *)&data[entry.modes_offset];
+
+            for(unsigned int mode_idx = 0; mode_idx < entry.num_modes; mode_idx++)
+            {
+                valid = valid && ProfileDataContains(scene->data.size(), mode_entries[mode_idx].colors_offset, mode_entries[mode_idx].num_colors, sizeof(RGBColor));
+            }
+        }
+
+        if(valid)
+        {
+            scene->index_map[entry.hash].push_back(entry_idx);
+        }
+    }
+
+    scene_cache[profile_name] = scene;
+
+    return(scene);
+}
+
+void ProfileManager::InvalidateScene(std::string profile_name)
+{
+    std::map<std::string, ProfileScene *>::iterator it = scene_cache.find(profile_name);
+
+    if(it != scene_cache.end())
+    {
+        delete it->second;
+        scene_cache.erase(it);
+    }
+}
+
+bool ProfileManager::ApplyScene
+    (
+    ProfileScene*   scene,
+    bool            load_size,
+    bool            load_settings,
+    bool            activate
+    )
+{
+    const unsigned char *       data    = scene->data.data();
+    const ProfileIndexEntry *   index   = (const ProfileIndexEntry *)&data[PROFILE_HEADER_SIZE];
+
+    std::unordered_map<unsigned long long, std::size_t> index_used;
+
+    for(std::size_t controller_index = 0; controller_index < controllers.size(); controller_index++)
+    {
+        RGBController *     controller_ptr  = controllers[controller_index];
+        unsigned long long  hash            = GetControllerHash(controller_ptr);
+
+        std::unordered_map<unsigned long long, std::vector<unsigned int>>::iterator it = scene->index_map.find(hash);
+
+        if(it == scene->index_map.end() || index_used[hash] >= it->second.size())
+        {
+            continue;
+        }
+
+        const ProfileIndexEntry& entry = index[it->second[index_used[hash]++]];
+
+        /*---------------------------------------------------------*\
+        | Update zone sizes if requested                            |
+        \*---------------------------------------------------------*/
+        if(load_size && entry.num_zones == controller_ptr->zones.size())
+        {
+            const ProfileZoneEntry * zone_entries = (const ProfileZoneEntry *)&data[entry.zones_offset];
+
+            for(std::size_t zone_idx = 0; zone_idx < entry.num_zones; zone_idx++)
+            {
+                if((zone_entries[zone_idx].type       == (unsigned int)controller_ptr->zones[zone_idx].type)
+                 &&(zone_entries[zone_idx].leds_min   == controller_ptr->zones[zone_idx].leds_min          )
+                 &&(zone_entries[zone_idx].leds_max   == controller_ptr->zones[zone_idx].leds_max          )
+                 &&(zone_entries[zone_idx].leds_count != controller_ptr->zones[zone_idx].leds_count        ))
+                {
+                    controller_ptr->ResizeZone(zone_idx, zone_entries[zone_idx].leds_count);
+                }
+            }
+        }
+
+        /*---------------------------------------------------------*\
+        | Update settings if requested                              |
+        \*---------------------------------------------------------*/
+        if(load_settings)
+        {
+            /*---------------------------------------------------------*\
+            | Update all modes                                          |
+            \*---------------------------------------------------------*/
+            if(entry.num_modes == controller_ptr->modes.size())
+            {
+                const ProfileModeEntry * mode_entries = (const ProfileModeEntry *)&data[entry.modes_offset];
+
+                for(std::size_t mode_index = 0; mode_index < entry.num_modes; mode_index++)
+                {
+                    const ProfileModeEntry& mode_entry = mode_entries[mode_index];
+
+                    if(ProfileModeEntryFits(mode_entry, controller_ptr->modes[mode_index]))
+                    {
+                        controller_ptr->modes[mode_index].speed      = mode_entry.speed;
+                        controller_ptr->modes[mode_index].direction  = mode_entry.direction;
+                        controller_ptr->modes[mode_index].color_mode = mode_entry.color_mode;
+
+                        controller_ptr->modes[mode_index].colors.resize(mode_entry.num_colors);
+
+                        memcpy(controller_ptr->modes[mode_index].colors.data(), &data[mode_entry.colors_offset], mode_entry.num_colors * sizeof(RGBColor));
+                    }
+                }
+
+                if(entry.active_mode < controller_ptr->modes.size())
+                {
+                    controller_ptr->active_mode = entry.active_mode;
+                }
+            }
+
+            /*---------------------------------------------------------*\
+            | Update all colors                                         |
+            \*---------------------------------------------------------*/
+            if(entry.num_colors == controller_ptr->colors.size())
+            {
+                RGBColor* frame = controller_ptr->BeginFrame();
+
+                memcpy(frame, &data[entry.colors_offset], entry.num_colors * sizeof(RGBColor));
+
+                controller_ptr->PublishFrame();
+            }
+
+            /*---------------------------------------------------------*\
+            | Queue the new settings on the device's call thread.  All  |
+            | devices are queued before any of them is waited on, so    |
+            | the hardware writes run in parallel                       |
+            \*---------------------------------------------------------*/
+            if(activate)
+            {
+                controller_ptr->ForceUpdateMode();
+
+                if(controller_ptr->modes.size() > (std::size_t)controller_ptr->active_mode
+                && controller_ptr->modes[controller_ptr->active_mode].color_mode == MODE_COLORS_PER_LED)
+                {
+                    controller_ptr->UpdateLEDs();
+                }
+            }
+        }
+    }
+
+    return(true);
+}
+
+unsigned long long ProfileManager::GetControllerHash(RGBController* controller)
+{
+    /*---------------------------------------------------------*\
+    | 64-bit FNV-1a over type, name, location and serial.  The  |
+    | strings are hashed with their terminators so that fields  |
+    | can't run into each other                                 |
+    \*---------------------------------------------------------*/
+    unsigned long long  hash = 0xCBF29CE484222325ULL;
+    unsigned int        type = controller->type;
+
+    const unsigned char * type_bytes = (const unsigned char *)&type;
+
+    for(std::size_t byte_idx = 0; byte_idx < sizeof(type); byte_idx++)
+    {
+        hash ^= type_bytes[byte_idx];
+        hash *= 0x100000001B3ULL;
+    }
+
+    const std::string * fields[3] = { &controller->name, &controller->location, &controller->serial };
+
+    for(std::size_t field_idx = 0; field_idx < 3; field_idx++)
+    {
+        const char * str = fields[field_idx]->c_str();
+
+        for(std::size_t char_idx = 0; char_idx <= fields[field_idx]->size(); char_idx++)
+        {
+            hash ^= (unsigned char)str[char_idx];
+            hash *= 0x100000001B3ULL;
+        }
+    }
+
+    return(hash);
+}
+
 void ProfileManager::DeleteProfile(std::string profile_name)
 {
     remove(profile_name.c_str());
 
+    SceneMutex.lock();
+    InvalidateScene(profile_name);
+    SceneMutex.unlock();
+
     UpdateProfileList();
 }
 
@@ -285,13 +821,23 @@ void ProfileManager::UpdateProfileList()
 
             if(strcmp(header_string, "OPENRGB_PROFILE") == 0)
             {
-                if(header_version == 1)
+                if(header_version == 1 || header_version == PROFILE_VERSION)
                 {
                     /*---------------------------------------------------------*\
                     | Add this profile to the list                              |
                     \*---------------------------------------------------------*/
                     profile_list.push_back(filename);
                 }
+
+                /*---------------------------------------------------------*\
+                | Parse v2 profiles now so switching to them is instant     |
+                \*---------------------------------------------------------*/
+                if(header_version == PROFILE_VERSION)
+                {
+                    SceneMutex.lock();
+                    GetScene(filename);
+                    SceneMutex.unlock();
+                }
             }
 
             profile_file.close();
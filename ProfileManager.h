@@ -1,7 +1,72 @@
 #include "RGBController.h"
 
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
 #pragma once
 
+/*---------------------------------------------------------*\
+| Profile format v2                                         |
+|                                                           |
+| 16 bytes  - "OPENRGB_PROFILE"                             |
+| 4 bytes   - Version (2), unsigned int                     |
+| 4 bytes   - Number of devices, unsigned int               |
+| Index     - ProfileIndexEntry for each device             |
+| Data      - Zone, mode and color sections referenced by   |
+|             the index.  All offsets are from the start of |
+|             the file and all sections are 4-byte aligned  |
+|             so the file can be memory mapped and colors   |
+|             copied directly                               |
+\*---------------------------------------------------------*/
+#define PROFILE_VERSION             2
+#define PROFILE_HEADER_SIZE         24
+
+typedef struct
+{
+    unsigned long long  hash;                           /* GetControllerHash() of the device    */
+    unsigned int        active_mode;                    /* Active mode index                    */
+    unsigned int        num_zones;                      /* Number of ProfileZoneEntry           */
+    unsigned int        zones_offset;                   /* Offset of ProfileZoneEntry array     */
+    unsigned int        num_modes;                      /* Number of ProfileModeEntry           */
+    unsigned int        modes_offset;                   /* Offset of ProfileModeEntry array     */
+    unsigned int        num_colors;                     /* Number of LED colors                 */
+    unsigned int        colors_offset;                  /* Offset of RGBColor array             */
+    unsigned int        reserved;
+} ProfileIndexEntry;
+
+typedef struct
+{
+    unsigned int        type;                           /* zone_type                            */
+    unsigned int        leds_min;                       /* Minimum zone size                    */
+    unsigned int        leds_max;                       /* Maximum zone size                    */
+    unsigned int        leds_count;                     /* Saved zone size                      */
+} ProfileZoneEntry;
+
+typedef struct
+{
+    int                 value;                          /* Device-specific mode value           */
+    unsigned int        flags;                          /* Mode flags                           */
+    unsigned int        speed;                          /* Saved speed                          */
+    unsigned int        direction;                      /* Saved direction                      */
+    unsigned int        color_mode;                     /* Saved color mode                     */
+    unsigned int        num_colors;                     /* Number of mode colors                */
+    unsigned int        colors_offset;                  /* Offset of RGBColor array             */
+} ProfileModeEntry;
+
+/*---------------------------------------------------------*\
+| Parsed v2 profile kept in memory.  The data has already   |
+| been bounds-checked, so applying it is a hash lookup and  |
+| a copy per device                                         |
+\*---------------------------------------------------------*/
+typedef struct
+{
+    long long                                                           mtime;      /* File write time when parsed      */
+    unsigned long long                                                  size;       /* File size when parsed            */
+    std::vector<unsigned char>                                          data;       /* Profile file contents            */
+    std::unordered_map<unsigned long long, std::vector<unsigned int>>   index_map;  /* Device hash to index entries     */
+} ProfileScene;
+
 class ProfileManager
 {
 public:
@@ -11,19 +76,35 @@ public:
     bool SaveProfile(std::string profile_name);
     bool LoadProfile(std::string profile_name);
     bool LoadSizeFromProfile(std::string profile_name);
+    bool ActivateProfile(std::string profile_name);
     void DeleteProfile(std::string profile_name);
 
     std::vector<std::string> profile_list;
+
+    static unsigned long long GetControllerHash(RGBController* controller);
     
 protected:
     std::vector<RGBController *>& controllers;
 
 private:
+    std::mutex                              SceneMutex;
+    std::map<std::string, ProfileScene *>   scene_cache;
+
     void UpdateProfileList();
+    ProfileScene* GetScene(std::string profile_name);
+    void InvalidateScene(std::string profile_name);
     bool LoadProfileWithOptions
             (
             std::string     profile_name,
             bool            load_size,
-            bool            load_settings
+            bool            load_settings,
+            bool            activate
+            );
+    bool ApplyScene
+            (
+            ProfileScene*   scene,
+            bool            load_size,
+            bool            load_settings,
+            bool            activate
             );
 };
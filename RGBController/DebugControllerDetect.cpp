@@ -471,10 +471,7 @@ void DetectDebugControllers(std::vector<RGBController*> &rgb_controllers)
                         dummy_keyboard_matrix_zone.leds_min              = 106;
                         dummy_keyboard_matrix_zone.leds_max              = 106;
                         dummy_keyboard_matrix_zone.leds_count            = 106;
-                        dummy_keyboard_matrix_zone.matrix_map            = new matrix_map_type;
-                        dummy_keyboard_matrix_zone.matrix_map->height    = 6;
-                        dummy_keyboard_matrix_zone.matrix_map->width     = 23;
-                        dummy_keyboard_matrix_zone.matrix_map->map       = (unsigned int*)&debug_keyboard_matrix_map;
+                        dummy_keyboard_matrix_zone.matrix_map            = dummy_keyboard->NewMatrixMap(6, 23, (unsigned int *)&debug_keyboard_matrix_map);
 
                         dummy_keyboard->zones.push_back(dummy_keyboard_matrix_zone);
 
@@ -0,0 +1,353 @@
+/*-----------------------------------------*\
+|  RGBColorTransform.cpp                    |
+|                                           |
+|  Conversions from the RGBColor buffer to  |
+|  device byte layouts for use in drivers   |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "RGBColorTransform.h"
+
+/*---------------------------------------------------------*\
+| SSE2 is part of the x86-64 baseline.  SSSE3 is selected   |
+| at runtime, so it is only used on compilers that can      |
+| build single functions for it                             |
+\*---------------------------------------------------------*/
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RGBCOLOR_TRANSFORM_SSE2
+#include <emmintrin.h>
+
+#if defined(__GNUC__) || defined(_MSC_VER)
+#define RGBCOLOR_TRANSFORM_SSSE3
+#include <tmmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define RGBCOLOR_TRANSFORM_TARGET_SSSE3
+#else
+#define RGBCOLOR_TRANSFORM_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+#endif
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define RGBCOLOR_TRANSFORM_NEON
+#include <arm_neon.h>
+#endif
+
+/*---------------------------------------------------------*\
+| Byte offset of red, green and blue within an RGBColor in  |
+| memory, for each output position of each order            |
+\*---------------------------------------------------------*/
+static const unsigned char order_offsets[6][3] =
+{
+    { 0, 1, 2 },        /* RGB_ORDER_RGB                    */
+    { 0, 2, 1 },        /* RGB_ORDER_RBG                    */
+    { 1, 0, 2 },        /* RGB_ORDER_GRB                    */
+    { 1, 2, 0 },        /* RGB_ORDER_GBR                    */
+    { 2, 0, 1 },        /* RGB_ORDER_BRG                    */
+    { 2, 1, 0 },        /* RGB_ORDER_BGR                    */
+};
+
+/*---------------------------------------------------------*\
+| Round c * brightness / 255 to the nearest integer         |
+\*---------------------------------------------------------*/
+static inline unsigned int ScaleChannel(unsigned int c, unsigned int brightness)
+{
+    unsigned int t = (c * brightness) + 128;
+
+    return((t + (t >> 8)) >> 8);
+}
+
+#ifdef RGBCOLOR_TRANSFORM_SSSE3
+static bool HasSSSE3()
+{
+#ifdef _MSC_VER
+    int info[4];
+
+    __cpuid(info, 1);
+
+    return((info[2] & (1 << 9)) != 0);
+#else
+    return(__builtin_cpu_supports("ssse3"));
+#endif
+}
+
+static const bool use_ssse3 = HasSSSE3();
+
+RGBCOLOR_TRANSFORM_TARGET_SSSE3
+static std::size_t RGBColorsToBytesSSSE3
+    (
+    const RGBColor*     colors,
+    std::size_t         count,
+    unsigned char*      out,
+    int                 order
+    )
+{
+    /*---------------------------------------------------------*\
+    | Shuffle 4 colors into 12 bytes.  Each 16 byte store runs  |
+    | 4 bytes past the data it writes, so stop while at least 6 |
+    | colors remain and leave the tail to the scalar loop       |
+    \*---------------------------------------------------------*/
+    char shuffle[16];
+
+    for(int pixel = 0; pixel < 4; pixel++)
+    {
+        for(int channel = 0; channel < 3; channel++)
+        {
+            shuffle[(pixel * 3) + channel] = (char)((pixel * 4) + order_offsets[order][channel]);
+        }
+    }
+
+    for(int pad = 12; pad < 16; pad++)
+    {
+        shuffle[pad] = (char)0x80;
+    }
+
+    __m128i     mask    = _mm_loadu_si128((const __m128i *)shuffle);
+    std::size_t idx     = 0;
+
+    for(; idx + 6 <= count; idx += 4)
+    {
+        __m128i pixels = _mm_loadu_si128((const __m128i *)&colors[idx]);
+
+        _mm_storeu_si128((__m128i *)&out[idx * 3], _mm_shuffle_epi8(pixels, mask));
+    }
+
+    return(idx);
+}
+#endif
+
+void RGBColorsToBytes
+    (
+    const RGBColor*     colors,
+    std::size_t         count,
+    unsigned char*      out,
+    int                 order
+    )
+{
+    std::size_t idx = 0;
+
+    if(order < RGB_ORDER_RGB || order > RGB_ORDER_BGR)
+    {
+        order = RGB_ORDER_RGB;
+    }
+
+#if defined(RGBCOLOR_TRANSFORM_NEON)
+    for(; idx + 16 <= count; idx += 16)
+    {
+        uint8x16x4_t pixels = vld4q_u8((const uint8_t *)&colors[idx]);
+        uint8x16x3_t bytes;
+
+        bytes.val[0] = pixels.val[order_offsets[order][0]];
+        bytes.val[1] = pixels.val[order_offsets[order][1]];
+        bytes.val[2] = pixels.val[order_offsets[order][2]];
+
+        vst3q_u8(&out[idx * 3], bytes);
+    }
+#elif defined(RGBCOLOR_TRANSFORM_SSSE3)
+    if(use_ssse3)
+    {
+        idx = RGBColorsToBytesSSSE3(colors, count, out, order);
+    }
+#endif
+
+    const unsigned char * offsets = order_offsets[order];
+
+    for(; idx < count; idx++)
+    {
+        RGBColor color = colors[idx];
+
+        out[(idx * 3) + 0] = (color >> (offsets[0] * 8)) & 0xFF;
+        out[(idx * 3) + 1] = (color >> (offsets[1] * 8)) & 0xFF;
+        out[(idx * 3) + 2] = (color >> (offsets[2] * 8)) & 0xFF;
+    }
+}
+
+void RGBColorsToPlanar
+    (
+    const RGBColor*     colors,
+    std::size_t         count,
+    unsigned char*      red,
+    unsigned char*      grn,
+    unsigned char*      blu
+    )
+{
+    std::size_t idx = 0;
+
+#if defined(RGBCOLOR_TRANSFORM_NEON)
+    for(; idx + 16 <= count; idx += 16)
+    {
+        uint8x16x4_t pixels = vld4q_u8((const uint8_t *)&colors[idx]);
+
+        vst1q_u8(&red[idx], pixels.val[0]);
+        vst1q_u8(&grn[idx], pixels.val[1]);
+        vst1q_u8(&blu[idx], pixels.val[2]);
+    }
+#elif defined(RGBCOLOR_TRANSFORM_SSE2)
+    const __m128i mask = _mm_set1_epi32(0xFF);
+
+    for(; idx + 16 <= count; idx += 16)
+    {
+        __m128i p0 = _mm_loadu_si128((const __m128i *)&colors[idx + 0]);
+        __m128i p1 = _mm_loadu_si128((const __m128i *)&colors[idx + 4]);
+        __m128i p2 = _mm_loadu_si128((const __m128i *)&colors[idx + 8]);
+        __m128i p3 = _mm_loadu_si128((const __m128i *)&colors[idx + 12]);
+
+        /*---------------------------------------------------------*\
+        | Each channel is isolated in the low byte of every 32-bit  |
+        | lane, then packed down to 16 bytes                        |
+        \*---------------------------------------------------------*/
+        for(int channel = 0; channel < 3; channel++)
+        {
+            __m128i c0 = _mm_and_si128(p0, mask);
+            __m128i c1 = _mm_and_si128(p1, mask);
+            __m128i c2 = _mm_and_si128(p2, mask);
+            __m128i c3 = _mm_and_si128(p3, mask);
+
+            __m128i packed = _mm_packus_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3));
+
+            unsigned char * dest = (channel == 0) ? red : ((channel == 1) ? grn : blu);
+
+            _mm_storeu_si128((__m128i *)&dest[idx], packed);
+
+            p0 = _mm_srli_epi32(p0, 8);
+            p1 = _mm_srli_epi32(p1, 8);
+            p2 = _mm_srli_epi32(p2, 8);
+            p3 = _mm_srli_epi32(p3, 8);
+        }
+    }
+#endif
+
+    for(; idx < count; idx++)
+    {
+        red[idx] = RGBGetRValue(colors[idx]);
+        grn[idx] = RGBGetGValue(colors[idx]);
+        blu[idx] = RGBGetBValue(colors[idx]);
+    }
+}
+
+void RGBColorsToPlanarIndexed
+    (
+    const RGBColor*     colors,
+    std::size_t         count,
+    const unsigned int* index,
+    unsigned char*      red,
+    unsigned char*      grn,
+    unsigned char*      blu
+    )
+{
+    /*---------------------------------------------------------*\
+    | Scattered stores don't vectorize on SSE2 or NEON          |
+    \*---------------------------------------------------------*/
+    for(std::size_t idx = 0; idx < count; idx++)
+    {
+        RGBColor color = colors[idx];
+
+        red[index[idx]] = RGBGetRValue(color);
+        grn[index[idx]] = RGBGetGValue(color);
+        blu[index[idx]] = RGBGetBValue(color);
+    }
+}
+
+void RGBColorsScale
+    (
+    const RGBColor*     in,
+    std::size_t         count,
+    RGBColor*           out,
+    unsigned char       brightness
+    )
+{
+    std::size_t idx = 0;
+
+#if defined(RGBCOLOR_TRANSFORM_NEON)
+    const uint8x8_t scale = vdup_n_u8(brightness);
+
+    for(; idx + 16 <= count; idx += 16)
+    {
+        uint8x16x4_t pixels = vld4q_u8((const uint8_t *)&in[idx]);
+
+        for(int channel = 0; channel < 3; channel++)
+        {
+            uint16x8_t lo = vmull_u8(vget_low_u8(pixels.val[channel]), scale);
+            uint16x8_t hi = vmull_u8(vget_high_u8(pixels.val[channel]), scale);
+
+            /*---------------------------------------------------------*\
+            | (p + ((p + 128) >> 8) + 128) >> 8, same as ScaleChannel   |
+            \*---------------------------------------------------------*/
+            pixels.val[channel] = vcombine_u8(vrshrn_n_u16(vrsraq_n_u16(lo, lo, 8), 8),
+                                              vrshrn_n_u16(vrsraq_n_u16(hi, hi, 8), 8));
+        }
+
+        pixels.val[3] = vdupq_n_u8(0);
+
+        vst4q_u8((uint8_t *)&out[idx], pixels);
+    }
+#elif defined(RGBCOLOR_TRANSFORM_SSE2)
+    const __m128i zero      = _mm_setzero_si128();
+    const __m128i scale     = _mm_set1_epi16(brightness);
+    const __m128i round     = _mm_set1_epi16(128);
+    const __m128i rgb_mask  = _mm_set1_epi32(0x00FFFFFF);
+
+    for(; idx + 4 <= count; idx += 4)
+    {
+        __m128i pixels  = _mm_and_si128(_mm_loadu_si128((const __m128i *)&in[idx]), rgb_mask);
+
+        __m128i lo      = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(pixels, zero), scale), round);
+        __m128i hi      = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(pixels, zero), scale), round);
+
+        lo              = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi              = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+
+        _mm_storeu_si128((__m128i *)&out[idx], _mm_packus_epi16(lo, hi));
+    }
+#endif
+
+    for(; idx < count; idx++)
+    {
+        RGBColor color = in[idx];
+
+        unsigned int red = ScaleChannel(RGBGetRValue(color), brightness);
+        unsigned int grn = ScaleChannel(RGBGetGValue(color), brightness);
+        unsigned int blu = ScaleChannel(RGBGetBValue(color), brightness);
+
+        out[idx] = ToRGBColor(red, grn, blu);
+    }
+}
+
+void RGBColorsApplyLUT
+    (
+    const RGBColor*         in,
+    std::size_t             count,
+    RGBColor*               out,
+    const unsigned char*    lut_red,
+    const unsigned char*    lut_grn,
+    const unsigned char*    lut_blu
+    )
+{
+    /*---------------------------------------------------------*\
+    | Table lookups have no SSE2 or NEON form for 256 entries,  |
+    | so unroll to keep the loads independent                   |
+    \*---------------------------------------------------------*/
+    std::size_t idx = 0;
+
+    for(; idx + 4 <= count; idx += 4)
+    {
+        RGBColor c0 = in[idx + 0];
+        RGBColor c1 = in[idx + 1];
+        RGBColor c2 = in[idx + 2];
+        RGBColor c3 = in[idx + 3];
+
+        out[idx + 0] = ToRGBColor((unsigned int)lut_red[RGBGetRValue(c0)], (unsigned int)lut_grn[RGBGetGValue(c0)], (unsigned int)lut_blu[RGBGetBValue(c0)]);
+        out[idx + 1] = ToRGBColor((unsigned int)lut_red[RGBGetRValue(c1)], (unsigned int)lut_grn[RGBGetGValue(c1)], (unsigned int)lut_blu[RGBGetBValue(c1)]);
+        out[idx + 2] = ToRGBColor((unsigned int)lut_red[RGBGetRValue(c2)], (unsigned int)lut_grn[RGBGetGValue(c2)], (unsigned int)lut_blu[RGBGetBValue(c2)]);
+        out[idx + 3] = ToRGBColor((unsigned int)lut_red[RGBGetRValue(c3)], (unsigned int)lut_grn[RGBGetGValue(c3)], (unsigned int)lut_blu[RGBGetBValue(c3)]);
+    }
+
+    for(; idx < count; idx++)
+    {
+        RGBColor color = in[idx];
+
+        out[idx] = ToRGBColor((unsigned int)lut_red[RGBGetRValue(color)], (unsigned int)lut_grn[RGBGetGValue(color)], (unsigned int)lut_blu[RGBGetBValue(color)]);
+    }
+}
@@ -0,0 +1,91 @@
+/*-----------------------------------------*\
+|  RGBColorTransform.h                      |
+|                                           |
+|  Conversions from the RGBColor buffer to  |
+|  device byte layouts for use in drivers   |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#pragma once
+
+#include "RGBController.h"
+
+#include <cstddef>
+
+/*---------------------------------------------------------*\
+| Output byte orders for RGBColorsToBytes                   |
+\*---------------------------------------------------------*/
+enum
+{
+    RGB_ORDER_RGB               = 0,    /* Red, green, blue                 */
+    RGB_ORDER_RBG               = 1,    /* Red, blue, green                 */
+    RGB_ORDER_GRB               = 2,    /* Green, red, blue                 */
+    RGB_ORDER_GBR               = 3,    /* Green, blue, red                 */
+    RGB_ORDER_BRG               = 4,    /* Blue, red, green                 */
+    RGB_ORDER_BGR               = 5,    /* Blue, green, red                 */
+};
+
+/*---------------------------------------------------------*\
+| Write count colors as 3 bytes each in the given order     |
+\*---------------------------------------------------------*/
+void RGBColorsToBytes
+    (
+    const RGBColor*     colors,
+    std::size_t         count,
+    unsigned char*      out,
+    int                 order
+    );
+
+/*---------------------------------------------------------*\
+| Split count colors into separate red, green and blue      |
+| arrays                                                    |
+\*---------------------------------------------------------*/
+void RGBColorsToPlanar
+    (
+    const RGBColor*     colors,
+    std::size_t         count,
+    unsigned char*      red,
+    unsigned char*      grn,
+    unsigned char*      blu
+    );
+
+/*---------------------------------------------------------*\
+| Split count colors into separate red, green and blue      |
+| arrays, writing color i to position index[i]              |
+\*---------------------------------------------------------*/
+void RGBColorsToPlanarIndexed
+    (
+    const RGBColor*     colors,
+    std::size_t         count,
+    const unsigned int* index,
+    unsigned char*      red,
+    unsigned char*      grn,
+    unsigned char*      blu
+    );
+
+/*---------------------------------------------------------*\
+| Scale count colors by brightness / 255, rounded to the    |
+| nearest value.  in and out may be the same buffer         |
+\*---------------------------------------------------------*/
+void RGBColorsScale
+    (
+    const RGBColor*     in,
+    std::size_t         count,
+    RGBColor*           out,
+    unsigned char       brightness
+    );
+
+/*---------------------------------------------------------*\
+| Map each channel of count colors through a 256-entry      |
+| table.  in and out may be the same buffer                 |
+\*---------------------------------------------------------*/
+void RGBColorsApplyLUT
+    (
+    const RGBColor*         in,
+    std::size_t             count,
+    RGBColor*               out,
+    const unsigned char*    lut_red,
+    const unsigned char*    lut_grn,
+    const unsigned char*    lut_blu
+    );
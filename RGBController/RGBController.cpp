@@ -1,34 +1,39 @@
 #include "RGBController.h"
+#include "RGBDescriptionCodec.h"
 #include <cstring>
+#include <unordered_map>
 
 using namespace std::chrono_literals;
 
 RGBController::RGBController()
 {
+    matrix_map_chunk        = NULL;
+    matrix_map_chunk_used   = 0;
+
+    frame_write_idx         = 0;
+    frame_ready             = 1;
+    frame_read_idx          = 2;
+
+    applied_mode_idx        = -1;
+    applied_mode_valid      = false;
+    CallFlag_ForceMode      = false;
+    dedup_mode_updates      = true;
+
+    FrameStaged         = false;
     DeviceThreadRunning = true;
     DeviceCallThread = new std::thread(&RGBController::DeviceCallThreadFunction, this);
 }
 
 RGBController::~RGBController()
 {
-    DeviceThreadRunning = false;
-    DeviceCallThread->join();
-    delete DeviceCallThread;
+    StopDeviceThread();
 
     /*---------------------------------------------------------*\
-    | Delete the matrix map                                     |
+    | Free the matrix maps                                      |
     \*---------------------------------------------------------*/
-    for(unsigned int zone_index = 0; zone_index < zones.size(); zone_index++)
+    for(unsigned int chunk_index = 0; chunk_index < matrix_map_arena.size(); chunk_index++)
     {
-        if(zones[zone_index].matrix_map != NULL)
-        {
-            if(zones[zone_index].matrix_map->map != NULL)
-            {
-                delete[] zones[zone_index].matrix_map->map;
-            }
-
-            delete zones[zone_index].matrix_map;
-        }
+        delete[] matrix_map_arena[chunk_index];
     }
 }
 
@@ -421,393 +426,850 @@ unsigned char * RGBController::GetDeviceDescription()
     return(data_buf);
 }
 
-void RGBController::ReadDeviceDescription(unsigned char* data_buf)
+bool RGBController::ReadDeviceDescription(unsigned char* data_buf, unsigned int data_size)
 {
-    unsigned int data_ptr = 0;
-
-    data_ptr += sizeof(unsigned int);
-
     /*---------------------------------------------------------*\
-    | Copy in type                                              |
+    | The description starts with its own size and a format     |
+    | word, trust the size only as far as the caller's buffer   |
     \*---------------------------------------------------------*/
-    memcpy(&type, &data_buf[data_ptr], sizeof(device_type));
-    data_ptr += sizeof(device_type);
+    unsigned int description_size;
+    unsigned int format;
 
-    /*---------------------------------------------------------*\
-    | Copy in name                                              |
-    \*---------------------------------------------------------*/
-    unsigned short name_len;
-    memcpy(&name_len, &data_buf[data_ptr], sizeof(unsigned short));
-    data_ptr += sizeof(unsigned short);
+    if((data_buf == NULL) || (data_size < (2 * sizeof(unsigned int))))
+    {
+        return(false);
+    }
 
-    name = (char *)&data_buf[data_ptr];
-    data_ptr += name_len;
+    memcpy(&description_size, &data_buf[0], sizeof(description_size));
+    memcpy(&format, &data_buf[sizeof(description_size)], sizeof(format));
+
+    if(description_size < data_size)
+    {
+        data_size = description_size;
+    }
 
     /*---------------------------------------------------------*\
-    | Copy in description                                       |
+    | Hand compact descriptions to their own decoder            |
     \*---------------------------------------------------------*/
-    unsigned short description_len;
-    memcpy(&description_len, &data_buf[data_ptr], sizeof(unsigned short));
-    data_ptr += sizeof(unsigned short);
+    if(format == RGBCONTROLLER_COMPACT_MAGIC)
+    {
+        return(ReadDeviceDescriptionCompact(data_buf, data_size));
+    }
 
-    description = (char *)&data_buf[data_ptr];
-    data_ptr += description_len;
+    RGBDescriptionReader reader(data_buf, data_size);
 
-    /*---------------------------------------------------------*\
-    | Copy in version                                           |
-    \*---------------------------------------------------------*/
-    unsigned short version_len;
-    memcpy(&version_len, &data_buf[data_ptr], sizeof(unsigned short));
-    data_ptr += sizeof(unsigned short);
+    reader.Skip(sizeof(unsigned int));
 
-    version = (char *)&data_buf[data_ptr];
-    data_ptr += version_len;
-    
     /*---------------------------------------------------------*\
-    | Copy in serial                                            |
+    | Strings are sent with a length and a null terminator,     |
+    | copy them straight out of the buffer and stop at the      |
+    | terminator like the old char pointer assignment did       |
     \*---------------------------------------------------------*/
-    unsigned short serial_len;
-    memcpy(&serial_len, &data_buf[data_ptr], sizeof(unsigned short));
-    data_ptr += sizeof(unsigned short);
+    auto GetString = [&](std::string& value) -> bool
+    {
+        unsigned short          length = 0;
+        const char *            source;
 
-    serial = (char *)&data_buf[data_ptr];
-    data_ptr += serial_len;
+        reader.GetU16(length);
 
-    /*---------------------------------------------------------*\
-    | Copy in location                                          |
-    \*---------------------------------------------------------*/
-    unsigned short location_len;
-    memcpy(&location_len, &data_buf[data_ptr], sizeof(unsigned short));
-    data_ptr += sizeof(unsigned short);
+        source = (const char *)reader.Peek(length);
 
-    location = (char *)&data_buf[data_ptr];
-    data_ptr += location_len;
+        if(source == NULL)
+        {
+            return(false);
+        }
 
-    /*---------------------------------------------------------*\
-    | Copy in number of modes (data)                            |
-    \*---------------------------------------------------------*/
-    unsigned short num_modes;
-    memcpy(&num_modes, &data_buf[data_ptr], sizeof(unsigned short));
-    data_ptr += sizeof(unsigned short);
+        value.assign(source, strnlen(source, length));
+        reader.Skip(length);
 
-    /*---------------------------------------------------------*\
-    | Copy in active mode (data)                                |
-    \*---------------------------------------------------------*/
-    memcpy(&active_mode, &data_buf[data_ptr], sizeof(active_mode));
-    data_ptr += sizeof(active_mode);
+        return(true);
+    };
 
     /*---------------------------------------------------------*\
-    | Copy in modes                                             |
+    | Device information                                        |
     \*---------------------------------------------------------*/
-    for(int mode_index = 0; mode_index < num_modes; mode_index++)
-    {
-        mode new_mode;
-
-        /*---------------------------------------------------------*\
-        | Copy in mode name (size+data)                             |
-        \*---------------------------------------------------------*/
-        unsigned short modename_len;
-        memcpy(&modename_len, &data_buf[data_ptr], sizeof(unsigned short));
-        data_ptr += sizeof(unsigned short);
-
-        new_mode.name = (char *)&data_buf[data_ptr];
-        data_ptr += modename_len;
-
-        /*---------------------------------------------------------*\
-        | Copy in mode value (data)                                 |
-        \*---------------------------------------------------------*/
-        memcpy(&new_mode.value, &data_buf[data_ptr], sizeof(new_mode.value));
-        data_ptr += sizeof(new_mode.value);
+    device_type     new_type        = 0;
+    std::string     new_name;
+    std::string     new_description;
+    std::string     new_version;
+    std::string     new_serial;
+    std::string     new_location;
 
-        /*---------------------------------------------------------*\
-        | Copy in mode flags (data)                                 |
-        \*---------------------------------------------------------*/
-        memcpy(&new_mode.flags, &data_buf[data_ptr], sizeof(new_mode.flags));
-        data_ptr += sizeof(new_mode.flags);
-
-        /*---------------------------------------------------------*\
-        | Copy in mode speed_min (data)                             |
-        \*---------------------------------------------------------*/
-        memcpy(&new_mode.speed_min, &data_buf[data_ptr], sizeof(new_mode.speed_min));
-        data_ptr += sizeof(new_mode.speed_min);
-
-        /*---------------------------------------------------------*\
-        | Copy in mode speed_max (data)                             |
-        \*---------------------------------------------------------*/
-        memcpy(&new_mode.speed_max, &data_buf[data_ptr], sizeof(new_mode.speed_max));
-        data_ptr += sizeof(new_mode.speed_max);
+    reader.GetBytes(&new_type, sizeof(new_type));
 
-        /*---------------------------------------------------------*\
-        | Copy in mode colors_min (data)                            |
-        \*---------------------------------------------------------*/
-        memcpy(&new_mode.colors_min, &data_buf[data_ptr], sizeof(new_mode.colors_min));
-        data_ptr += sizeof(new_mode.colors_min);
+    if(!GetString(new_name) || !GetString(new_description) || !GetString(new_version)
+    || !GetString(new_serial) || !GetString(new_location))
+    {
+        return(false);
+    }
 
-        /*---------------------------------------------------------*\
-        | Copy in mode colors_max (data)                            |
-        \*---------------------------------------------------------*/
-        memcpy(&new_mode.colors_max, &data_buf[data_ptr], sizeof(new_mode.colors_max));
-        data_ptr += sizeof(new_mode.colors_max);
+    /*---------------------------------------------------------*\
+    | Modes                                                     |
+    \*---------------------------------------------------------*/
+    unsigned short      num_modes       = 0;
+    int                 new_active_mode = 0;
+    std::vector<mode>   new_modes;
 
-        /*---------------------------------------------------------*\
-        | Copy in mode speed (data)                                 |
-        \*---------------------------------------------------------*/
-        memcpy(&new_mode.speed, &data_buf[data_ptr], sizeof(new_mode.speed));
-        data_ptr += sizeof(new_mode.speed);
+    reader.GetU16(num_modes);
+    reader.GetBytes(&new_active_mode, sizeof(new_active_mode));
 
-        /*---------------------------------------------------------*\
-        | Copy in mode direction (data)                             |
-        \*---------------------------------------------------------*/
-        memcpy(&new_mode.direction, &data_buf[data_ptr], sizeof(new_mode.direction));
-        data_ptr += sizeof(new_mode.direction);
+    if(!reader.Ok() || (num_modes > reader.Remaining()))
+    {
+        return(false);
+    }
 
-        /*---------------------------------------------------------*\
-        | Copy in mode color_mode (data)                            |
-        \*---------------------------------------------------------*/
-        memcpy(&new_mode.color_mode, &data_buf[data_ptr], sizeof(new_mode.color_mode));
-        data_ptr += sizeof(new_mode.color_mode);
+    new_modes.resize(num_modes);
 
-        /*---------------------------------------------------------*\
-        | Copy in mode number of colors                             |
-        \*---------------------------------------------------------*/
-        unsigned short mode_num_colors;
-        memcpy(&mode_num_colors, &data_buf[data_ptr], sizeof(unsigned short));
-        data_ptr += sizeof(unsigned short);
+    for(unsigned int mode_index = 0; mode_index < num_modes; mode_index++)
+    {
+        mode&           new_mode        = new_modes[mode_index];
+        unsigned short  mode_num_colors = 0;
 
-        /*---------------------------------------------------------*\
-        | Copy in mode mode colors                                  |
-        \*---------------------------------------------------------*/
-        for(int color_index = 0; color_index < mode_num_colors; color_index++)
+        if(!GetString(new_mode.name))
         {
-            /*---------------------------------------------------------*\
-            | Copy in color (data)                                      |
-            \*---------------------------------------------------------*/
-            RGBColor new_color;
-            memcpy(&new_color, &data_buf[data_ptr], sizeof(RGBColor));
-            data_ptr += sizeof(modes[mode_index].colors[color_index]);
+            return(false);
+        }
 
-            new_mode.colors.push_back(new_color);
+        reader.GetBytes(&new_mode.value,        sizeof(new_mode.value));
+        reader.GetBytes(&new_mode.flags,        sizeof(new_mode.flags));
+        reader.GetBytes(&new_mode.speed_min,    sizeof(new_mode.speed_min));
+        reader.GetBytes(&new_mode.speed_max,    sizeof(new_mode.speed_max));
+        reader.GetBytes(&new_mode.colors_min,   sizeof(new_mode.colors_min));
+        reader.GetBytes(&new_mode.colors_max,   sizeof(new_mode.colors_max));
+        reader.GetBytes(&new_mode.speed,        sizeof(new_mode.speed));
+        reader.GetBytes(&new_mode.direction,    sizeof(new_mode.direction));
+        reader.GetBytes(&new_mode.color_mode,   sizeof(new_mode.color_mode));
+        reader.GetU16(mode_num_colors);
+
+        if(!reader.Ok() || (mode_num_colors > (reader.Remaining() / sizeof(RGBColor))))
+        {
+            return(false);
         }
 
-        modes.push_back(new_mode);
+        new_mode.colors.resize(mode_num_colors);
+        reader.GetBytes(new_mode.colors.data(), mode_num_colors * sizeof(RGBColor));
     }
 
     /*---------------------------------------------------------*\
-    | Copy in number of zones (data)                            |
-    \*---------------------------------------------------------*/
-    unsigned short num_zones;
-    memcpy(&num_zones, &data_buf[data_ptr], sizeof(unsigned short));
-    data_ptr += sizeof(unsigned short);
-
-    /*---------------------------------------------------------*\
-    | Copy in zones                                             |
+    | Zones                                                     |
     \*---------------------------------------------------------*/
-    for(int zone_index = 0; zone_index < num_zones; zone_index++)
-    {
-        zone new_zone;
+    unsigned short      num_zones = 0;
+    std::vector<zone>   new_zones;
 
-        /*---------------------------------------------------------*\
-        | Copy in zone name (size+data)                             |
-        \*---------------------------------------------------------*/
-        unsigned short zonename_len;
-        memcpy(&zonename_len, &data_buf[data_ptr], sizeof(unsigned short));
-        data_ptr += sizeof(unsigned short);
+    reader.GetU16(num_zones);
 
-        new_zone.name = (char *)&data_buf[data_ptr];
-        data_ptr += zonename_len;
+    if(!reader.Ok() || (num_zones > reader.Remaining()))
+    {
+        return(false);
+    }
 
-        /*---------------------------------------------------------*\
-        | Copy in zone type (data)                                  |
-        \*---------------------------------------------------------*/
-        memcpy(&new_zone.type, &data_buf[data_ptr], sizeof(new_zone.type));
-        data_ptr += sizeof(new_zone.type);
+    new_zones.resize(num_zones);
 
-        /*---------------------------------------------------------*\
-        | Copy in zone minimum LED count (data)                     |
-        \*---------------------------------------------------------*/
-        memcpy(&new_zone.leds_min, &data_buf[data_ptr], sizeof(new_zone.leds_min));
-        data_ptr += sizeof(new_zone.leds_min);
+    for(unsigned int zone_index = 0; zone_index < num_zones; zone_index++)
+    {
+        zone&           new_zone        = new_zones[zone_index];
+        unsigned short  zone_matrix_len = 0;
 
-        /*---------------------------------------------------------*\
-        | Copy in zone maximum LED count (data)                     |
-        \*---------------------------------------------------------*/
-        memcpy(&new_zone.leds_max, &data_buf[data_ptr], sizeof(new_zone.leds_max));
-        data_ptr += sizeof(new_zone.leds_max);
+        if(!GetString(new_zone.name))
+        {
+            return(false);
+        }
 
-        /*---------------------------------------------------------*\
-        | Copy in zone LED count (data)                             |
-        \*---------------------------------------------------------*/
-        memcpy(&new_zone.leds_count, &data_buf[data_ptr], sizeof(new_zone.leds_count));
-        data_ptr += sizeof(new_zone.leds_count);
+        reader.GetBytes(&new_zone.type,         sizeof(new_zone.type));
+        reader.GetBytes(&new_zone.leds_min,     sizeof(new_zone.leds_min));
+        reader.GetBytes(&new_zone.leds_max,     sizeof(new_zone.leds_max));
+        reader.GetBytes(&new_zone.leds_count,   sizeof(new_zone.leds_count));
+        reader.GetU16(zone_matrix_len);
 
-        /*---------------------------------------------------------*\
-        | Copy in size of zone matrix                               |
-        \*---------------------------------------------------------*/
-        unsigned short zone_matrix_len;
-        memcpy(&zone_matrix_len, &data_buf[data_ptr], sizeof(zone_matrix_len));
-        data_ptr += sizeof(zone_matrix_len);
+        new_zone.matrix_map = NULL;
 
         /*---------------------------------------------------------*\
-        | Copy in matrix data if size is nonzero                    |
+        | The matrix length field is only a presence flag, large    |
+        | maps overflow it, so size the map from height and width   |
         \*---------------------------------------------------------*/
         if(zone_matrix_len > 0)
         {
-            /*---------------------------------------------------------*\
-            | Create a map data structure to fill in and attach it to   |
-            | the new zone                                              |
-            \*---------------------------------------------------------*/
-            matrix_map_type * new_map = new matrix_map_type;
-
-            new_zone.matrix_map = new_map;
-
-            /*---------------------------------------------------------*\
-            | Copy in matrix height                                     |
-            \*---------------------------------------------------------*/
-            memcpy(&new_map->height, &data_buf[data_ptr], sizeof(new_map->height));
-            data_ptr += sizeof(new_map->height);
-
-            /*---------------------------------------------------------*\
-            | Copy in matrix width                                      |
-            \*---------------------------------------------------------*/
-            memcpy(&new_map->width, &data_buf[data_ptr], sizeof(new_map->width));
-            data_ptr += sizeof(new_map->width);
+            unsigned int matrix_height = 0;
+            unsigned int matrix_width  = 0;
 
-            /*---------------------------------------------------------*\
-            | Copy in matrix map                                        |
-            \*---------------------------------------------------------*/
-            new_map->map = new unsigned int[new_map->height * new_map->width];
+            reader.GetU32(matrix_height);
+            reader.GetU32(matrix_width);
 
-            for(unsigned int matrix_idx = 0; matrix_idx < (new_map->height * new_map->width); matrix_idx++)
+            if(!reader.Ok() || ((matrix_width != 0) && (matrix_height > (reader.Remaining() / sizeof(unsigned int) / matrix_width))))
             {
-                memcpy(&new_map->map[matrix_idx], &data_buf[data_ptr], sizeof(new_map->map[matrix_idx]));
-                data_ptr += sizeof(new_map->map[matrix_idx]);
+                return(false);
             }
+
+            new_zone.matrix_map = NewMatrixMap(matrix_height, matrix_width);
+
+            reader.GetBytes(new_zone.matrix_map->map, matrix_height * matrix_width * sizeof(unsigned int));
         }
-        else
-        {
-            new_zone.matrix_map = NULL;
-        }
-        
-        zones.push_back(new_zone);
     }
 
     /*---------------------------------------------------------*\
-    | Copy in number of LEDs (data)                             |
+    | LEDs                                                      |
     \*---------------------------------------------------------*/
-    unsigned short num_leds;
-    memcpy(&num_leds, &data_buf[data_ptr], sizeof(unsigned short));
-    data_ptr += sizeof(unsigned short);
+    unsigned short      num_leds = 0;
+    std::vector<led>    new_leds;
 
-    /*---------------------------------------------------------*\
-    | Copy in LEDs                                              |
-    \*---------------------------------------------------------*/
-    for(int led_index = 0; led_index < num_leds; led_index++)
-    {
-        led new_led;
+    reader.GetU16(num_leds);
 
-        /*---------------------------------------------------------*\
-        | Copy in LED name (size+data)                              |
-        \*---------------------------------------------------------*/
-        unsigned short ledname_len;
-        memcpy(&ledname_len, &data_buf[data_ptr], sizeof(unsigned short));
-        data_ptr += sizeof(unsigned short);
+    if(!reader.Ok() || (num_leds > reader.Remaining()))
+    {
+        return(false);
+    }
 
-        new_led.name = (char *)&data_buf[data_ptr];
-        data_ptr += ledname_len;
+    new_leds.resize(num_leds);
 
-        /*---------------------------------------------------------*\
-        | Copy in LED value (data)                                  |
-        \*---------------------------------------------------------*/
-        memcpy(&new_led.value, &data_buf[data_ptr], sizeof(new_led.value));
-        data_ptr += sizeof(new_led.value);
+    for(unsigned int led_index = 0; led_index < num_leds; led_index++)
+    {
+        if(!GetString(new_leds[led_index].name))
+        {
+            return(false);
+        }
 
-        leds.push_back(new_led);
+        reader.GetBytes(&new_leds[led_index].value, sizeof(new_leds[led_index].value));
     }
 
     /*---------------------------------------------------------*\
-    | Copy in number of colors (data)                           |
+    | Colors                                                    |
     \*---------------------------------------------------------*/
-    unsigned short num_colors;
-    memcpy(&num_colors, &data_buf[data_ptr], sizeof(unsigned short));
-    data_ptr += sizeof(unsigned short);
+    unsigned short          num_colors = 0;
+    std::vector<RGBColor>   new_colors;
 
-    /*---------------------------------------------------------*\
-    | Copy in colors                                            |
-    \*---------------------------------------------------------*/
-    for(int color_index = 0; color_index < num_colors; color_index++)
+    reader.GetU16(num_colors);
+
+    if(!reader.Ok() || (num_colors > (reader.Remaining() / sizeof(RGBColor))))
     {
-        RGBColor new_color;
+        return(false);
+    }
 
-        /*---------------------------------------------------------*\
-        | Copy in color (data)                                      |
-        \*---------------------------------------------------------*/
-        memcpy(&new_color, &data_buf[data_ptr], sizeof(RGBColor));
-        data_ptr += sizeof(RGBColor);
+    new_colors.resize(num_colors);
+    reader.GetBytes(new_colors.data(), num_colors * sizeof(RGBColor));
 
-        colors.push_back(new_color);
+    if(!reader.Ok())
+    {
+        return(false);
     }
 
     /*---------------------------------------------------------*\
-    | Setup colors                                              |
+    | SetupColors points each zone into the LED list, so the    |
+    | zones must fit in it                                      |
     \*---------------------------------------------------------*/
-    SetupColors();
-}
+    unsigned long long total_led_count = 0;
 
-unsigned char * RGBController::GetModeDescription(int mode)
-{
-    unsigned int data_ptr = 0;
-    unsigned int data_size = 0;
+    for(unsigned int zone_index = 0; zone_index < num_zones; zone_index++)
+    {
+        total_led_count += new_zones[zone_index].leds_count;
+    }
 
-    unsigned short mode_name_len;
-    unsigned short mode_num_colors;
+    if(total_led_count > num_leds)
+    {
+        return(false);
+    }
 
     /*---------------------------------------------------------*\
-    | Calculate data size                                       |
+    | Everything decoded, fill in the controller                |
     \*---------------------------------------------------------*/
-    mode_name_len   = strlen(modes[mode].name.c_str()) + 1;
-    mode_num_colors = modes[mode].colors.size();
+    type            = new_type;
+    name.swap(new_name);
+    description.swap(new_description);
+    version.swap(new_version);
+    serial.swap(new_serial);
+    location.swap(new_location);
+    active_mode     = new_active_mode;
 
-    data_size += sizeof(data_size);
-    data_size += sizeof(mode);
-    data_size += sizeof(mode_name_len);
-    data_size += mode_name_len;
-    data_size += sizeof(modes[mode].value);
-    data_size += sizeof(modes[mode].flags);
-    data_size += sizeof(modes[mode].speed_min);
-    data_size += sizeof(modes[mode].speed_max);
-    data_size += sizeof(modes[mode].colors_min);
-    data_size += sizeof(modes[mode].colors_max);
-    data_size += sizeof(modes[mode].speed);
-    data_size += sizeof(modes[mode].direction);
-    data_size += sizeof(modes[mode].color_mode);
-    data_size += sizeof(mode_num_colors);
-    data_size += (mode_num_colors * sizeof(RGBColor));
+    modes.swap(new_modes);
+    zones.swap(new_zones);
+    leds.swap(new_leds);
+    colors.swap(new_colors);
 
     /*---------------------------------------------------------*\
-    | Create data buffer                                        |
+    | Setup colors                                              |
     \*---------------------------------------------------------*/
-    unsigned char *data_buf = new unsigned char[data_size];
+    SetupColors();
 
-    /*---------------------------------------------------------*\
-    | Copy in data size                                         |
-    \*---------------------------------------------------------*/
-    memcpy(&data_buf[data_ptr], &data_size, sizeof(data_size));
-    data_ptr += sizeof(data_size);
+    return(true);
+}
 
-    /*---------------------------------------------------------*\
-    | Copy in mode index                                        |
-    \*---------------------------------------------------------*/
-    memcpy(&data_buf[data_ptr], &mode, sizeof(int));
-    data_ptr += sizeof(int);
+/*---------------------------------------------------------*\
+| Split an LED name into a shared prefix and a tail.  Names |
+| ending in a plain decimal number ("Strip LED 12") get a   |
+| numeric tail so consecutive LEDs can be sent as a run.    |
+| Otherwise the prefix runs through ": " or the last space, |
+| so "Key: A" and "Key: B" share "Key: "                    |
+\*---------------------------------------------------------*/
+static void SplitLEDName(const std::string& name, std::string& prefix, std::string& tail, bool& numeric, unsigned int& number)
+{
+    std::size_t digits = 0;
 
-    /*---------------------------------------------------------*\
-    | Copy in mode name (size+data)                             |
-    \*---------------------------------------------------------*/
-    memcpy(&data_buf[data_ptr], &mode_name_len, sizeof(unsigned short));
-    data_ptr += sizeof(unsigned short);
+    while((digits < name.size()) && (name[name.size() - 1 - digits] >= '0') && (name[name.size() - 1 - digits] <= '9'))
+    {
+        digits++;
+    }
 
-    strcpy((char *)&data_buf[data_ptr], modes[mode].name.c_str());
-    data_ptr += mode_name_len;
+    std::size_t split = name.size() - digits;
+
+    numeric = (digits > 0) && (digits <= 9) && ((digits == 1) || (name[split] != '0'));
+
+    if(numeric)
+    {
+        prefix = name.substr(0, split);
+        tail.clear();
+        number = std::stoul(name.substr(split));
+        return;
+    }
+
+    split = name.find(": ");
+
+    if(split != std::string::npos)
+    {
+        split += 2;
+    }
+    else
+    {
+        split = name.rfind(' ');
+        split = (split == std::string::npos) ? 0 : split + 1;
+    }
+
+    prefix = name.substr(0, split);
+    tail   = name.substr(split);
+    number = 0;
+}
+
+/*---------------------------------------------------------*\
+| Compact description layout                                |
+|   unsigned int        data_size                           |
+|   unsigned int        RGBCONTROLLER_COMPACT_MAGIC         |
+|   varint              number of strings, then each string |
+|                       as varint length and bytes          |
+|   varint              type                                |
+|   varint x5           name, description, version, serial  |
+|                       and location string indices         |
+|   varint              number of modes                     |
+|   signed varint       active mode                         |
+|   per mode:           name index, signed value, flags,    |
+|                       speed_min, speed_max, colors_min,   |
+|                       colors_max, speed, direction,       |
+|                       color_mode, number of colors as     |
+|                       varints, then RGBColor[]            |
+|   varint              number of zones                     |
+|   per zone:           name index, type, leds_min,         |
+|                       leds_max, leds_count, matrix height |
+|                       and width as varints, then each map |
+|                       entry plus one as a varint so the   |
+|                       0xFFFFFFFF "no LED" entry is 1 byte |
+|   varint              number of LEDs                      |
+|   per run of LEDs:    run length, prefix index and tail   |
+|                       code, then each LED value.  An even |
+|                       tail code is a number (code >> 1)   |
+|                       that grows by one along the run, an |
+|                       odd one a string index              |
+|   varint              number of colors, then RGBColor[]   |
+\*---------------------------------------------------------*/
+unsigned char * RGBController::GetDeviceDescriptionCompact()
+{
+    RGBDescriptionWriter                            body;
+    std::vector<std::string>                        strings;
+    std::unordered_map<std::string, unsigned int>   string_index;
+
+    auto StringIndex = [&](const std::string& value) -> unsigned int
+    {
+        std::unordered_map<std::string, unsigned int>::iterator it = string_index.find(value);
+
+        if(it != string_index.end())
+        {
+            return(it->second);
+        }
+
+        string_index[value] = strings.size();
+        strings.push_back(value);
+
+        return(strings.size() - 1);
+    };
+
+    /*---------------------------------------------------------*\
+    | Device information                                        |
+    \*---------------------------------------------------------*/
+    body.PutVarint(type);
+    body.PutVarint(StringIndex(name));
+    body.PutVarint(StringIndex(description));
+    body.PutVarint(StringIndex(version));
+    body.PutVarint(StringIndex(serial));
+    body.PutVarint(StringIndex(location));
+
+    /*---------------------------------------------------------*\
+    | Modes                                                     |
+    \*---------------------------------------------------------*/
+    body.PutVarint(modes.size());
+    body.PutSignedVarint(active_mode);
+
+    for(std::size_t mode_index = 0; mode_index < modes.size(); mode_index++)
+    {
+        mode& this_mode = modes[mode_index];
+
+        body.PutVarint(StringIndex(this_mode.name));
+        body.PutSignedVarint(this_mode.value);
+        body.PutVarint(this_mode.flags);
+        body.PutVarint(this_mode.speed_min);
+        body.PutVarint(this_mode.speed_max);
+        body.PutVarint(this_mode.colors_min);
+        body.PutVarint(this_mode.colors_max);
+        body.PutVarint(this_mode.speed);
+        body.PutVarint(this_mode.direction);
+        body.PutVarint(this_mode.color_mode);
+        body.PutVarint(this_mode.colors.size());
+        body.PutBytes(this_mode.colors.data(), this_mode.colors.size() * sizeof(RGBColor));
+    }
+
+    /*---------------------------------------------------------*\
+    | Zones                                                     |
+    \*---------------------------------------------------------*/
+    body.PutVarint(zones.size());
+
+    for(std::size_t zone_index = 0; zone_index < zones.size(); zone_index++)
+    {
+        zone& this_zone = zones[zone_index];
+
+        body.PutVarint(StringIndex(this_zone.name));
+        body.PutVarint(this_zone.type);
+        body.PutVarint(this_zone.leds_min);
+        body.PutVarint(this_zone.leds_max);
+        body.PutVarint(this_zone.leds_count);
+
+        if(this_zone.matrix_map == NULL)
+        {
+            body.PutVarint(0);
+            body.PutVarint(0);
+        }
+        else
+        {
+            unsigned int map_size = this_zone.matrix_map->height * this_zone.matrix_map->width;
+
+            body.PutVarint(this_zone.matrix_map->height);
+            body.PutVarint(this_zone.matrix_map->width);
+
+            for(unsigned int matrix_idx = 0; matrix_idx < map_size; matrix_idx++)
+            {
+                body.PutVarint(this_zone.matrix_map->map[matrix_idx] + 1);
+            }
+        }
+    }
+
+    /*---------------------------------------------------------*\
+    | LEDs, grouped into runs of consecutive numbered names     |
+    \*---------------------------------------------------------*/
+    body.PutVarint(leds.size());
+
+    std::size_t led_index = 0;
+
+    while(led_index < leds.size())
+    {
+        std::string     prefix;
+        std::string     tail;
+        bool            numeric;
+        unsigned int    number;
+
+        SplitLEDName(leds[led_index].name, prefix, tail, numeric, number);
+
+        std::size_t run_length = 1;
+
+        while(numeric && ((led_index + run_length) < leds.size()))
+        {
+            std::string     next_prefix;
+            std::string     next_tail;
+            bool            next_numeric;
+            unsigned int    next_number;
+
+            SplitLEDName(leds[led_index + run_length].name, next_prefix, next_tail, next_numeric, next_number);
+
+            if(!next_numeric || (next_prefix != prefix) || (next_number != (number + run_length)))
+            {
+                break;
+            }
+
+            run_length++;
+        }
+
+        body.PutVarint(run_length);
+        body.PutVarint(StringIndex(prefix));
+        body.PutVarint(numeric ? (number << 1) : ((StringIndex(tail) << 1) | 1));
+
+        for(std::size_t run_index = 0; run_index < run_length; run_index++)
+        {
+            body.PutVarint(leds[led_index + run_index].value);
+        }
+
+        led_index += run_length;
+    }
+
+    /*---------------------------------------------------------*\
+    | Colors                                                    |
+    \*---------------------------------------------------------*/
+    body.PutVarint(colors.size());
+    body.PutBytes(colors.data(), colors.size() * sizeof(RGBColor));
+
+    /*---------------------------------------------------------*\
+    | Size and magic, then the string table, then the body      |
+    \*---------------------------------------------------------*/
+    RGBDescriptionWriter description;
+
+    description.PutU32(0);
+    description.PutU32(RGBCONTROLLER_COMPACT_MAGIC);
+    description.PutVarint(strings.size());
+
+    for(std::size_t string_idx = 0; string_idx < strings.size(); string_idx++)
+    {
+        description.PutString(strings[string_idx]);
+    }
+
+    description.PutBytes(body.data.data(), body.data.size());
+
+    unsigned int data_size = description.data.size();
+
+    memcpy(&description.data[0], &data_size, sizeof(data_size));
+
+    unsigned char *data_buf = new unsigned char[data_size];
+
+    memcpy(data_buf, description.data.data(), data_size);
+
+    return(data_buf);
+}
+
+bool RGBController::ReadDeviceDescriptionCompact(unsigned char* data_buf, unsigned int data_size)
+{
+    RGBDescriptionReader        reader(data_buf, data_size);
+    unsigned int                magic;
+    unsigned int                num_strings;
+    std::vector<std::string>    strings;
+
+    reader.Skip(sizeof(unsigned int));
+    reader.GetU32(magic);
+    reader.GetVarint(num_strings);
+
+    /*---------------------------------------------------------*\
+    | Every string takes at least one byte, so a count larger   |
+    | than what is left is corrupt                              |
+    \*---------------------------------------------------------*/
+    if(!reader.Ok() || (num_strings > reader.Remaining()))
+    {
+        return(false);
+    }
+
+    strings.resize(num_strings);
+
+    for(unsigned int string_idx = 0; string_idx < num_strings; string_idx++)
+    {
+        reader.GetString(strings[string_idx]);
+    }
+
+    auto GetString = [&](std::string& value) -> bool
+    {
+        unsigned int string_idx;
+
+        if(!reader.GetVarint(string_idx) || (string_idx >= strings.size()))
+        {
+            return(false);
+        }
+
+        value = strings[string_idx];
+
+        return(true);
+    };
+
+    /*---------------------------------------------------------*\
+    | Device information                                        |
+    \*---------------------------------------------------------*/
+    unsigned int    new_type        = 0;
+    std::string     new_name;
+    std::string     new_description;
+    std::string     new_version;
+    std::string     new_serial;
+    std::string     new_location;
+
+    reader.GetVarint(new_type);
+
+    if(!GetString(new_name) || !GetString(new_description) || !GetString(new_version)
+    || !GetString(new_serial) || !GetString(new_location))
+    {
+        return(false);
+    }
+
+    /*---------------------------------------------------------*\
+    | Modes                                                     |
+    \*---------------------------------------------------------*/
+    unsigned int        num_modes       = 0;
+    int                 new_active_mode = 0;
+    std::vector<mode>   new_modes;
+
+    reader.GetVarint(num_modes);
+    reader.GetSignedVarint(new_active_mode);
+
+    if(!reader.Ok() || (num_modes > reader.Remaining()))
+    {
+        return(false);
+    }
+
+    new_modes.resize(num_modes);
+
+    for(unsigned int mode_index = 0; mode_index < num_modes; mode_index++)
+    {
+        mode&           new_mode        = new_modes[mode_index];
+        unsigned int    mode_num_colors = 0;
+
+        if(!GetString(new_mode.name))
+        {
+            return(false);
+        }
+
+        reader.GetSignedVarint(new_mode.value);
+        reader.GetVarint(new_mode.flags);
+        reader.GetVarint(new_mode.speed_min);
+        reader.GetVarint(new_mode.speed_max);
+        reader.GetVarint(new_mode.colors_min);
+        reader.GetVarint(new_mode.colors_max);
+        reader.GetVarint(new_mode.speed);
+        reader.GetVarint(new_mode.direction);
+        reader.GetVarint(new_mode.color_mode);
+        reader.GetVarint(mode_num_colors);
+
+        if(!reader.Ok() || (mode_num_colors > (reader.Remaining() / sizeof(RGBColor))))
+        {
+            return(false);
+        }
+
+        new_mode.colors.resize(mode_num_colors);
+        reader.GetBytes(new_mode.colors.data(), mode_num_colors * sizeof(RGBColor));
+    }
+
+    /*---------------------------------------------------------*\
+    | Zones                                                     |
+    \*---------------------------------------------------------*/
+    unsigned int        num_zones = 0;
+    std::vector<zone>   new_zones;
+
+    reader.GetVarint(num_zones);
+
+    if(!reader.Ok() || (num_zones > reader.Remaining()))
+    {
+        return(false);
+    }
+
+    new_zones.resize(num_zones);
+
+    for(unsigned int zone_index = 0; zone_index < num_zones; zone_index++)
+    {
+        zone&           new_zone        = new_zones[zone_index];
+        unsigned int    zone_type_value = 0;
+        unsigned int    matrix_height   = 0;
+        unsigned int    matrix_width    = 0;
+
+        if(!GetString(new_zone.name))
+        {
+            return(false);
+        }
+
+        reader.GetVarint(zone_type_value);
+        reader.GetVarint(new_zone.leds_min);
+        reader.GetVarint(new_zone.leds_max);
+        reader.GetVarint(new_zone.leds_count);
+        reader.GetVarint(matrix_height);
+        reader.GetVarint(matrix_width);
+
+        new_zone.type       = zone_type_value;
+        new_zone.matrix_map = NULL;
+
+        /*---------------------------------------------------------*\
+        | Each map entry takes at least one byte                    |
+        \*---------------------------------------------------------*/
+        if(!reader.Ok() || ((matrix_width != 0) && (matrix_height > (reader.Remaining() / matrix_width))))
+        {
+            return(false);
+        }
+
+        if((matrix_height != 0) && (matrix_width != 0))
+        {
+            new_zone.matrix_map = NewMatrixMap(matrix_height, matrix_width);
+
+            for(unsigned int matrix_idx = 0; matrix_idx < (matrix_height * matrix_width); matrix_idx++)
+            {
+                unsigned int map_value = 0;
+
+                reader.GetVarint(map_value);
+
+                new_zone.matrix_map->map[matrix_idx] = map_value - 1;
+            }
+        }
+    }
+
+    /*---------------------------------------------------------*\
+    | LEDs                                                      |
+    \*---------------------------------------------------------*/
+    unsigned int        num_leds = 0;
+    std::vector<led>    new_leds;
+
+    reader.GetVarint(num_leds);
+
+    if(!reader.Ok() || (num_leds > reader.Remaining()))
+    {
+        return(false);
+    }
+
+    new_leds.resize(num_leds);
+
+    unsigned int led_index = 0;
+
+    while(led_index < num_leds)
+    {
+        unsigned int    run_length  = 0;
+        unsigned int    prefix_idx  = 0;
+        unsigned int    tail_code   = 0;
+
+        reader.GetVarint(run_length);
+        reader.GetVarint(prefix_idx);
+        reader.GetVarint(tail_code);
+
+        if(!reader.Ok() || (run_length == 0) || (run_length > (num_leds - led_index)) || (prefix_idx >= strings.size())
+        || ((tail_code & 1) && (((tail_code >> 1) >= strings.size()) || (run_length != 1))))
+        {
+            return(false);
+        }
+
+        for(unsigned int run_index = 0; run_index < run_length; run_index++)
+        {
+            led& new_led = new_leds[led_index + run_index];
+
+            if(tail_code & 1)
+            {
+                new_led.name = strings[prefix_idx] + strings[tail_code >> 1];
+            }
+            else
+            {
+                new_led.name = strings[prefix_idx] + std::to_string((tail_code >> 1) + run_index);
+            }
+
+            reader.GetVarint(new_led.value);
+        }
+
+        led_index += run_length;
+    }
+
+    /*---------------------------------------------------------*\
+    | Colors                                                    |
+    \*---------------------------------------------------------*/
+    unsigned int            num_colors = 0;
+    std::vector<RGBColor>   new_colors;
+
+    reader.GetVarint(num_colors);
+
+    if(!reader.Ok() || (num_colors > (reader.Remaining() / sizeof(RGBColor))))
+    {
+        return(false);
+    }
+
+    new_colors.resize(num_colors);
+    reader.GetBytes(new_colors.data(), num_colors * sizeof(RGBColor));
+
+    if(!reader.Ok())
+    {
+        return(false);
+    }
+
+    /*---------------------------------------------------------*\
+    | SetupColors points each zone into the LED list, so the    |
+    | zones must fit in it                                      |
+    \*---------------------------------------------------------*/
+    unsigned long long total_led_count = 0;
+
+    for(unsigned int zone_index = 0; zone_index < num_zones; zone_index++)
+    {
+        total_led_count += new_zones[zone_index].leds_count;
+    }
+
+    if(total_led_count > num_leds)
+    {
+        return(false);
+    }
+
+    /*---------------------------------------------------------*\
+    | Everything decoded, fill in the controller                |
+    \*---------------------------------------------------------*/
+    type            = new_type;
+    name            = new_name;
+    description     = new_description;
+    version         = new_version;
+    serial          = new_serial;
+    location        = new_location;
+    active_mode     = new_active_mode;
+
+    modes.swap(new_modes);
+    zones.swap(new_zones);
+    leds.swap(new_leds);
+    colors.swap(new_colors);
+
+    /*---------------------------------------------------------*\
+    | Setup colors                                              |
+    \*---------------------------------------------------------*/
+    SetupColors();
+
+    return(true);
+}
+
+unsigned char * RGBController::GetModeDescription(int mode)
+{
+    unsigned int data_ptr = 0;
+    unsigned int data_size = 0;
+
+    unsigned short mode_name_len;
+    unsigned short mode_num_colors;
+
+    /*---------------------------------------------------------*\
+    | Calculate data size                                       |
+    \*---------------------------------------------------------*/
+    mode_name_len   = strlen(modes[mode].name.c_str()) + 1;
+    mode_num_colors = modes[mode].colors.size();
+
+    data_size += sizeof(data_size);
+    data_size += sizeof(mode);
+    data_size += sizeof(mode_name_len);
+    data_size += mode_name_len;
+    data_size += sizeof(modes[mode].value);
+    data_size += sizeof(modes[mode].flags);
+    data_size += sizeof(modes[mode].speed_min);
+    data_size += sizeof(modes[mode].speed_max);
+    data_size += sizeof(modes[mode].colors_min);
+    data_size += sizeof(modes[mode].colors_max);
+    data_size += sizeof(modes[mode].speed);
+    data_size += sizeof(modes[mode].direction);
+    data_size += sizeof(modes[mode].color_mode);
+    data_size += sizeof(mode_num_colors);
+    data_size += (mode_num_colors * sizeof(RGBColor));
+
+    /*---------------------------------------------------------*\
+    | Create data buffer                                        |
+    \*---------------------------------------------------------*/
+    unsigned char *data_buf = new unsigned char[data_size];
+
+    /*---------------------------------------------------------*\
+    | Copy in data size                                         |
+    \*---------------------------------------------------------*/
+    memcpy(&data_buf[data_ptr], &data_size, sizeof(data_size));
+    data_ptr += sizeof(data_size);
+
+    /*---------------------------------------------------------*\
+    | Copy in mode index                                        |
+    \*---------------------------------------------------------*/
+    memcpy(&data_buf[data_ptr], &mode, sizeof(int));
+    data_ptr += sizeof(int);
+
+    /*---------------------------------------------------------*\
+    | Copy in mode name (size+data)                             |
+    \*---------------------------------------------------------*/
+    memcpy(&data_buf[data_ptr], &mode_name_len, sizeof(unsigned short));
+    data_ptr += sizeof(unsigned short);
+
+    strcpy((char *)&data_buf[data_ptr], modes[mode].name.c_str());
+    data_ptr += mode_name_len;
 
     /*---------------------------------------------------------*\
     | Copy in mode value (data)                                 |
@@ -898,7 +1360,7 @@ void RGBController::SetModeDescription(unsigned char* data_buf)
     /*---------------------------------------------------------*\
     | Check if we aren't reading beyond the list of modes.      |
     \*---------------------------------------------------------*/
-    if(((size_t) mode_idx) >  modes.size())
+    if(((size_t) mode_idx) >= modes.size())
     {
         return;
     }
@@ -1069,18 +1531,40 @@ void RGBController::SetColorDescription(unsigned char* data_buf)
     /*---------------------------------------------------------*\
     | Copy in colors                                            |
     \*---------------------------------------------------------*/
-    for(int color_index = 0; color_index < num_colors; color_index++)
-    {
-        RGBColor new_color;
+    RGBColor* frame = BeginFrame();
 
-        /*---------------------------------------------------------*\
-        | Copy in color (data)                                      |
-        \*---------------------------------------------------------*/
-        memcpy(&new_color, &data_buf[data_ptr], sizeof(RGBColor));
-        data_ptr += sizeof(RGBColor);
+    memcpy(frame, &data_buf[data_ptr], num_colors * sizeof(RGBColor));
 
-        colors[color_index] = new_color;
+    PublishFrame();
+}
+
+void RGBController::StageColorDescription(unsigned char* data_buf)
+{
+    unsigned int data_ptr = sizeof(unsigned int);
+
+    /*---------------------------------------------------------*\
+    | Copy in number of colors (data)                           |
+    \*---------------------------------------------------------*/
+    unsigned short num_colors;
+    memcpy(&num_colors, &data_buf[data_ptr], sizeof(unsigned short));
+    data_ptr += sizeof(unsigned short);
+
+    /*---------------------------------------------------------*\
+    | Check if we aren't reading beyond the list of colors.     |
+    \*---------------------------------------------------------*/
+    if(((size_t) num_colors) > colors.size())
+    {
+        return;
     }
+
+    /*---------------------------------------------------------*\
+    | Copy in colors, held back until the next commit           |
+    \*---------------------------------------------------------*/
+    RGBColor* frame = BeginStagedFrame();
+
+    memcpy(frame, &data_buf[data_ptr], num_colors * sizeof(RGBColor));
+
+    StageLEDs();
 }
 
 unsigned char * RGBController::GetZoneColorDescription(int zone)
@@ -1150,7 +1634,7 @@ void RGBController::SetZoneColorDescription(unsigned char* data_buf)
     /*---------------------------------------------------------*\
     | Check if we aren't reading beyond the list of zones.      |
     \*---------------------------------------------------------*/
-    if(((size_t) zone_idx) > zones.size())
+    if(((size_t) zone_idx) >= zones.size())
     {
         return;
     }
@@ -1163,20 +1647,21 @@ void RGBController::SetZoneColorDescription(unsigned char* data_buf)
     data_ptr += sizeof(unsigned short);
 
     /*---------------------------------------------------------*\
-    | Copy in colors                                            |
+    | Check if we aren't writing beyond the end of the zone.    |
     \*---------------------------------------------------------*/
-    for(int color_index = 0; color_index < num_colors; color_index++)
+    if(num_colors > zones[zone_idx].leds_count)
     {
-        RGBColor new_color;
+        return;
+    }
 
-        /*---------------------------------------------------------*\
-        | Copy in color (data)                                      |
-        \*---------------------------------------------------------*/
-        memcpy(&new_color, &data_buf[data_ptr], sizeof(RGBColor));
-        data_ptr += sizeof(RGBColor);
+    /*---------------------------------------------------------*\
+    | Copy in colors                                            |
+    \*---------------------------------------------------------*/
+    RGBColor* frame = BeginFrame();
 
-        zones[zone_idx].colors[color_index] = new_color;
-    }
+    memcpy(&frame[zones[zone_idx].start_idx], &data_buf[data_ptr], num_colors * sizeof(RGBColor));
+
+    PublishFrame();
 }
 
 unsigned char * RGBController::GetSingleLEDColorDescription(int led)
@@ -1218,7 +1703,7 @@ void RGBController::SetSingleLEDColorDescription(unsigned char* data_buf)
     /*---------------------------------------------------------*\
     | Check if we aren't reading beyond the list of leds.       |
     \*---------------------------------------------------------*/
-    if(((size_t) led_idx) > leds.size())
+    if(((size_t) led_idx) >= colors.size())
     {
         return;
     }
@@ -1226,7 +1711,62 @@ void RGBController::SetSingleLEDColorDescription(unsigned char* data_buf)
     /*---------------------------------------------------------*\
     | Copy in LED color                                         |
     \*---------------------------------------------------------*/
-    memcpy(&colors[led_idx], &data_buf[sizeof(led_idx)], sizeof(RGBColor));
+    RGBColor* frame = BeginFrame();
+
+    memcpy(&frame[led_idx], &data_buf[sizeof(led_idx)], sizeof(RGBColor));
+
+    PublishFrame();
+}
+
+matrix_map_type * RGBController::NewMatrixMap(unsigned int height, unsigned int width, const unsigned int* map)
+{
+    /*---------------------------------------------------------*\
+    | The header and the map are allocated together.  Keep the  |
+    | size a multiple of the pointer size so the next header is |
+    | aligned                                                   |
+    \*---------------------------------------------------------*/
+    std::size_t map_size   = (std::size_t)height * width * sizeof(unsigned int);
+    std::size_t alloc_size = (sizeof(matrix_map_type) + map_size + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+
+    unsigned char * block;
+
+    if(alloc_size > MATRIX_MAP_ARENA_CHUNK_SIZE)
+    {
+        /*---------------------------------------------------------*\
+        | Oversized maps get a chunk of their own                   |
+        \*---------------------------------------------------------*/
+        block = new unsigned char[alloc_size];
+        matrix_map_arena.push_back(block);
+    }
+    else
+    {
+        if((matrix_map_chunk == NULL) || (matrix_map_chunk_used + alloc_size > MATRIX_MAP_ARENA_CHUNK_SIZE))
+        {
+            matrix_map_chunk        = new unsigned char[MATRIX_MAP_ARENA_CHUNK_SIZE];
+            matrix_map_chunk_used   = 0;
+            matrix_map_arena.push_back(matrix_map_chunk);
+        }
+
+        block = matrix_map_chunk + matrix_map_chunk_used;
+        matrix_map_chunk_used += alloc_size;
+    }
+
+    matrix_map_type * new_map = (matrix_map_type *)block;
+
+    new_map->height = height;
+    new_map->width  = width;
+    new_map->map    = (unsigned int *)(block + sizeof(matrix_map_type));
+
+    if(map != NULL)
+    {
+        memcpy(new_map->map, map, map_size);
+    }
+    else
+    {
+        memset(new_map->map, 0xFF, map_size);
+    }
+
+    return(new_map);
 }
 
 void RGBController::SetupColors()
@@ -1246,7 +1786,11 @@ void RGBController::SetupColors()
     /*---------------------------------------------------------*\
     | Set the size of the color buffer to the number of LEDs    |
     \*---------------------------------------------------------*/
-    colors.resize(total_led_count);
+    {
+        std::lock_guard<std::mutex> colors_lock(ColorsMutex);
+
+        colors.resize(total_led_count);
+    }
 
     /*---------------------------------------------------------*\
     | Set the color buffer pointers on each zone                |
@@ -1278,10 +1822,46 @@ void RGBController::SetupColors()
 
         total_led_count += zones[zone_idx].leds_count;
     }
+
+    /*---------------------------------------------------------*\
+    | Zone sizes can be part of a hardware effect, so send the  |
+    | mode again on the next update                             |
+    \*---------------------------------------------------------*/
+    applied_mode_valid = false;
+
+    /*---------------------------------------------------------*\
+    | A staged frame sized for the old LED count is dropped     |
+    \*---------------------------------------------------------*/
+    {
+        std::lock_guard<std::mutex> stage_lock(StageMutex);
+
+        FrameStaged = false;
+        frame_staged.clear();
+    }
+
+    /*---------------------------------------------------------*\
+    | The next frame written starts over from the new buffer    |
+    \*---------------------------------------------------------*/
+    std::lock_guard<std::mutex> lock(FrameMutex);
+
+    frame_staging.clear();
 }
 
 RGBColor RGBController::GetLED(unsigned int led)
 {
+    /*---------------------------------------------------------*\
+    | Return the last color written, which may not have been    |
+    | sent yet                                                  |
+    \*---------------------------------------------------------*/
+    std::lock_guard<std::mutex> lock(FrameMutex);
+
+    if(led < frame_staging.size())
+    {
+        return(frame_staging[led]);
+    }
+
+    std::lock_guard<std::mutex> colors_lock(ColorsMutex);
+
     if(led < colors.size())
     {
         return(colors[led]);
@@ -1292,28 +1872,130 @@ RGBColor RGBController::GetLED(unsigned int led)
     }
 }
 
+std::vector<RGBColor> RGBController::GetLEDs()
+{
+    /*---------------------------------------------------------*\
+    | Return the last frame written, staged or published, which |
+    | may not have been sent yet                                |
+    \*---------------------------------------------------------*/
+    {
+        std::lock_guard<std::mutex> stage_lock(StageMutex);
+
+        if(FrameStaged.load() && (frame_staged.size() == colors.size()))
+        {
+            return(frame_staged);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(FrameMutex);
+
+    if(frame_staging.size() == colors.size())
+    {
+        return(frame_staging);
+    }
+
+    std::lock_guard<std::mutex> colors_lock(ColorsMutex);
+
+    return(colors);
+}
+
 void RGBController::SetLED(unsigned int led, RGBColor color)
 {
     if(led < colors.size())
     {
-        colors[led] = color;
+        RGBColor* frame = BeginFrame();
+
+        frame[led] = color;
+
+        PublishFrame();
     }
 }
 
 void RGBController::SetAllLEDs(RGBColor color)
 {
-    for(std::size_t zone_idx = 0; zone_idx < zones.size(); zone_idx++)
+    RGBColor* frame = BeginFrame();
+
+    for(std::size_t color_idx = 0; color_idx < colors.size(); color_idx++)
     {
-        SetAllZoneLEDs(zone_idx, color);
+        frame[color_idx] = color;
     }
+
+    PublishFrame();
 }
 
 void RGBController::SetAllZoneLEDs(int zone, RGBColor color)
 {
+    RGBColor* frame = BeginFrame();
+
     for (std::size_t color_idx = 0; color_idx < zones[zone].leds_count; color_idx++)
     {
-        zones[zone].colors[color_idx] = color;
+        frame[zones[zone].start_idx + color_idx] = color;
+    }
+
+    PublishFrame();
+}
+
+RGBColor * RGBController::BeginFrame()
+{
+    FrameMutex.lock();
+
+    /*---------------------------------------------------------*\
+    | Start from the device's colors the first time and after   |
+    | the LED count changes, so colors read from the hardware   |
+    | at detection are kept                                     |
+    \*---------------------------------------------------------*/
+    if(frame_staging.size() != colors.size())
+    {
+        std::lock_guard<std::mutex> colors_lock(ColorsMutex);
+
+        frame_staging = colors;
+    }
+
+    return(frame_staging.data());
+}
+
+void RGBController::PublishFrame()
+{
+    /*---------------------------------------------------------*\
+    | Fill the back buffer and swap it with the published one.  |
+    | The buffer only reallocates when the LED count changes    |
+    \*---------------------------------------------------------*/
+    std::vector<RGBColor>& back = frame_buffers[frame_write_idx];
+
+    back.assign(frame_staging.begin(), frame_staging.end());
+
+    unsigned int previous = frame_ready.exchange(frame_write_idx | FRAME_READY_FRESH, std::memory_order_acq_rel);
+
+    frame_write_idx = previous & FRAME_READY_INDEX_MASK;
+
+    FrameMutex.unlock();
+}
+
+bool RGBController::TakeFrame()
+{
+    /*---------------------------------------------------------*\
+    | Called on the device thread only.  Swap the published     |
+    | buffer for the one last taken and copy it into colors     |
+    \*---------------------------------------------------------*/
+    if((frame_ready.load(std::memory_order_acquire) & FRAME_READY_FRESH) == 0)
+    {
+        return(false);
+    }
+
+    unsigned int previous = frame_ready.exchange(frame_read_idx, std::memory_order_acq_rel);
+
+    frame_read_idx = previous & FRAME_READY_INDEX_MASK;
+
+    std::vector<RGBColor>& front = frame_buffers[frame_read_idx];
+
+    std::lock_guard<std::mutex> colors_lock(ColorsMutex);
+
+    if((front.size() == colors.size()) && (front.size() > 0))
+    {
+        memcpy(colors.data(), front.data(), front.size() * sizeof(RGBColor));
     }
+
+    return(true);
 }
 
 int RGBController::GetMode()
@@ -1321,11 +2003,18 @@ int RGBController::GetMode()
     return(active_mode);
 }
 
-void RGBController::SetMode(int mode)
+void RGBController::SetMode(int mode, bool force)
 {
     active_mode = mode;
 
-    UpdateMode();
+    if(force)
+    {
+        ForceUpdateMode();
+    }
+    else
+    {
+        UpdateMode();
+    }
 }
 
 void RGBController::RegisterUpdateCallback(RGBControllerCallback new_callback, void * new_callback_arg)
@@ -1364,14 +2053,211 @@ void RGBController::SignalUpdate()
 }
 void RGBController::UpdateLEDs()
 {
+    /*---------------------------------------------------------*\
+    | If an update is already pending, this frame is coalesced  |
+    | into it                                                   |
+    \*---------------------------------------------------------*/
+    Stats.RecordQueued(CallFlag_UpdateLEDs.load());
+
     CallFlag_UpdateLEDs = true;
 
+    WakeDeviceThread();
+
     SignalUpdate();
 }
 
 void RGBController::UpdateMode()
 {
     CallFlag_UpdateMode = true;
+
+    WakeDeviceThread();
+}
+
+void RGBController::InvalidateMode()
+{
+    /*---------------------------------------------------------*\
+    | Taken by the device thread with the next mode update, so  |
+    | an update already in flight can't consume it early        |
+    \*---------------------------------------------------------*/
+    CallFlag_ForceMode = true;
+}
+
+void RGBController::ForceUpdateMode()
+{
+    InvalidateMode();
+
+    UpdateMode();
+}
+
+void RGBController::WakeDeviceThread()
+{
+    /*---------------------------------------------------------*\
+    | Taking the lock orders the flag store before the device   |
+    | thread's check, so the notify can't be missed             |
+    \*---------------------------------------------------------*/
+    {
+        std::lock_guard<std::mutex> lock(CallMutex);
+    }
+
+    CallCondition.notify_one();
+}
+
+RGBColor * RGBController::BeginStagedFrame()
+{
+    StageMutex.lock();
+
+    /*---------------------------------------------------------*\
+    | Start from the last frame written unless something is     |
+    | already staged, so partial stages before one commit add   |
+    | up                                                        |
+    \*---------------------------------------------------------*/
+    if(!FrameStaged.load() || (frame_staged.size() != colors.size()))
+    {
+        std::lock_guard<std::mutex> lock(FrameMutex);
+
+        if(frame_staging.size() == colors.size())
+        {
+            frame_staged = frame_staging;
+        }
+        else
+        {
+            std::lock_guard<std::mutex> colors_lock(ColorsMutex);
+
+            frame_staged = colors;
+        }
+    }
+
+    return(frame_staged.data());
+}
+
+void RGBController::StageLEDs()
+{
+    FrameStaged = true;
+
+    StageMutex.unlock();
+}
+
+bool RGBController::CommitLEDs(std::chrono::steady_clock::time_point commit_time)
+{
+    {
+        std::lock_guard<std::mutex> lock(StageMutex);
+
+        if(!FrameStaged.exchange(false))
+        {
+            return(false);
+        }
+
+        /*---------------------------------------------------------*\
+        | Publish the staged colors as the next frame               |
+        \*---------------------------------------------------------*/
+        if(frame_staged.size() == colors.size())
+        {
+            RGBColor* frame = BeginFrame();
+
+            memcpy(frame, frame_staged.data(), frame_staged.size() * sizeof(RGBColor));
+
+            PublishFrame();
+        }
+    }
+
+    Stats.RecordCommitted(commit_time);
+
+    UpdateLEDs();
+
+    return(true);
+}
+
+void RGBController::CommitStagedLEDs(std::vector<RGBController*>& controllers)
+{
+    /*---------------------------------------------------------*\
+    | Every device gets the same commit time so the recorded    |
+    | skew is measured from one point                           |
+    \*---------------------------------------------------------*/
+    std::chrono::steady_clock::time_point commit_time = std::chrono::steady_clock::now();
+
+    for(std::size_t controller_idx = 0; controller_idx < controllers.size(); controller_idx++)
+    {
+        controllers[controller_idx]->CommitLEDs(commit_time);
+    }
+}
+
+RGBOutputStageParams RGBController::GetOutputStage()
+{
+    return(OutputStage.GetParams());
+}
+
+void RGBController::SetOutputStage(RGBOutputStageParams& params)
+{
+    OutputStage.SetParams(params);
+
+    RefreshOutput();
+}
+
+bool RGBController::GetOutputStageActive()
+{
+    return(!OutputStage.IsIdentity());
+}
+
+void RGBController::RefreshOutput()
+{
+    /*---------------------------------------------------------*\
+    | Resend the current frame through the output stage.  Only  |
+    | per-LED modes are affected, hardware effects are left     |
+    | running                                                   |
+    \*---------------------------------------------------------*/
+    if((active_mode >= 0) && ((std::size_t)active_mode < modes.size())
+    && (modes[active_mode].color_mode == MODE_COLORS_PER_LED))
+    {
+        UpdateLEDs();
+    }
+}
+
+void RGBController::DeviceUpdateLEDsWithOutputStage()
+{
+    /*---------------------------------------------------------*\
+    | Drivers read colors directly, so the corrected frame is   |
+    | written in place for the duration of the device call and  |
+    | the uncorrected frame is put back afterwards.  The        |
+    | buffers are only reallocated when the LED count changes   |
+    | and colors stays locked until it holds the frame again    |
+    \*---------------------------------------------------------*/
+    std::lock_guard<std::mutex> colors_lock(ColorsMutex);
+
+    std::size_t num_colors = colors.size();
+
+    if(output_user_colors.size() != num_colors)
+    {
+        output_user_colors.resize(num_colors);
+        output_device_colors.resize(num_colors);
+    }
+
+    if(num_colors > 0)
+    {
+        memcpy(output_user_colors.data(), colors.data(), num_colors * sizeof(RGBColor));
+
+        OutputStage.Apply(output_user_colors.data(), num_colors, output_device_colors.data());
+
+        memcpy(colors.data(), output_device_colors.data(), num_colors * sizeof(RGBColor));
+    }
+
+    DeviceUpdateLEDs();
+
+    /*---------------------------------------------------------*\
+    | Only this thread writes colors, so the frame can be put   |
+    | back as a whole                                           |
+    \*---------------------------------------------------------*/
+    if((colors.size() == num_colors) && (num_colors > 0))
+    {
+        memcpy(colors.data(), output_user_colors.data(), num_colors * sizeof(RGBColor));
+    }
+}
+
+bool RGBController::GetUpdatePending()
+{
+    /*---------------------------------------------------------*\
+    | Flags are cleared once the device call has returned       |
+    \*---------------------------------------------------------*/
+    return(CallFlag_UpdateMode.load() || CallFlag_UpdateLEDs.load());
 }
 
 void RGBController::DeviceUpdateLEDs()
@@ -1384,6 +2270,69 @@ void RGBController::DeviceUpdateMode()
 
 }
 
+bool RGBController::ModeChanged(bool force)
+{
+    /*---------------------------------------------------------*\
+    | An out of range mode is passed on to the driver as before |
+    \*---------------------------------------------------------*/
+    if((active_mode < 0) || ((std::size_t)active_mode >= modes.size()))
+    {
+        applied_mode_valid = false;
+        return(true);
+    }
+
+    const mode& new_mode = modes[active_mode];
+
+    /*---------------------------------------------------------*\
+    | Compare the fields a driver sends, the name and limits    |
+    | only describe the mode                                    |
+    \*---------------------------------------------------------*/
+    if(!force
+    && dedup_mode_updates
+    && applied_mode_valid.load()
+    && (applied_mode_idx        == active_mode          )
+    && (applied_mode_value      == new_mode.value       )
+    && (applied_mode_flags      == new_mode.flags       )
+    && (applied_mode_speed      == new_mode.speed       )
+    && (applied_mode_direction  == new_mode.direction   )
+    && (applied_mode_color_mode == new_mode.color_mode  )
+    && (applied_mode_colors     == new_mode.colors      ))
+    {
+        return(false);
+    }
+
+    /*---------------------------------------------------------*\
+    | Record the new mode before the driver call so an I/O      |
+    | error reported during it invalidates the new state.  The  |
+    | colors are copied into the existing buffer, which only    |
+    | reallocates when the number of mode colors grows          |
+    \*---------------------------------------------------------*/
+    applied_mode_idx        = active_mode;
+    applied_mode_value      = new_mode.value;
+    applied_mode_flags      = new_mode.flags;
+    applied_mode_speed      = new_mode.speed;
+    applied_mode_direction  = new_mode.direction;
+    applied_mode_color_mode = new_mode.color_mode;
+    applied_mode_colors.assign(new_mode.colors.begin(), new_mode.colors.end());
+    applied_mode_valid      = true;
+
+    return(true);
+}
+
+void RGBController::StopDeviceThread()
+{
+    if(DeviceCallThread == NULL)
+    {
+        return;
+    }
+
+    DeviceThreadRunning = false;
+    WakeDeviceThread();
+    DeviceCallThread->join();
+    delete DeviceCallThread;
+    DeviceCallThread = NULL;
+}
+
 void RGBController::DeviceCallThreadFunction()
 {
     CallFlag_UpdateLEDs = false;
@@ -1393,21 +2342,91 @@ void RGBController::DeviceCallThreadFunction()
     {
         if(CallFlag_UpdateMode.load() == true)
         {
-            DeviceUpdateMode();
-            CallFlag_UpdateMode = false;
+            /*-----------------------------------------------------*\
+            | A skipped mode update leaves the published frame for  |
+            | the next LED update to take                           |
+            \*-----------------------------------------------------*/
+            if(ModeChanged(CallFlag_ForceMode.exchange(false)))
+            {
+                TakeFrame();
+                DeviceUpdateMode();
+                CallFlag_UpdateMode = false;
+
+                Stats.RecordUpdateMode();
+            }
+            else
+            {
+                CallFlag_UpdateMode = false;
+
+                Stats.RecordUpdateModeSkipped();
+            }
         }
         if(CallFlag_UpdateLEDs.load() == true)
         {
-            DeviceUpdateLEDs();
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+            bool new_frame  = TakeFrame();
+            bool identity   = OutputStage.IsIdentity();
+
+            if(identity)
+            {
+                DeviceUpdateLEDs();
+            }
+            else
+            {
+                DeviceUpdateLEDsWithOutputStage();
+            }
+
             CallFlag_UpdateLEDs = false;
+
+            Stats.RecordUpdateLEDs(start, std::chrono::steady_clock::now());
+
+            /*-----------------------------------------------------*\
+            | Viewers read colors, so let them repaint once the     |
+            | frame they were told about has actually been copied   |
+            | in, or was changed in place by the output stage       |
+            \*-----------------------------------------------------*/
+            if(new_frame || !identity)
+            {
+                SignalUpdate();
+            }
         }
         else
         {
-           std::this_thread::sleep_for(1ms);
+            /*-----------------------------------------------------*\
+            | Sleep until an update is queued.  The timeout keeps   |
+            | the old 1ms poll as a fallback                        |
+            \*-----------------------------------------------------*/
+            std::unique_lock<std::mutex> lock(CallMutex);
+
+            CallCondition.wait_for(lock, 1ms, [this]
+            {
+                return(CallFlag_UpdateLEDs.load() || CallFlag_UpdateMode.load() || !DeviceThreadRunning.load());
+            });
         }
     }
 }
 
+RGBControllerStatsSnapshot RGBController::GetStats()
+{
+    return(Stats.GetSnapshot());
+}
+
+void RGBController::ResetStats()
+{
+    Stats.Reset();
+}
+
+void RGBController::ReportIOError()
+{
+    /*---------------------------------------------------------*\
+    | The device may not have taken the last mode               |
+    \*---------------------------------------------------------*/
+    applied_mode_valid = false;
+
+    Stats.RecordIOError();
+}
+
 std::string device_type_to_str(device_type type)
 {
     switch(type)
@@ -15,14 +15,18 @@
 #include <thread>
 #include <chrono>
 #include <mutex>
+#include <condition_variable>
+
+#include "RGBControllerStats.h"
+#include "RGBOutputStage.h"
 
 typedef unsigned int RGBColor;
 
-#define RGBGetRValue(rgb)   (rgb & 0x000000FF)
-#define RGBGetGValue(rgb)   ((rgb >> 8) & 0x000000FF)
-#define RGBGetBValue(rgb)   ((rgb >> 16) & 0x000000FF)
+#define RGBGetRValue(rgb)   ((rgb) & 0x000000FF)
+#define RGBGetGValue(rgb)   (((rgb) >> 8) & 0x000000FF)
+#define RGBGetBValue(rgb)   (((rgb) >> 16) & 0x000000FF)
 
-#define ToRGBColor(r, g, b) ((b << 16) | (g << 8) | (r))
+#define ToRGBColor(r, g, b) (((b) << 16) | ((g) << 8) | (r))
 
 /*------------------------------------------------------------------*\
 | Mode Flags                                                         |
@@ -127,6 +131,24 @@ typedef struct
     unsigned int *          map;
 } matrix_map_type;
 
+/*---------------------------------------------------------*\
+| Matrix maps are allocated in chunks of this size, so the  |
+| maps of a device sit next to each other in memory         |
+\*---------------------------------------------------------*/
+#define MATRIX_MAP_ARENA_CHUNK_SIZE     4096
+
+/*---------------------------------------------------------*\
+| Set in frame_ready when the published frame is new        |
+\*---------------------------------------------------------*/
+#define FRAME_READY_FRESH               0x80000000
+#define FRAME_READY_INDEX_MASK          0x00000003
+
+/*---------------------------------------------------------*\
+| Second word of a compact device description.  The legacy  |
+| format has the device type there, which is always small   |
+\*---------------------------------------------------------*/
+#define RGBCONTROLLER_COMPACT_MAGIC     0x43425247      /* "GRBC"                           */
+
 typedef struct
 {
     std::string             name;           /* Zone name                */
@@ -153,7 +175,7 @@ public:
     std::vector<led>        leds;           /* LEDs                     */
     std::vector<zone>       zones;          /* Zones                    */
     std::vector<mode>       modes;          /* Modes                    */
-    std::vector<RGBColor>   colors;         /* Color buffer             */
+    std::vector<RGBColor>   colors;         /* Last sent color frame    */
     device_type             type;           /* device type              */
     int                     active_mode = 0;/* active mode              */
 
@@ -168,16 +190,38 @@ public:
     \*---------------------------------------------------------*/
     void                    SetupColors();
 
+    matrix_map_type *       NewMatrixMap(unsigned int height, unsigned int width, const unsigned int* map = NULL);
+
     RGBColor                GetLED(unsigned int led);
+    std::vector<RGBColor>   GetLEDs();
     void                    SetLED(unsigned int led, RGBColor color);
     void                    SetAllLEDs(RGBColor color);
     void                    SetAllZoneLEDs(int zone, RGBColor color);
 
+    /*---------------------------------------------------------*\
+    | Frame writing.  colors belongs to the device call thread, |
+    | which copies in the latest published frame before each    |
+    | device call.  Writers fill the staging frame returned by  |
+    | BeginFrame (colors.size() entries, holding the last frame |
+    | written) and make it visible with PublishFrame.  Writers  |
+    | are serialized and only wait on the device thread to copy |
+    | colors when the staging frame is first started            |
+    \*---------------------------------------------------------*/
+    RGBColor *              BeginFrame();
+    void                    PublishFrame();
+
     int                     GetMode();
-    void                    SetMode(int mode);
+    void                    SetMode(int mode, bool force = false);
 
+    /*---------------------------------------------------------*\
+    | The compact description stores each string once, sends    |
+    | numbered LED names as runs and uses varints.  Read takes  |
+    | either format, never reads past data_size and leaves the  |
+    | controller untouched if the description is malformed      |
+    \*---------------------------------------------------------*/
     unsigned char *         GetDeviceDescription();
-    void                    ReadDeviceDescription(unsigned char* data_buf);
+    unsigned char *         GetDeviceDescriptionCompact();
+    bool                    ReadDeviceDescription(unsigned char* data_buf, unsigned int data_size);
 
     unsigned char *         GetModeDescription(int mode);
     void                    SetModeDescription(unsigned char* data_buf);
@@ -199,9 +243,60 @@ public:
     //void                    UpdateZoneLEDs(int zone);
     //void                    UpdateSingleLED(int led);
 
+    /*---------------------------------------------------------*\
+    | UpdateMode only reaches DeviceUpdateMode if the active    |
+    | mode or its settings differ from the last ones sent.      |
+    | InvalidateMode makes the next mode update reach the       |
+    | device even if nothing changed, ForceUpdateMode also      |
+    | queues that update.  Use them when the hardware state may |
+    | no longer match, e.g. profile loads and custom mode       |
+    \*---------------------------------------------------------*/
     void                    UpdateMode();
+    void                    InvalidateMode();
+    void                    ForceUpdateMode();
+
+    bool                    GetUpdatePending();
+
+    /*---------------------------------------------------------*\
+    | Frame commit.  Staged colors are written to their own     |
+    | buffer between BeginStagedFrame and StageLEDs, so other   |
+    | updates never send them early.  CommitLEDs publishes the  |
+    | staged buffer as the next frame and queues it, and        |
+    | CommitStagedLEDs commits the listed devices with one      |
+    | commit time so their device threads start together        |
+    \*---------------------------------------------------------*/
+    RGBColor *              BeginStagedFrame();
+    void                    StageLEDs();
+    void                    StageColorDescription(unsigned char* data_buf);
+    bool                    CommitLEDs(std::chrono::steady_clock::time_point commit_time);
+    static void             CommitStagedLEDs(std::vector<RGBController*>& controllers);
 
     void                    DeviceCallThreadFunction();
+    void                    DeviceUpdateLEDsWithOutputStage();
+
+    RGBOutputStageParams    GetOutputStage();
+    void                    SetOutputStage(RGBOutputStageParams& params);
+    void                    RefreshOutput();
+    bool                    GetOutputStageActive();
+
+    /*---------------------------------------------------------*\
+    | Stop the device thread.  Drivers call this first in their |
+    | destructor so the thread can't reach the hardware while   |
+    | it is being released.  Safe to call more than once        |
+    \*---------------------------------------------------------*/
+    void                    StopDeviceThread();
+
+    virtual RGBControllerStatsSnapshot  GetStats();
+    void                                ResetStats();
+
+    /*---------------------------------------------------------*\
+    | Called by a driver when a write to the device fails.      |
+    | Only the serial LED strip driver checks its writes, the   |
+    | HID and libusb drivers discard the return value of        |
+    | hid_write and the libusb transfers, so io_errors stays at |
+    | zero for every other device                               |
+    \*---------------------------------------------------------*/
+    void                                ReportIOError();
 
     /*---------------------------------------------------------*\
     | Functions to be implemented in device implementation      |
@@ -218,15 +313,77 @@ public:
 
     virtual void            SetCustomMode()                             = 0;
 
+protected:
+    /*---------------------------------------------------------*\
+    | Cleared by controllers whose device can change mode       |
+    | without going through this process, e.g. network devices  |
+    | shared with other clients, so every mode update is sent   |
+    \*---------------------------------------------------------*/
+    bool                    dedup_mode_updates;
+
 private:
+    bool                    ReadDeviceDescriptionCompact(unsigned char* data_buf, unsigned int data_size);
+
+    void                    WakeDeviceThread();
+    bool                    TakeFrame();
+    bool                    ModeChanged(bool force);
+
     std::thread*            DeviceCallThread;
     std::atomic<bool>       CallFlag_UpdateLEDs;
     std::atomic<bool>       CallFlag_UpdateMode;
+    std::atomic<bool>       CallFlag_ForceMode;
     std::atomic<bool>       DeviceThreadRunning;
+    std::atomic<bool>       FrameStaged;
+    std::mutex              StageMutex;
+    std::vector<RGBColor>   frame_staged;
+    std::mutex              CallMutex;
+    std::condition_variable CallCondition;
+    RGBControllerStats      Stats;
+    RGBOutputStage          OutputStage;
+    std::vector<RGBColor>   output_user_colors;
+    std::vector<RGBColor>   output_device_colors;
+
+    /*---------------------------------------------------------*\
+    | Settings of the mode last sent by DeviceUpdateMode, only  |
+    | used by the device thread.  Invalidated when the zones    |
+    | are set up again or the driver reports an I/O error, so   |
+    | the next mode update always reaches the device            |
+    \*---------------------------------------------------------*/
+    int                     applied_mode_idx;
+    int                     applied_mode_value;
+    unsigned int            applied_mode_flags;
+    unsigned int            applied_mode_speed;
+    unsigned int            applied_mode_direction;
+    unsigned int            applied_mode_color_mode;
+    std::vector<RGBColor>   applied_mode_colors;
+    std::atomic<bool>       applied_mode_valid;
     //bool                    CallFlag_UpdateZoneLEDs                     = false;
     //bool                    CallFlag_UpdateSingleLED                    = false;
     //bool                    CallFlag_UpdateMode                         = false;
 
+    /*---------------------------------------------------------*\
+    | Triple buffered frames.  frame_ready holds the index of   |
+    | the last published buffer plus FRAME_READY_FRESH if the   |
+    | device thread hasn't taken it yet.  The writer and device |
+    | thread each own one of the other two buffers              |
+    \*---------------------------------------------------------*/
+    std::mutex                          FrameMutex;
+    std::vector<RGBColor>               frame_staging;
+    std::vector<RGBColor>               frame_buffers[3];
+    unsigned int                        frame_write_idx;
+    unsigned int                        frame_read_idx;
+    std::atomic<unsigned int>           frame_ready;
+
+    /*---------------------------------------------------------*\
+    | Held by the device thread while it writes colors and by   |
+    | other threads while they read it, taken after FrameMutex  |
+    \*---------------------------------------------------------*/
+    std::mutex                          ColorsMutex;
+
+    std::vector<unsigned char *>        matrix_map_arena;
+    unsigned char *                     matrix_map_chunk;
+    std::size_t                         matrix_map_chunk_used;
+
     std::mutex                          UpdateMutex;
     std::vector<RGBControllerCallback>  UpdateCallbacks;
     std::vector<void *>                 UpdateCallbackArgs;
@@ -0,0 +1,467 @@
+/*-----------------------------------------*\
+|  RGBControllerStats.cpp                   |
+|                                           |
+|  Lock-free timing counters for the        |
+|  RGBController device call thread         |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "RGBControllerStats.h"
+#include <cstring>
+
+RGBControllerStats::RGBControllerStats()
+{
+    Reset();
+}
+
+void RGBControllerStats::UpdateMax(std::atomic<unsigned int>& max, unsigned int value)
+{
+    unsigned int current = max.load(std::memory_order_relaxed);
+
+    while((value > current) && !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+unsigned int RGBControllerStats::GetBucket(unsigned int value_us)
+{
+    unsigned int bucket = 0;
+
+    while((value_us > 0) && (bucket < (RGBCONTROLLER_STATS_NUM_BUCKETS - 1)))
+    {
+        value_us >>= 1;
+        bucket++;
+    }
+
+    return(bucket);
+}
+
+unsigned int RGBControllerStats::GetBucketUpperBound(unsigned int bucket)
+{
+    if(bucket >= (RGBCONTROLLER_STATS_NUM_BUCKETS - 1))
+    {
+        bucket = RGBCONTROLLER_STATS_NUM_BUCKETS - 1;
+    }
+
+    return(1 << bucket);
+}
+
+/*---------------------------------------------------------*\
+| Returns the upper bound (us) of the bucket containing the |
+| given percentile (0.0 - 1.0) or 0 if there are no samples |
+\*---------------------------------------------------------*/
+unsigned int RGBControllerStats::GetPercentile(const unsigned int* hist, double percentile)
+{
+    unsigned long long total = 0;
+
+    for(unsigned int bucket = 0; bucket < RGBCONTROLLER_STATS_NUM_BUCKETS; bucket++)
+    {
+        total += hist[bucket];
+    }
+
+    if(total == 0)
+    {
+        return(0);
+    }
+
+    unsigned long long target   = (unsigned long long)(percentile * total);
+    unsigned long long count    = 0;
+
+    for(unsigned int bucket = 0; bucket < RGBCONTROLLER_STATS_NUM_BUCKETS; bucket++)
+    {
+        count += hist[bucket];
+
+        if(count > target)
+        {
+            return(GetBucketUpperBound(bucket));
+        }
+    }
+
+    return(GetBucketUpperBound(RGBCONTROLLER_STATS_NUM_BUCKETS - 1));
+}
+
+void RGBControllerStats::RecordQueued(bool already_pending)
+{
+    if(already_pending)
+    {
+        frames_coalesced.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        queued_time.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+    }
+}
+
+void RGBControllerStats::RecordCommitted(std::chrono::steady_clock::time_point commit_time)
+{
+    committed_time.store(commit_time.time_since_epoch().count(), std::memory_order_relaxed);
+}
+
+void RGBControllerStats::RecordUpdateLEDs(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    /*---------------------------------------------------------*\
+    | Queue-to-start latency, only valid if UpdateLEDs queued   |
+    | this update                                               |
+    \*---------------------------------------------------------*/
+    long long queued = queued_time.exchange(0, std::memory_order_relaxed);
+
+    if(queued != 0)
+    {
+        std::chrono::steady_clock::time_point queued_point{std::chrono::steady_clock::duration(queued)};
+
+        long long latency_us = std::chrono::duration_cast<std::chrono::microseconds>(start - queued_point).count();
+
+        if(latency_us < 0)
+        {
+            latency_us = 0;
+        }
+
+        queue_latency_total.fetch_add(latency_us, std::memory_order_relaxed);
+        queue_latency_hist[GetBucket((unsigned int)latency_us)].fetch_add(1, std::memory_order_relaxed);
+        UpdateMax(queue_latency_max, (unsigned int)latency_us);
+    }
+
+    /*---------------------------------------------------------*\
+    | Commit-to-start skew, only valid if a frame commit        |
+    | released this update                                      |
+    \*---------------------------------------------------------*/
+    long long committed = committed_time.exchange(0, std::memory_order_relaxed);
+
+    if(committed != 0)
+    {
+        std::chrono::steady_clock::time_point committed_point{std::chrono::steady_clock::duration(committed)};
+
+        long long skew_us = std::chrono::duration_cast<std::chrono::microseconds>(start - committed_point).count();
+
+        if(skew_us < 0)
+        {
+            skew_us = 0;
+        }
+
+        commit_count.fetch_add(1, std::memory_order_relaxed);
+        commit_skew_total.fetch_add(skew_us, std::memory_order_relaxed);
+        commit_skew_hist[GetBucket((unsigned int)skew_us)].fetch_add(1, std::memory_order_relaxed);
+        UpdateMax(commit_skew_max, (unsigned int)skew_us);
+    }
+
+    /*---------------------------------------------------------*\
+    | DeviceUpdateLEDs duration                                 |
+    \*---------------------------------------------------------*/
+    long long duration_us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    update_leds_count.fetch_add(1, std::memory_order_relaxed);
+    update_leds_total.fetch_add(duration_us, std::memory_order_relaxed);
+    update_leds_hist[GetBucket((unsigned int)duration_us)].fetch_add(1, std::memory_order_relaxed);
+    UpdateMax(update_leds_max, (unsigned int)duration_us);
+}
+
+void RGBControllerStats::RecordUpdateMode()
+{
+    update_mode_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RGBControllerStats::RecordUpdateModeSkipped()
+{
+    update_mode_skipped.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RGBControllerStats::RecordIOError()
+{
+    io_errors.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RGBControllerStats::Reset()
+{
+    queued_time         = 0;
+    committed_time      = 0;
+    update_leds_count   = 0;
+    update_mode_count   = 0;
+    frames_coalesced    = 0;
+    io_errors           = 0;
+    queue_latency_max   = 0;
+    update_leds_max     = 0;
+    queue_latency_total = 0;
+    update_leds_total   = 0;
+    commit_count        = 0;
+    commit_skew_max     = 0;
+    commit_skew_total   = 0;
+    update_mode_skipped = 0;
+
+    for(unsigned int bucket = 0; bucket < RGBCONTROLLER_STATS_NUM_BUCKETS; bucket++)
+    {
+        queue_latency_hist[bucket]  = 0;
+        update_leds_hist[bucket]    = 0;
+        commit_skew_hist[bucket]    = 0;
+    }
+}
+
+RGBControllerStatsSnapshot RGBControllerStats::GetSnapshot()
+{
+    RGBControllerStatsSnapshot snapshot;
+
+    snapshot.update_leds_count      = update_leds_count.load(std::memory_order_relaxed);
+    snapshot.update_mode_count      = update_mode_count.load(std::memory_order_relaxed);
+    snapshot.frames_coalesced       = frames_coalesced.load(std::memory_order_relaxed);
+    snapshot.io_errors              = io_errors.load(std::memory_order_relaxed);
+    snapshot.queue_latency_max      = queue_latency_max.load(std::memory_order_relaxed);
+    snapshot.update_leds_max        = update_leds_max.load(std::memory_order_relaxed);
+    snapshot.queue_latency_total    = queue_latency_total.load(std::memory_order_relaxed);
+    snapshot.update_leds_total      = update_leds_total.load(std::memory_order_relaxed);
+    snapshot.commit_count           = commit_count.load(std::memory_order_relaxed);
+    snapshot.commit_skew_max        = commit_skew_max.load(std::memory_order_relaxed);
+    snapshot.commit_skew_total      = commit_skew_total.load(std::memory_order_relaxed);
+    snapshot.update_mode_skipped    = update_mode_skipped.load(std::memory_order_relaxed);
+
+    for(unsigned int bucket = 0; bucket < RGBCONTROLLER_STATS_NUM_BUCKETS; bucket++)
+    {
+        snapshot.queue_latency_hist[bucket] = queue_latency_hist[bucket].load(std::memory_order_relaxed);
+        snapshot.update_leds_hist[bucket]   = update_leds_hist[bucket].load(std::memory_order_relaxed);
+        snapshot.commit_skew_hist[bucket]   = commit_skew_hist[bucket].load(std::memory_order_relaxed);
+    }
+
+    return(snapshot);
+}
+
+/*---------------------------------------------------------*\
+| Stats description layout                                  |
+|   unsigned int        data_size                           |
+|   unsigned short      num_buckets                         |
+|   unsigned int        update_leds_count                   |
+|   unsigned int        update_mode_count                   |
+|   unsigned int        frames_coalesced                    |
+|   unsigned int        io_errors                           |
+|   unsigned int        queue_latency_max                   |
+|   unsigned int        update_leds_max                     |
+|   unsigned long long  queue_latency_total                 |
+|   unsigned long long  update_leds_total                   |
+|   unsigned int[num]   queue_latency_hist                  |
+|   unsigned int[num]   update_leds_hist                    |
+|   unsigned int        commit_count                        |
+|   unsigned int        commit_skew_max                     |
+|   unsigned long long  commit_skew_total                   |
+|   unsigned int[num]   commit_skew_hist                    |
+|   unsigned int        update_mode_skipped                 |
+|                                                           |
+| The commit fields and update_mode_skipped were added      |
+| later and are optional when reading                       |
+\*---------------------------------------------------------*/
+unsigned char * RGBControllerStats::GetDescription(RGBControllerStatsSnapshot& snapshot)
+{
+    unsigned int    data_ptr    = 0;
+    unsigned int    data_size   = 0;
+    unsigned short  num_buckets = RGBCONTROLLER_STATS_NUM_BUCKETS;
+
+    /*---------------------------------------------------------*\
+    | Calculate data size                                       |
+    \*---------------------------------------------------------*/
+    data_size += sizeof(data_size);
+    data_size += sizeof(num_buckets);
+    data_size += 6 * sizeof(unsigned int);
+    data_size += 2 * sizeof(unsigned long long);
+    data_size += 2 * num_buckets * sizeof(unsigned int);
+    data_size += 2 * sizeof(unsigned int);
+    data_size += sizeof(unsigned long long);
+    data_size += num_buckets * sizeof(unsigned int);
+    data_size += sizeof(unsigned int);
+
+    /*---------------------------------------------------------*\
+    | Create data buffer                                        |
+    \*---------------------------------------------------------*/
+    unsigned char *data_buf = new unsigned char[data_size];
+
+    /*---------------------------------------------------------*\
+    | Copy in data size                                         |
+    \*---------------------------------------------------------*/
+    memcpy(&data_buf[data_ptr], &data_size, sizeof(data_size));
+    data_ptr += sizeof(data_size);
+
+    /*---------------------------------------------------------*\
+    | Copy in number of histogram buckets                       |
+    \*---------------------------------------------------------*/
+    memcpy(&data_buf[data_ptr], &num_buckets, sizeof(num_buckets));
+    data_ptr += sizeof(num_buckets);
+
+    /*---------------------------------------------------------*\
+    | Copy in counters                                          |
+    \*---------------------------------------------------------*/
+    memcpy(&data_buf[data_ptr], &snapshot.update_leds_count, sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    memcpy(&data_buf[data_ptr], &snapshot.update_mode_count, sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    memcpy(&data_buf[data_ptr], &snapshot.frames_coalesced, sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    memcpy(&data_buf[data_ptr], &snapshot.io_errors, sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    memcpy(&data_buf[data_ptr], &snapshot.queue_latency_max, sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    memcpy(&data_buf[data_ptr], &snapshot.update_leds_max, sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    memcpy(&data_buf[data_ptr], &snapshot.queue_latency_total, sizeof(unsigned long long));
+    data_ptr += sizeof(unsigned long long);
+
+    memcpy(&data_buf[data_ptr], &snapshot.update_leds_total, sizeof(unsigned long long));
+    data_ptr += sizeof(unsigned long long);
+
+    /*---------------------------------------------------------*\
+    | Copy in histograms                                        |
+    \*---------------------------------------------------------*/
+    memcpy(&data_buf[data_ptr], snapshot.queue_latency_hist, num_buckets * sizeof(unsigned int));
+    data_ptr += num_buckets * sizeof(unsigned int);
+
+    memcpy(&data_buf[data_ptr], snapshot.update_leds_hist, num_buckets * sizeof(unsigned int));
+    data_ptr += num_buckets * sizeof(unsigned int);
+
+    /*---------------------------------------------------------*\
+    | Copy in frame commit counters and histogram               |
+    \*---------------------------------------------------------*/
+    memcpy(&data_buf[data_ptr], &snapshot.commit_count, sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    memcpy(&data_buf[data_ptr], &snapshot.commit_skew_max, sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    memcpy(&data_buf[data_ptr], &snapshot.commit_skew_total, sizeof(unsigned long long));
+    data_ptr += sizeof(unsigned long long);
+
+    memcpy(&data_buf[data_ptr], snapshot.commit_skew_hist, num_buckets * sizeof(unsigned int));
+    data_ptr += num_buckets * sizeof(unsigned int);
+
+    /*---------------------------------------------------------*\
+    | Copy in skipped mode update counter                       |
+    \*---------------------------------------------------------*/
+    memcpy(&data_buf[data_ptr], &snapshot.update_mode_skipped, sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    return(data_buf);
+}
+
+bool RGBControllerStats::ReadDescription(unsigned char* data_buf, unsigned int data_size, RGBControllerStatsSnapshot* snapshot)
+{
+    unsigned int    data_ptr    = sizeof(unsigned int);
+    unsigned short  num_buckets;
+
+    memset(snapshot, 0, sizeof(RGBControllerStatsSnapshot));
+
+    if(data_size < (sizeof(unsigned int) + sizeof(num_buckets)))
+    {
+        return(false);
+    }
+
+    /*---------------------------------------------------------*\
+    | Copy in number of histogram buckets                       |
+    \*---------------------------------------------------------*/
+    memcpy(&num_buckets, &data_buf[data_ptr], sizeof(num_buckets));
+    data_ptr += sizeof(num_buckets);
+
+    /*---------------------------------------------------------*\
+    | Check that the buffer holds everything it claims to       |
+    \*---------------------------------------------------------*/
+    if(data_size < (data_ptr + (6 * sizeof(unsigned int)) + (2 * sizeof(unsigned long long)) + (2 * num_buckets * sizeof(unsigned int))))
+    {
+        return(false);
+    }
+
+    /*---------------------------------------------------------*\
+    | Copy in counters                                          |
+    \*---------------------------------------------------------*/
+    memcpy(&snapshot->update_leds_count, &data_buf[data_ptr], sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    memcpy(&snapshot->update_mode_count, &data_buf[data_ptr], sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    memcpy(&snapshot->frames_coalesced, &data_buf[data_ptr], sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    memcpy(&snapshot->io_errors, &data_buf[data_ptr], sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    memcpy(&snapshot->queue_latency_max, &data_buf[data_ptr], sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    memcpy(&snapshot->update_leds_max, &data_buf[data_ptr], sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    memcpy(&snapshot->queue_latency_total, &data_buf[data_ptr], sizeof(unsigned long long));
+    data_ptr += sizeof(unsigned long long);
+
+    memcpy(&snapshot->update_leds_total, &data_buf[data_ptr], sizeof(unsigned long long));
+    data_ptr += sizeof(unsigned long long);
+
+    /*---------------------------------------------------------*\
+    | Copy in histograms, folding any extra buckets from a      |
+    | newer sender into the last bucket                         |
+    \*---------------------------------------------------------*/
+    for(unsigned int bucket = 0; bucket < num_buckets; bucket++)
+    {
+        unsigned int value;
+
+        memcpy(&value, &data_buf[data_ptr], sizeof(unsigned int));
+        data_ptr += sizeof(unsigned int);
+
+        snapshot->queue_latency_hist[(bucket < RGBCONTROLLER_STATS_NUM_BUCKETS) ? bucket : (RGBCONTROLLER_STATS_NUM_BUCKETS - 1)] += value;
+    }
+
+    for(unsigned int bucket = 0; bucket < num_buckets; bucket++)
+    {
+        unsigned int value;
+
+        memcpy(&value, &data_buf[data_ptr], sizeof(unsigned int));
+        data_ptr += sizeof(unsigned int);
+
+        snapshot->update_leds_hist[(bucket < RGBCONTROLLER_STATS_NUM_BUCKETS) ? bucket : (RGBCONTROLLER_STATS_NUM_BUCKETS - 1)] += value;
+    }
+
+    /*---------------------------------------------------------*\
+    | Older senders stop here                                   |
+    \*---------------------------------------------------------*/
+    if(data_size < (data_ptr + (2 * sizeof(unsigned int)) + sizeof(unsigned long long) + (num_buckets * sizeof(unsigned int))))
+    {
+        return(true);
+    }
+
+    /*---------------------------------------------------------*\
+    | Copy in frame commit counters and histogram               |
+    \*---------------------------------------------------------*/
+    memcpy(&snapshot->commit_count, &data_buf[data_ptr], sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    memcpy(&snapshot->commit_skew_max, &data_buf[data_ptr], sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    memcpy(&snapshot->commit_skew_total, &data_buf[data_ptr], sizeof(unsigned long long));
+    data_ptr += sizeof(unsigned long long);
+
+    for(unsigned int bucket = 0; bucket < num_buckets; bucket++)
+    {
+        unsigned int value;
+
+        memcpy(&value, &data_buf[data_ptr], sizeof(unsigned int));
+        data_ptr += sizeof(unsigned int);
+
+        snapshot->commit_skew_hist[(bucket < RGBCONTROLLER_STATS_NUM_BUCKETS) ? bucket : (RGBCONTROLLER_STATS_NUM_BUCKETS - 1)] += value;
+    }
+
+    /*---------------------------------------------------------*\
+    | Senders without mode update skipping stop here            |
+    \*---------------------------------------------------------*/
+    if(data_size < (data_ptr + sizeof(unsigned int)))
+    {
+        return(true);
+    }
+
+    /*---------------------------------------------------------*\
+    | Copy in skipped mode update counter                       |
+    \*---------------------------------------------------------*/
+    memcpy(&snapshot->update_mode_skipped, &data_buf[data_ptr], sizeof(unsigned int));
+    data_ptr += sizeof(unsigned int);
+
+    return(true);
+}
@@ -0,0 +1,92 @@
+/*-----------------------------------------*\
+|  RGBControllerStats.h                     |
+|                                           |
+|  Lock-free timing counters for the        |
+|  RGBController device call thread         |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+/*-----------------------------------------------------*\
+| Histogram buckets are powers of two in microseconds.  |
+| Bucket 0 holds samples under 1us, bucket N holds      |
+| samples in [2^(N-1), 2^N) and the last bucket holds   |
+| everything above 2^(N-2)us (~262ms)                   |
+\*-----------------------------------------------------*/
+#define RGBCONTROLLER_STATS_NUM_BUCKETS     20
+
+typedef struct
+{
+    unsigned int            update_leds_count;                                          /* DeviceUpdateLEDs calls       */
+    unsigned int            update_mode_count;                                          /* DeviceUpdateMode calls       */
+    unsigned int            frames_coalesced;                                           /* UpdateLEDs while pending     */
+    unsigned int            io_errors;                                                  /* LED strip write failures    */
+    unsigned int            queue_latency_max;                                          /* Max queue-to-start (us)      */
+    unsigned int            update_leds_max;                                            /* Max DeviceUpdateLEDs (us)    */
+    unsigned long long      queue_latency_total;                                        /* Sum of queue-to-start (us)   */
+    unsigned long long      update_leds_total;                                          /* Sum of DeviceUpdateLEDs (us) */
+    unsigned int            queue_latency_hist[RGBCONTROLLER_STATS_NUM_BUCKETS];        /* Queue-to-start histogram     */
+    unsigned int            update_leds_hist[RGBCONTROLLER_STATS_NUM_BUCKETS];          /* DeviceUpdateLEDs histogram   */
+    unsigned int            commit_count;                                               /* Frames released by a commit  */
+    unsigned int            commit_skew_max;                                            /* Max commit-to-start (us)     */
+    unsigned long long      commit_skew_total;                                          /* Sum of commit-to-start (us)  */
+    unsigned int            commit_skew_hist[RGBCONTROLLER_STATS_NUM_BUCKETS];          /* Commit-to-start histogram    */
+    unsigned int            update_mode_skipped;                                        /* UpdateMode with no change    */
+} RGBControllerStatsSnapshot;
+
+class RGBControllerStats
+{
+public:
+    RGBControllerStats();
+
+    /*---------------------------------------------------------*\
+    | Recording functions, safe to call from any thread         |
+    \*---------------------------------------------------------*/
+    void                        RecordQueued(bool already_pending);
+    void                        RecordCommitted(std::chrono::steady_clock::time_point commit_time);
+    void                        RecordUpdateLEDs(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+    void                        RecordUpdateMode();
+    void                        RecordUpdateModeSkipped();
+    void                        RecordIOError();
+
+    void                        Reset();
+
+    RGBControllerStatsSnapshot  GetSnapshot();
+
+    /*---------------------------------------------------------*\
+    | Helpers                                                   |
+    \*---------------------------------------------------------*/
+    static unsigned int         GetBucket(unsigned int value_us);
+    static unsigned int         GetBucketUpperBound(unsigned int bucket);
+    static unsigned int         GetPercentile(const unsigned int* hist, double percentile);
+
+    static unsigned char *      GetDescription(RGBControllerStatsSnapshot& snapshot);
+    static bool                 ReadDescription(unsigned char* data_buf, unsigned int data_size, RGBControllerStatsSnapshot* snapshot);
+
+private:
+    std::atomic<long long>              queued_time;
+    std::atomic<long long>              committed_time;
+
+    std::atomic<unsigned int>           update_leds_count;
+    std::atomic<unsigned int>           update_mode_count;
+    std::atomic<unsigned int>           frames_coalesced;
+    std::atomic<unsigned int>           io_errors;
+    std::atomic<unsigned int>           queue_latency_max;
+    std::atomic<unsigned int>           update_leds_max;
+    std::atomic<unsigned long long>     queue_latency_total;
+    std::atomic<unsigned long long>     update_leds_total;
+    std::atomic<unsigned int>           queue_latency_hist[RGBCONTROLLER_STATS_NUM_BUCKETS];
+    std::atomic<unsigned int>           update_leds_hist[RGBCONTROLLER_STATS_NUM_BUCKETS];
+    std::atomic<unsigned int>           commit_count;
+    std::atomic<unsigned int>           commit_skew_max;
+    std::atomic<unsigned long long>     commit_skew_total;
+    std::atomic<unsigned int>           commit_skew_hist[RGBCONTROLLER_STATS_NUM_BUCKETS];
+    std::atomic<unsigned int>           update_mode_skipped;
+
+    static void                 UpdateMax(std::atomic<unsigned int>& max, unsigned int value);
+};
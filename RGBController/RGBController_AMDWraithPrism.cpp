@@ -90,7 +90,9 @@ RGBController_AMDWraithPrism::RGBController_AMDWraithPrism(AMDWraithPrismControl
 
 RGBController_AMDWraithPrism::~RGBController_AMDWraithPrism()
 {
+    StopDeviceThread();
 
+    delete wraith;
 }
 
 void RGBController_AMDWraithPrism::SetupZones()
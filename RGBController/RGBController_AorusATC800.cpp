@@ -64,6 +64,13 @@ RGBController_AorusATC800::RGBController_AorusATC800(ATC800Controller* cooler_pt
     SetupZones();
 }
 
+RGBController_AorusATC800::~RGBController_AorusATC800()
+{
+    StopDeviceThread();
+
+    delete cooler;
+}
+
 void RGBController_AorusATC800::SetupZones()
 {
     zone atc800_cpu_fans_zone;
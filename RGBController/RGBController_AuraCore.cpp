@@ -40,6 +40,13 @@ RGBController_AuraCore::RGBController_AuraCore(AuraCoreController* aura_ptr)
     SetupZones();
 }
 
+RGBController_AuraCore::~RGBController_AuraCore()
+{
+    StopDeviceThread();
+
+    delete aura;
+}
+
 void RGBController_AuraCore::SetupZones()
 {
     zone Keyboard;
@@ -15,6 +15,7 @@ class RGBController_AuraCore : public RGBController
 {
 public:
     RGBController_AuraCore(AuraCoreController* aura_ptr);
+    ~RGBController_AuraCore();
 
     void        SetupZones();
 
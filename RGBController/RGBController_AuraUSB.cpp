@@ -101,7 +101,9 @@ RGBController_AuraUSB::RGBController_AuraUSB(AuraUSBController* aura_ptr)
 
 RGBController_AuraUSB::~RGBController_AuraUSB()
 {
+    StopDeviceThread();
 
+    delete aura;
 }
 
 void RGBController_AuraUSB::SetupZones()
@@ -74,7 +74,9 @@ RGBController_CMMP750Controller::RGBController_CMMP750Controller(CMMP750Controll
 
 RGBController_CMMP750Controller::~RGBController_CMMP750Controller()
 {
+    StopDeviceThread();
 
+    delete cmmp750;
 }
 
 void RGBController_CMMP750Controller::SetupZones()
@@ -66,6 +66,13 @@ RGBController_CorsairHydro::RGBController_CorsairHydro(CorsairHydroController* c
     SetupZones();
 }
 
+RGBController_CorsairHydro::~RGBController_CorsairHydro()
+{
+    StopDeviceThread();
+
+    delete corsair;
+}
+
 void RGBController_CorsairHydro::SetupZones()
 {
     zone new_zone;
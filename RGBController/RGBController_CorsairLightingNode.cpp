@@ -164,6 +164,13 @@ RGBController_CorsairLightingNode::RGBController_CorsairLightingNode(CorsairLigh
     SetupZones();
 }
 
+RGBController_CorsairLightingNode::~RGBController_CorsairLightingNode()
+{
+    StopDeviceThread();
+
+    delete corsair;
+}
+
 void RGBController_CorsairLightingNode::SetupZones()
 {
     /*-------------------------------------------------*\
@@ -575,7 +575,9 @@ RGBController_CorsairPeripheral::RGBController_CorsairPeripheral(CorsairPeripher
 
 RGBController_CorsairPeripheral::~RGBController_CorsairPeripheral()
 {
+    StopDeviceThread();
 
+    delete corsair;
 }
 
 void RGBController_CorsairPeripheral::SetupZones()
@@ -627,10 +629,7 @@ void RGBController_CorsairPeripheral::SetupZones()
 
                     if(zone_types[zone_idx] == ZONE_TYPE_MATRIX)
                     {
-                        new_zone.matrix_map         = new matrix_map_type;
-                        new_zone.matrix_map->height = 7;
-                        new_zone.matrix_map->width  = 24;
-                        new_zone.matrix_map->map    = (unsigned int *)&matrix_map_k95_platinum;
+                        new_zone.matrix_map         = NewMatrixMap(7, 24, (unsigned int *)&matrix_map_k95_platinum);
                     }
                     else
                     {
@@ -647,10 +646,7 @@ void RGBController_CorsairPeripheral::SetupZones()
 
                     if(zone_types[zone_idx] == ZONE_TYPE_MATRIX)
                     {
-                        new_zone.matrix_map         = new matrix_map_type;
-                        new_zone.matrix_map->height = 7;
-                        new_zone.matrix_map->width  = 26;
-                        new_zone.matrix_map->map    = (unsigned int *)&matrix_map_k95;
+                        new_zone.matrix_map         = NewMatrixMap(7, 26, (unsigned int *)&matrix_map_k95);
                     }
                     else
                     {
@@ -667,10 +663,7 @@ void RGBController_CorsairPeripheral::SetupZones()
 
                     if(zone_types[zone_idx] == ZONE_TYPE_MATRIX)
                     {
-                        new_zone.matrix_map         = new matrix_map_type;
-                        new_zone.matrix_map->height = 6;
-                        new_zone.matrix_map->width  = 23;
-                        new_zone.matrix_map->map    = (unsigned int *)&matrix_map;
+                        new_zone.matrix_map         = NewMatrixMap(6, 23, (unsigned int *)&matrix_map);
                     }
                     else
                     {
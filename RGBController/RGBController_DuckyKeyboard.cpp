@@ -191,7 +191,9 @@ RGBController_DuckyKeyboard::RGBController_DuckyKeyboard(DuckyKeyboardController
 
 RGBController_DuckyKeyboard::~RGBController_DuckyKeyboard()
 {
+    StopDeviceThread();
 
+    delete ducky;
 }
 
 void RGBController_DuckyKeyboard::SetupZones()
@@ -208,10 +210,7 @@ void RGBController_DuckyKeyboard::SetupZones()
         new_zone.leds_min           = zone_sizes[zone_idx];
         new_zone.leds_max           = zone_sizes[zone_idx];
         new_zone.leds_count         = zone_sizes[zone_idx];
-        new_zone.matrix_map         = new matrix_map_type;
-        new_zone.matrix_map->height = 6;
-        new_zone.matrix_map->width  = 23;
-        new_zone.matrix_map->map    = (unsigned int *)&matrix_map;
+        new_zone.matrix_map         = NewMatrixMap(6, 23, (unsigned int *)&matrix_map);
         zones.push_back(new_zone);
 
         total_led_count += zone_sizes[zone_idx];
@@ -13,6 +13,11 @@ RGBController_Dummy::RGBController_Dummy()
 
 }
 
+RGBController_Dummy::~RGBController_Dummy()
+{
+    StopDeviceThread();
+}
+
 void RGBController_Dummy::SetupZones()
 {
 
@@ -8,8 +8,11 @@
 \*-----------------------------------------*/
 
 #include "RGBController_E131.h"
+#include "RGBColorTransform.h"
 #include <e131.h>
 #include <math.h>
+#include <algorithm>
+#include <cstring>
 
 using namespace std::chrono_literals;
 
@@ -85,11 +88,7 @@ RGBController_E131::RGBController_E131(std::vector<E131Device> device_list)
         if(devices[device_idx].type == ZONE_TYPE_MATRIX)
         {
             unsigned int led_idx = 0;
-            matrix_map_type * new_map = new matrix_map_type;
-
-            new_map->width = devices[device_idx].matrix_width;
-            new_map->height = devices[device_idx].matrix_height;
-            new_map->map = new unsigned int[devices[device_idx].matrix_width * devices[device_idx].matrix_height];
+            matrix_map_type * new_map = NewMatrixMap(devices[device_idx].matrix_height, devices[device_idx].matrix_width);
 
             switch(devices[device_idx].matrix_order)
             {
@@ -238,9 +237,21 @@ void RGBController_E131::DeviceUpdateLEDs()
     {
         unsigned int total_universes = ceil( ( ( devices[device_idx].num_leds * 3 ) + devices[device_idx].start_channel ) / 512.0f );
         unsigned int channel_idx = devices[device_idx].start_channel;
-        unsigned int led_idx = 0;
-        unsigned int rgb_idx = 0;
-        bool         done = false;
+        unsigned int num_bytes   = devices[device_idx].num_leds * 3;
+        unsigned int byte_idx    = 0;
+
+        /*-----------------------------------------------------*\
+        | Convert this device's colors to channel data, then    |
+        | copy it across as many universes as it spans          |
+        \*-----------------------------------------------------*/
+        if(rgb_buffer.size() < num_bytes)
+        {
+            rgb_buffer.resize(num_bytes);
+        }
+
+        RGBColorsToBytes(colors.data() + color_idx, devices[device_idx].num_leds, rgb_buffer.data(), RGB_ORDER_RGB);
+
+        color_idx += devices[device_idx].num_leds;
 
         for (unsigned int univ_idx = 0; univ_idx < total_universes; univ_idx++)
         {
@@ -248,35 +259,14 @@ void RGBController_E131::DeviceUpdateLEDs()
 
             for(std::size_t packet_idx = 0; packet_idx < packets.size(); packet_idx++)
             {
-                if(!done && (universes[packet_idx] == universe))
+                if((byte_idx < num_bytes) && (universes[packet_idx] == universe) && (channel_idx <= 512))
                 {
-                    while(!done && (channel_idx <= 512))
-                    {
-                        switch(rgb_idx)
-                        {
-                            case 0:
-                                packets[packet_idx].dmp.prop_val[channel_idx] = RGBGetRValue( colors[color_idx] );
-                                rgb_idx = 1;
-                                break;
-                            case 1:
-                                packets[packet_idx].dmp.prop_val[channel_idx] = RGBGetGValue( colors[color_idx] );
-                                rgb_idx = 2;
-                                break;
-                            case 2:
-                                packets[packet_idx].dmp.prop_val[channel_idx] = RGBGetBValue( colors[color_idx] );
-                                rgb_idx = 0;
-                                led_idx++;
-                                color_idx++;
-                                break;
-                        }
+                    unsigned int copy_size = std::min(num_bytes - byte_idx, 513 - channel_idx);
 
-                        if(led_idx >= devices[device_idx].num_leds)
-                        {
-                            done = true;
-                        }
+                    memcpy(&packets[packet_idx].dmp.prop_val[channel_idx], &rgb_buffer[byte_idx], copy_size);
 
-                        channel_idx++;
-                    }
+                    byte_idx += copy_size;
+                    break;
                 }
             }
 
@@ -76,6 +76,7 @@ private:
     std::vector<e131_packet_t> 	packets;
 	std::vector<e131_addr_t> 	dest_addrs;
 	std::vector<unsigned int> 	universes;
+    std::vector<unsigned char>  rgb_buffer;
 	int 						sockfd;
     std::thread *               KeepaliveThread;
     std::chrono::milliseconds                           keepalive_delay;
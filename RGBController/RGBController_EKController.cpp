@@ -113,7 +113,9 @@ RGBController_EKController::RGBController_EKController(EKController* _dev)
 
 RGBController_EKController::~RGBController_EKController()
 {
+    StopDeviceThread();
 
+    delete EK_dev;
 }
 
 void RGBController_EKController::SetupZones()
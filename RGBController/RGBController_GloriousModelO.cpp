@@ -121,6 +121,13 @@ RGBController_GloriousModelO::RGBController_GloriousModelO(GloriousModelOControl
     SetupZones();
 }
 
+RGBController_GloriousModelO::~RGBController_GloriousModelO()
+{
+    StopDeviceThread();
+
+    delete gmo;
+}
+
 void RGBController_GloriousModelO::SetupZones()
 {
     /*---------------------------------------------------------*\
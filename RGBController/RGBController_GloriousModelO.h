@@ -16,6 +16,7 @@ class RGBController_GloriousModelO : public RGBController
 {
 public:
     RGBController_GloriousModelO(GloriousModelOController* gmo_ptr);
+    ~RGBController_GloriousModelO();
 
     void        SetupZones();
 
@@ -35,6 +35,13 @@ RGBController_HoltekA070::RGBController_HoltekA070(HoltekA070Controller* holtek_
     SetupZones();
 }
 
+RGBController_HoltekA070::~RGBController_HoltekA070()
+{
+    StopDeviceThread();
+
+    delete holtek;
+}
+
 void RGBController_HoltekA070::SetupZones()
 {
     zone mouse_zone;
@@ -14,6 +14,7 @@ class RGBController_HoltekA070 : public RGBController
 {
 public:
     RGBController_HoltekA070(HoltekA070Controller* holtek_ptr);
+    ~RGBController_HoltekA070();
 
     void        SetupZones();
     void        ResizeZone(int zone, int new_size);
@@ -8,7 +8,9 @@
 \*-----------------------------------------*/
 
 #pragma once
+#include <atomic>
 #include <chrono>
+#include <thread>
 
 #include "RGBController.h"
 #include "HyperXAlloyOriginsController.h"
@@ -36,4 +38,7 @@ private:
     HyperXAlloyOriginsController*   hyperx;
 
     std::chrono::time_point<std::chrono::steady_clock>  last_update_time;
+
+    std::thread*                                        keepalive_thread;
+    std::atomic<bool>                                   keepalive_thread_run;
 };
@@ -9,32 +9,8 @@
 
 #include "RGBController_HyperXKeyboard.h"
 
-//Include thread libraries for Windows or Linux
-#ifdef WIN32
-#include <process.h>
-#else
-#include "pthread.h"
-#include "unistd.h"
-#endif
-
-//Thread functions have different types in Windows and Linux
-#ifdef WIN32
-#define THREAD static void
-#define THREADRETURN
-#else
-#define THREAD static void*
-#define THREADRETURN return(NULL);
-#endif
-
 using namespace std::chrono_literals;
 
-THREAD keepalive_thread(void *param)
-{
-    RGBController_HyperXKeyboard* controller = static_cast<RGBController_HyperXKeyboard*>(param);
-    controller->KeepaliveThread();
-    THREADRETURN
-}
-
 //0xFFFFFFFF indicates an unused entry in matrix
 #define NA  0xFFFFFFFF
 
@@ -253,17 +229,19 @@ RGBController_HyperXKeyboard::RGBController_HyperXKeyboard(HyperXKeyboardControl
     | to not revert back into rainbow mode.  Start a thread |
     | to continuously send a keepalive packet every 5s      |
     \*-----------------------------------------------------*/
-#ifdef WIN32
-    _beginthread(keepalive_thread, 0, this);
-#else
-    pthread_t thread;
-    pthread_create(&thread, NULL, &keepalive_thread, this);
-#endif
+    keepalive_thread_run = true;
+    keepalive_thread = new std::thread(&RGBController_HyperXKeyboard::KeepaliveThread, this);
 }
 
 RGBController_HyperXKeyboard::~RGBController_HyperXKeyboard()
 {
+    keepalive_thread_run = false;
+    keepalive_thread->join();
+    delete keepalive_thread;
+
+    StopDeviceThread();
 
+    delete hyperx;
 }
 
 void RGBController_HyperXKeyboard::SetupZones()
@@ -283,10 +261,7 @@ void RGBController_HyperXKeyboard::SetupZones()
 
         if(zone_types[zone_idx] == ZONE_TYPE_MATRIX)
         {
-            new_zone.matrix_map         = new matrix_map_type;
-            new_zone.matrix_map->height = 6;
-            new_zone.matrix_map->width  = 23;
-            new_zone.matrix_map->map    = (unsigned int *)&matrix_map;
+            new_zone.matrix_map         = NewMatrixMap(6, 23, (unsigned int *)&matrix_map);
         }
         else
         {
@@ -359,7 +334,7 @@ void RGBController_HyperXKeyboard::DeviceUpdateMode()
 
 void RGBController_HyperXKeyboard::KeepaliveThread()
 {
-    while(1)
+    while(keepalive_thread_run.load())
     {
         if(active_mode == 0)
         {
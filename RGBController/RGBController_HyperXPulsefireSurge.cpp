@@ -9,32 +9,8 @@
 
 #include "RGBController_HyperXPulsefireSurge.h"
 
-//Include thread libraries for Windows or Linux
-#ifdef WIN32
-#include <process.h>
-#else
-#include "pthread.h"
-#include "unistd.h"
-#endif
-
-//Thread functions have different types in Windows and Linux
-#ifdef WIN32
-#define THREAD static void
-#define THREADRETURN
-#else
-#define THREAD static void*
-#define THREADRETURN return(NULL);
-#endif
-
 using namespace std::chrono_literals;
 
-THREAD keepalive_thread(void *param)
-{
-    RGBController_HyperXPulsefireSurge* controller = static_cast<RGBController_HyperXPulsefireSurge*>(param);
-    controller->KeepaliveThread();
-    THREADRETURN
-}
-
 RGBController_HyperXPulsefireSurge::RGBController_HyperXPulsefireSurge(HyperXPulsefireSurgeController* hyperx_ptr)
 {
     hyperx = hyperx_ptr;
@@ -58,17 +34,19 @@ RGBController_HyperXPulsefireSurge::RGBController_HyperXPulsefireSurge(HyperXPul
     | to not revert back into rainbow mode.  Start a thread |
     | to continuously send a keepalive packet every 5s      |
     \*-----------------------------------------------------*/
-#ifdef WIN32
-    _beginthread(keepalive_thread, 0, this);
-#else
-    pthread_t thread;
-    pthread_create(&thread, NULL, &keepalive_thread, this);
-#endif
+    keepalive_thread_run = true;
+    keepalive_thread = new std::thread(&RGBController_HyperXPulsefireSurge::KeepaliveThread, this);
 };
 
 RGBController_HyperXPulsefireSurge::~RGBController_HyperXPulsefireSurge()
 {
+    keepalive_thread_run = false;
+    keepalive_thread->join();
+    delete keepalive_thread;
+
+    StopDeviceThread();
 
+    delete hyperx;
 }
 
 void RGBController_HyperXPulsefireSurge::SetupZones()
@@ -155,7 +133,7 @@ void RGBController_HyperXPulsefireSurge::DeviceUpdateMode()
 
 void RGBController_HyperXPulsefireSurge::KeepaliveThread()
 {
-    while(1)
+    while(keepalive_thread_run.load())
     {
         if(active_mode == 0)
         {
@@ -60,17 +60,26 @@ void RGBController_LEDStrip::ResizeZone(int /*zone*/, int /*new_size*/)
 
 void RGBController_LEDStrip::DeviceUpdateLEDs()
 {
-    strip->SetLEDs(colors);
+    if(!strip->SetLEDs(colors))
+    {
+        ReportIOError();
+    }
 }
 
 void RGBController_LEDStrip::UpdateZoneLEDs(int /*zone*/)
 {
-    strip->SetLEDs(colors);
+    if(!strip->SetLEDs(colors))
+    {
+        ReportIOError();
+    }
 }
 
 void RGBController_LEDStrip::UpdateSingleLED(int /*led*/)
 {
-    strip->SetLEDs(colors);
+    if(!strip->SetLEDs(colors))
+    {
+        ReportIOError();
+    }
 }
 
 void RGBController_LEDStrip::SetCustomMode()
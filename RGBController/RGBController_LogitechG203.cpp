@@ -54,6 +54,13 @@ RGBController_LogitechG203::RGBController_LogitechG203(LogitechG203Controller* l
     SetupZones();
 }
 
+RGBController_LogitechG203::~RGBController_LogitechG203()
+{
+    StopDeviceThread();
+
+    delete logitech;
+}
+
 void RGBController_LogitechG203::SetupZones()
 {
     zone g203_zone;
@@ -70,6 +70,13 @@ RGBController_LogitechG203L::RGBController_LogitechG203L(LogitechG203LController
     SetupZones();
 }
 
+RGBController_LogitechG203L::~RGBController_LogitechG203L()
+{
+    StopDeviceThread();
+
+    delete logitech;
+}
+
 void RGBController_LogitechG203L::SetupZones()
 {
     zone g203L_zone;
@@ -54,6 +54,13 @@ RGBController_LogitechG403::RGBController_LogitechG403(LogitechG403Controller* l
     SetupZones();
 }
 
+RGBController_LogitechG403::~RGBController_LogitechG403()
+{
+    StopDeviceThread();
+
+    delete logitech;
+}
+
 void RGBController_LogitechG403::SetupZones()
 {
     zone G403_wheel_zone;
@@ -54,6 +54,13 @@ RGBController_LogitechG502PS::RGBController_LogitechG502PS(LogitechG502PSControl
     SetupZones();
 }
 
+RGBController_LogitechG502PS::~RGBController_LogitechG502PS()
+{
+    StopDeviceThread();
+
+    delete logitech;
+}
+
 void RGBController_LogitechG502PS::SetupZones()
 {
     zone G502_PS_side_zone;
@@ -223,6 +223,13 @@ RGBController_LogitechG810::RGBController_LogitechG810(LogitechG810Controller* l
     SetupZones();
 }
 
+RGBController_LogitechG810::~RGBController_LogitechG810()
+{
+    StopDeviceThread();
+
+    delete logitech;
+}
+
 void RGBController_LogitechG810::SetupZones()
 {
     /*---------------------------------------------------------*\
@@ -240,10 +247,7 @@ void RGBController_LogitechG810::SetupZones()
 
         if(zone_types[zone_idx] == ZONE_TYPE_MATRIX)
         {
-            new_zone.matrix_map         = new matrix_map_type;
-            new_zone.matrix_map->height = 7;
-            new_zone.matrix_map->width  = 23;
-            new_zone.matrix_map->map    = (unsigned int *)&matrix_map;
+            new_zone.matrix_map         = NewMatrixMap(7, 23, (unsigned int *)&matrix_map);
         }
         else
         {
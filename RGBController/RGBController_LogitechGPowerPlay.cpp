@@ -54,6 +54,13 @@ RGBController_LogitechGPowerPlay::RGBController_LogitechGPowerPlay(LogitechGPowe
     SetupZones();
 }
 
+RGBController_LogitechGPowerPlay::~RGBController_LogitechGPowerPlay()
+{
+    StopDeviceThread();
+
+    delete logitech;
+}
+
 void RGBController_LogitechGPowerPlay::SetupZones()
 {
     zone GPowerPlay_logo_zone;
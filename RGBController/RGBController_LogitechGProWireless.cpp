@@ -54,6 +54,13 @@ RGBController_LogitechGProWireless::RGBController_LogitechGProWireless(LogitechG
     SetupZones();
 }
 
+RGBController_LogitechGProWireless::~RGBController_LogitechGProWireless()
+{
+    StopDeviceThread();
+
+    delete logitech;
+}
+
 void RGBController_LogitechGProWireless::SetupZones()
 {
     zone GProWireless_primary_zone;
@@ -29,7 +29,9 @@ RGBController_MSI3Zone::RGBController_MSI3Zone(MSI3ZoneController* msi_ptr)
 
 RGBController_MSI3Zone::~RGBController_MSI3Zone()
 {
+    StopDeviceThread();
 
+    delete msi;
 }
 
 void RGBController_MSI3Zone::SetupZones()
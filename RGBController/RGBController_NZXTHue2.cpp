@@ -130,6 +130,13 @@ RGBController_NZXTHue2::RGBController_NZXTHue2(NZXTHue2Controller* hue2_ptr)
     SetupZones();
 }
 
+RGBController_NZXTHue2::~RGBController_NZXTHue2()
+{
+    StopDeviceThread();
+
+    delete hue2;
+}
+
 void RGBController_NZXTHue2::SetupZones()
 {
     /*-------------------------------------------------*\
@@ -188,6 +188,13 @@ RGBController_NZXTKraken::RGBController_NZXTKraken(NZXTKrakenController* nzxtkra
     SetupZones();
 }
 
+RGBController_NZXTKraken::~RGBController_NZXTKraken()
+{
+    StopDeviceThread();
+
+    delete nzxtkraken;
+}
+
 void RGBController_NZXTKraken::SetupZones()
 {
     /*---------------------------------------------------------*\
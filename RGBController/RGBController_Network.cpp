@@ -14,6 +14,14 @@ RGBController_Network::RGBController_Network(NetworkClient * client_ptr, unsigne
 {
     client  = client_ptr;
     dev_idx = dev_idx_val;
+
+    /*---------------------------------------------------------*\
+    | Other clients can change the mode on the server, so the   |
+    | last mode sent from here says nothing about the device    |
+    \*---------------------------------------------------------*/
+    dedup_mode_updates = false;
+
+    memset(&remote_stats, 0, sizeof(remote_stats));
 }
 
 void RGBController_Network::SetupZones()
@@ -28,12 +36,20 @@ void RGBController_Network::ResizeZone(int zone, int new_size)
 
 void RGBController_Network::DeviceUpdateLEDs()
 {
+    if(client->SharedMemory_UpdateLEDs(dev_idx, colors.data(), colors.size()))
+    {
+        return;
+    }
+
     unsigned char * data = GetColorDescription();
     unsigned int size;
 
     memcpy(&size, &data[0], sizeof(unsigned int));
 
-    client->SendRequest_RGBController_UpdateLEDs(dev_idx, data, size);
+    if(!client->SendStream_UpdateLEDs(dev_idx, data, size))
+    {
+        client->SendRequest_RGBController_UpdateLEDs(dev_idx, data, size);
+    }
 
     delete[] data;
 }
@@ -78,3 +94,32 @@ void RGBController_Network::DeviceUpdateMode()
 
     delete[] data;
 }
+
+/*---------------------------------------------------------*\
+| Stats are collected on the server side, where the device  |
+| call thread runs, so request them from the server         |
+\*---------------------------------------------------------*/
+RGBControllerStatsSnapshot RGBController_Network::GetStats()
+{
+    /*---------------------------------------------------------*\
+    | Older servers don't answer stats requests                 |
+    \*---------------------------------------------------------*/
+    if(!client->HasServerCapability(NET_CAPABILITY_CONTROLLER_STATS))
+    {
+        return(RGBController::GetStats());
+    }
+
+    client->SendRequest_ControllerStats(dev_idx);
+    client->WaitOnControllerStats();
+
+    std::lock_guard<std::mutex> lock(remote_stats_mutex);
+
+    return(remote_stats);
+}
+
+void RGBController_Network::SetRemoteStats(RGBControllerStatsSnapshot& stats)
+{
+    std::lock_guard<std::mutex> lock(remote_stats_mutex);
+
+    remote_stats = stats;
+}
@@ -27,7 +27,13 @@ public:
     void        SetCustomMode();
     void        DeviceUpdateMode();
 
+    RGBControllerStatsSnapshot  GetStats();
+    void                        SetRemoteStats(RGBControllerStatsSnapshot& stats);
+
 private:
-    NetworkClient *     client;
-    unsigned int        dev_idx;
+    NetworkClient *             client;
+    unsigned int                dev_idx;
+
+    std::mutex                  remote_stats_mutex;
+    RGBControllerStatsSnapshot  remote_stats;
 };
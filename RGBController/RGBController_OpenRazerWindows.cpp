@@ -338,14 +338,9 @@ void RGBController_OpenRazer::SetupZones()
 
             if(new_zone.type == ZONE_TYPE_MATRIX)
             {
-                matrix_map_type * new_map = new matrix_map_type;
+                matrix_map_type * new_map = NewMatrixMap(device_list[device_index]->zones[zone_id]->rows, device_list[device_index]->zones[zone_id]->cols);
                 new_zone.matrix_map = new_map;
 
-                new_map->height = device_list[device_index]->zones[zone_id]->rows;
-                new_map->width  = device_list[device_index]->zones[zone_id]->cols;
-
-                new_map->map = new unsigned int[new_map->height * new_map->width];
-
                 for(unsigned int y = 0; y < new_map->height; y++)
                 {
                     for(unsigned int x = 0; x < new_map->width; x++)
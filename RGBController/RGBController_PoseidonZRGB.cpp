@@ -195,7 +195,9 @@ RGBController_PoseidonZRGB::RGBController_PoseidonZRGB(PoseidonZRGBController* p
 
 RGBController_PoseidonZRGB::~RGBController_PoseidonZRGB()
 {
+    StopDeviceThread();
 
+    delete poseidon;
 }
 
 void RGBController_PoseidonZRGB::SetupZones()
@@ -212,10 +214,7 @@ void RGBController_PoseidonZRGB::SetupZones()
         new_zone.leds_min           = zone_sizes[zone_idx];
         new_zone.leds_max           = zone_sizes[zone_idx];
         new_zone.leds_count         = zone_sizes[zone_idx];
-        new_zone.matrix_map         = new matrix_map_type;
-        new_zone.matrix_map->height = 6;
-        new_zone.matrix_map->width  = 23;
-        new_zone.matrix_map->map    = (unsigned int *)&matrix_map;
+        new_zone.matrix_map         = NewMatrixMap(6, 23, (unsigned int *)&matrix_map);
         zones.push_back(new_zone);
 
         total_led_count += zone_sizes[zone_idx];
@@ -182,6 +182,13 @@ RGBController_RGBFusion2USB::RGBController_RGBFusion2USB(RGBFusion2USBController
     SetupZones();
 }
 
+RGBController_RGBFusion2USB::~RGBController_RGBFusion2USB()
+{
+    StopDeviceThread();
+
+    delete controller;
+}
+
 void RGBController_RGBFusion2USB::Init_Controller()
 {
     /*---------------------------------------------------------*\
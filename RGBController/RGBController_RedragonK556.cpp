@@ -205,6 +205,13 @@ RGBController_RedragonK556::RGBController_RedragonK556(RedragonK556Controller* r
     SetupZones();
 }
 
+RGBController_RedragonK556::~RGBController_RedragonK556()
+{
+    StopDeviceThread();
+
+    delete redragon;
+}
+
 void RGBController_RedragonK556::SetupZones()
 {
     zone new_zone;
@@ -214,10 +221,7 @@ void RGBController_RedragonK556::SetupZones()
     new_zone.leds_min           = 126;
     new_zone.leds_max           = 126;
     new_zone.leds_count         = 126;
-    new_zone.matrix_map         = new matrix_map_type;
-    new_zone.matrix_map->height = 6;
-    new_zone.matrix_map->width  = 23;
-    new_zone.matrix_map->map    = (unsigned int *)&matrix_map;
+    new_zone.matrix_map         = NewMatrixMap(6, 23, (unsigned int *)&matrix_map);
     
     zones.push_back(new_zone);
 
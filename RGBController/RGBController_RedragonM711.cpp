@@ -55,6 +55,13 @@ RGBController_RedragonM711::RGBController_RedragonM711(RedragonM711Controller* r
     SetupZones();
 }
 
+RGBController_RedragonM711::~RGBController_RedragonM711()
+{
+    StopDeviceThread();
+
+    delete redragon;
+}
+
 void RGBController_RedragonM711::SetupZones()
 {
     zone m711_zone;
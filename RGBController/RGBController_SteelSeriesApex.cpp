@@ -284,7 +284,9 @@ RGBController_SteelSeriesApex::RGBController_SteelSeriesApex(SteelSeriesApexCont
 
 RGBController_SteelSeriesApex::~RGBController_SteelSeriesApex()
 {
+    StopDeviceThread();
 
+    delete steelseries;
 }
 
 void RGBController_SteelSeriesApex::SetupZones()
@@ -314,17 +316,13 @@ void RGBController_SteelSeriesApex::SetupZones()
 
         if(zone_types[zone_idx] == ZONE_TYPE_MATRIX)
         {
-            new_zone.matrix_map         = new matrix_map_type;
-            new_zone.matrix_map->height = 6;
             if(proto_type == APEX)
             {
-                new_zone.matrix_map->width  = 23;
-                new_zone.matrix_map->map    = (unsigned int *)&matrix_map;
+                new_zone.matrix_map     = NewMatrixMap(6, 23, (unsigned int *)&matrix_map);
             }
             else
             {
-                new_zone.matrix_map->width  = 19;
-                new_zone.matrix_map->map    = (unsigned int *)&matrix_map_tkl;
+                new_zone.matrix_map     = NewMatrixMap(6, 19, (unsigned int *)&matrix_map_tkl);
             }
         }
         else
@@ -37,6 +37,13 @@ RGBController_SteelSeriesRival::RGBController_SteelSeriesRival(SteelSeriesRivalC
     SetupZones();
 }
 
+RGBController_SteelSeriesRival::~RGBController_SteelSeriesRival()
+{
+    StopDeviceThread();
+
+    delete rival;
+}
+
 void RGBController_SteelSeriesRival::SetupZones()
 {
     /* Rival 100 Series only has one Zone */
@@ -26,6 +26,13 @@ RGBController_SteelSeriesSiberia::RGBController_SteelSeriesSiberia(SteelSeriesSi
     SetupZones();
 }
 
+RGBController_SteelSeriesSiberia::~RGBController_SteelSeriesSiberia()
+{
+    StopDeviceThread();
+
+    delete siberia;
+}
+
 void RGBController_SteelSeriesSiberia::SetupZones()
 {
     /* Siberia 350 only has one Zone */
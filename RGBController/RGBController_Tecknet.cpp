@@ -54,7 +54,9 @@ RGBController_Tecknet::RGBController_Tecknet(TecknetController *_dev)
 
 RGBController_Tecknet::~RGBController_Tecknet()
 {
+    StopDeviceThread();
 
+    delete Tecknet_dev;
 }
 
 void RGBController_Tecknet::SetupZones()
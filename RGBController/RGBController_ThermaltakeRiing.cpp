@@ -104,6 +104,13 @@ RGBController_ThermaltakeRiing::RGBController_ThermaltakeRiing(ThermaltakeRiingC
     SetupZones();
 }
 
+RGBController_ThermaltakeRiing::~RGBController_ThermaltakeRiing()
+{
+    StopDeviceThread();
+
+    delete riing;
+}
+
 void RGBController_ThermaltakeRiing::SetupZones()
 {
     /*-------------------------------------------------*\
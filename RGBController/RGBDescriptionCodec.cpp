@@ -0,0 +1,185 @@
+/*-----------------------------------------*\
+|  RGBDescriptionCodec.cpp                  |
+|                                           |
+|  Buffer writer and bounds-checked reader  |
+|  for RGBController descriptions           |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "RGBDescriptionCodec.h"
+
+#include <cstring>
+
+void RGBDescriptionWriter::PutBytes(const void * bytes, std::size_t size)
+{
+    const unsigned char * first = (const unsigned char *)bytes;
+
+    data.insert(data.end(), first, first + size);
+}
+
+void RGBDescriptionWriter::PutU32(unsigned int value)
+{
+    PutBytes(&value, sizeof(value));
+}
+
+void RGBDescriptionWriter::PutVarint(unsigned int value)
+{
+    /*---------------------------------------------------------*\
+    | Seven bits per byte, low bits first, high bit set on all  |
+    | but the last byte                                         |
+    \*---------------------------------------------------------*/
+    while(value >= 0x80)
+    {
+        data.push_back((unsigned char)(value | 0x80));
+        value >>= 7;
+    }
+
+    data.push_back((unsigned char)value);
+}
+
+void RGBDescriptionWriter::PutSignedVarint(int value)
+{
+    /*---------------------------------------------------------*\
+    | Zigzag encode so small negative values stay short         |
+    \*---------------------------------------------------------*/
+    PutVarint(((unsigned int)value << 1) ^ (unsigned int)(value >> 31));
+}
+
+void RGBDescriptionWriter::PutString(const std::string& value)
+{
+    PutVarint(value.size());
+    PutBytes(value.data(), value.size());
+}
+
+RGBDescriptionReader::RGBDescriptionReader(const unsigned char * buffer, std::size_t size)
+{
+    this->buffer    = buffer;
+    buffer_size     = (buffer == NULL) ? 0 : size;
+    offset          = 0;
+    ok              = true;
+}
+
+const unsigned char * RGBDescriptionReader::Peek(std::size_t size)
+{
+    if(!ok || (size > (buffer_size - offset)))
+    {
+        ok = false;
+        return(NULL);
+    }
+
+    return(&buffer[offset]);
+}
+
+bool RGBDescriptionReader::Skip(std::size_t size)
+{
+    if(Peek(size) == NULL)
+    {
+        return(false);
+    }
+
+    offset += size;
+
+    return(true);
+}
+
+bool RGBDescriptionReader::GetBytes(void * bytes, std::size_t size)
+{
+    const unsigned char * source = Peek(size);
+
+    if(source == NULL)
+    {
+        return(false);
+    }
+
+    /*---------------------------------------------------------*\
+    | An empty vector's data() may be NULL                      |
+    \*---------------------------------------------------------*/
+    if(size > 0)
+    {
+        memcpy(bytes, source, size);
+        offset += size;
+    }
+
+    return(true);
+}
+
+bool RGBDescriptionReader::GetU16(unsigned short& value)
+{
+    return(GetBytes(&value, sizeof(value)));
+}
+
+bool RGBDescriptionReader::GetU32(unsigned int& value)
+{
+    return(GetBytes(&value, sizeof(value)));
+}
+
+bool RGBDescriptionReader::GetVarint(unsigned int& value)
+{
+    unsigned int result = 0;
+
+    /*---------------------------------------------------------*\
+    | A 32-bit value takes at most five bytes                   |
+    \*---------------------------------------------------------*/
+    for(unsigned int shift = 0; shift < 35; shift += 7)
+    {
+        unsigned char byte;
+
+        if(!GetBytes(&byte, sizeof(byte)))
+        {
+            return(false);
+        }
+
+        result |= (unsigned int)(byte & 0x7F) << shift;
+
+        if((byte & 0x80) == 0)
+        {
+            value = result;
+            return(true);
+        }
+    }
+
+    ok = false;
+
+    return(false);
+}
+
+bool RGBDescriptionReader::GetSignedVarint(int& value)
+{
+    unsigned int encoded;
+
+    if(!GetVarint(encoded))
+    {
+        return(false);
+    }
+
+    value = (int)((encoded >> 1) ^ (0U - (encoded & 1)));
+
+    return(true);
+}
+
+bool RGBDescriptionReader::GetString(std::string& value)
+{
+    unsigned int            length;
+    const unsigned char *   source;
+
+    if(!GetVarint(length) || ((source = Peek(length)) == NULL))
+    {
+        return(false);
+    }
+
+    value.assign((const char *)source, length);
+    offset += length;
+
+    return(true);
+}
+
+bool RGBDescriptionReader::Ok()
+{
+    return(ok);
+}
+
+std::size_t RGBDescriptionReader::Remaining()
+{
+    return(buffer_size - offset);
+}
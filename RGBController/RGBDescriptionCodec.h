@@ -0,0 +1,61 @@
+/*-----------------------------------------*\
+|  RGBDescriptionCodec.h                    |
+|                                           |
+|  Buffer writer and bounds-checked reader  |
+|  for RGBController descriptions           |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/*---------------------------------------------------------*\
+| Appends fixed-size fields, LEB128 varints and strings to  |
+| a growing buffer                                          |
+\*---------------------------------------------------------*/
+class RGBDescriptionWriter
+{
+public:
+    void                        PutBytes(const void * bytes, std::size_t size);
+    void                        PutU32(unsigned int value);
+    void                        PutVarint(unsigned int value);
+    void                        PutSignedVarint(int value);
+    void                        PutString(const std::string& value);
+
+    std::vector<unsigned char>  data;
+};
+
+/*---------------------------------------------------------*\
+| Reads fields from a buffer of known size.  A read past    |
+| the end fails, leaves its output untouched and makes      |
+| every later read fail too, so a decoder can check Ok()    |
+| once at the end                                           |
+\*---------------------------------------------------------*/
+class RGBDescriptionReader
+{
+public:
+    RGBDescriptionReader(const unsigned char * buffer, std::size_t size);
+
+    bool                        GetBytes(void * bytes, std::size_t size);
+    bool                        GetU16(unsigned short& value);
+    bool                        GetU32(unsigned int& value);
+    bool                        GetVarint(unsigned int& value);
+    bool                        GetSignedVarint(int& value);
+    bool                        GetString(std::string& value);
+
+    bool                        Skip(std::size_t size);
+    const unsigned char *       Peek(std::size_t size);
+
+    bool                        Ok();
+    std::size_t                 Remaining();
+
+private:
+    const unsigned char *       buffer;
+    std::size_t                 buffer_size;
+    std::size_t                 offset;
+    bool                        ok;
+};
@@ -0,0 +1,139 @@
+/*-----------------------------------------*\
+|  RGBOutputStage.cpp                       |
+|                                           |
+|  Per-device gamma, white point and        |
+|  brightness correction applied between    |
+|  the color buffer and the device          |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "RGBOutputStage.h"
+#include "RGBColorTransform.h"
+
+#include <cmath>
+
+std::atomic<unsigned int> RGBOutputStage::global_brightness(255);
+std::atomic<unsigned int> RGBOutputStage::global_generation(0);
+
+RGBOutputStage::RGBOutputStage()
+{
+    params.gamma        = 100;
+    params.white_point  = 0x00FFFFFF;
+    params.brightness   = 255;
+
+    active_lut          = 0;
+    built_generation    = 0;
+    identity            = true;
+
+    std::lock_guard<std::mutex> lock(StageMutex);
+
+    Rebuild();
+}
+
+void RGBOutputStage::SetParams(RGBOutputStageParams& new_params)
+{
+    std::lock_guard<std::mutex> lock(StageMutex);
+
+    params = new_params;
+
+    if(params.gamma == 0)
+    {
+        params.gamma = 100;
+    }
+
+    if(params.brightness > 255)
+    {
+        params.brightness = 255;
+    }
+
+    params.white_point &= 0x00FFFFFF;
+
+    Rebuild();
+}
+
+RGBOutputStageParams RGBOutputStage::GetParams()
+{
+    std::lock_guard<std::mutex> lock(StageMutex);
+
+    return(params);
+}
+
+bool RGBOutputStage::IsIdentity()
+{
+    Refresh();
+
+    return(identity.load());
+}
+
+void RGBOutputStage::Apply(const RGBColor* in, std::size_t count, RGBColor* out)
+{
+    Refresh();
+
+    unsigned int table = active_lut.load(std::memory_order_acquire);
+
+    RGBColorsApplyLUT(in, count, out, lut[table][0], lut[table][1], lut[table][2]);
+}
+
+void RGBOutputStage::SetGlobalBrightness(unsigned int brightness)
+{
+    if(brightness > 255)
+    {
+        brightness = 255;
+    }
+
+    global_brightness = brightness;
+    global_generation++;
+}
+
+unsigned int RGBOutputStage::GetGlobalBrightness()
+{
+    return(global_brightness.load());
+}
+
+void RGBOutputStage::Refresh()
+{
+    /*---------------------------------------------------------*\
+    | Only take the lock when the global brightness has moved   |
+    | since the tables were built                               |
+    \*---------------------------------------------------------*/
+    if(built_generation.load(std::memory_order_acquire) != global_generation.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(StageMutex);
+
+        Rebuild();
+    }
+}
+
+void RGBOutputStage::Rebuild()
+{
+    /*---------------------------------------------------------*\
+    | Read the generation first so a change that lands during   |
+    | the rebuild triggers another one                          |
+    \*---------------------------------------------------------*/
+    unsigned int    generation  = global_generation.load(std::memory_order_acquire);
+    unsigned int    global      = global_brightness.load();
+    unsigned int    next        = active_lut.load() ^ 1;
+    float           gamma       = params.gamma / 100.0f;
+
+    for(unsigned int channel = 0; channel < 3; channel++)
+    {
+        unsigned int    white   = (params.white_point >> (channel * 8)) & 0xFF;
+        float           scale   = (white / 255.0f) * (params.brightness / 255.0f) * (global / 255.0f);
+
+        for(unsigned int value = 0; value < 256; value++)
+        {
+            float level = powf(value / 255.0f, gamma) * scale;
+
+            lut[next][channel][value] = (unsigned char)((level * 255.0f) + 0.5f);
+        }
+    }
+
+    identity = (params.gamma       == 100)
+            && (params.white_point == 0x00FFFFFF)
+            && (params.brightness  == 255)
+            && (global             == 255);
+
+    active_lut.store(next, std::memory_order_release);
+    built_generation.store(generation, std::memory_order_release);
+}
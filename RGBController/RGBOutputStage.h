@@ -0,0 +1,65 @@
+/*-----------------------------------------*\
+|  RGBOutputStage.h                         |
+|                                           |
+|  Per-device gamma, white point and        |
+|  brightness correction applied between    |
+|  the color buffer and the device          |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+typedef unsigned int RGBColor;
+
+/*---------------------------------------------------------*\
+| Output stage parameters, sent as-is over the SDK          |
+\*---------------------------------------------------------*/
+typedef struct
+{
+    unsigned int    gamma;                              /* Gamma x 100, 100 is linear               */
+    RGBColor        white_point;                        /* Per-channel scale, 0xFFFFFF is neutral   */
+    unsigned int    brightness;                         /* Device brightness, 0-255                 */
+} RGBOutputStageParams;
+
+class RGBOutputStage
+{
+public:
+    RGBOutputStage();
+
+    void                        SetParams(RGBOutputStageParams& new_params);
+    RGBOutputStageParams        GetParams();
+
+    bool                        IsIdentity();
+
+    void                        Apply(const RGBColor* in, std::size_t count, RGBColor* out);
+
+    /*---------------------------------------------------------*\
+    | Global brightness, applied on top of every device's own   |
+    \*---------------------------------------------------------*/
+    static void                 SetGlobalBrightness(unsigned int brightness);
+    static unsigned int         GetGlobalBrightness();
+
+private:
+    std::mutex                  StageMutex;
+    RGBOutputStageParams        params;
+
+    /*---------------------------------------------------------*\
+    | Tables are rebuilt into the inactive set and published    |
+    | by flipping active_lut, so Apply never waits on a setter  |
+    \*---------------------------------------------------------*/
+    unsigned char               lut[2][3][256];
+    std::atomic<unsigned int>   active_lut;
+    std::atomic<unsigned int>   built_generation;
+    std::atomic<bool>           identity;
+
+    static std::atomic<unsigned int>    global_brightness;
+    static std::atomic<unsigned int>    global_generation;
+
+    void                        Refresh();
+    void                        Rebuild();
+};
@@ -1,9 +1,26 @@
 #include "ResourceManager.h"
 #include "ProfileManager.h"
+#include "RGBController_Dummy.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <cstring>
+#include <cstdio>
+
+#ifdef __linux__
+#include <linux/netlink.h>
+#include <sys/socket.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+/*-------------------------------------------------------------------------*\
+| Time to wait after the last hotplug event before rescanning, so that a   |
+| device enumerating several interfaces only causes one rescan             |
+\*-------------------------------------------------------------------------*/
+#define HOTPLUG_DEBOUNCE_MS     500
 
 std::unique_ptr<ResourceManager> ResourceManager::instance;
 
@@ -25,15 +42,27 @@ ResourceManager::ResourceManager()
     detection_string = "";
     detection_is_required = false;
     DetectDevicesThread = nullptr;
+    HotplugMonitorThread = nullptr;
+    hotplug_monitor_running = false;
+    hold_removed_controllers = false;
+    rescan_active = false;
 
     /*-------------------------------------------------------------------------*\
     | Initialize Server Instance                                                |
     \*-------------------------------------------------------------------------*/
-    server = new NetworkServer(rgb_controllers);
+    server = new NetworkServer(rgb_controllers, RGBControllersMutex);
+
+    /*-------------------------------------------------------------------------*\
+    | Initialize Effects Engine and make it available to SDK clients            |
+    \*-------------------------------------------------------------------------*/
+    effects = new EffectsEngine(rgb_controllers, RGBControllersMutex);
+    server->SetEffectsEngine(effects);
 }
 
 ResourceManager::~ResourceManager()
 {
+    StopHotplugMonitor();
+    effects->Stop();
     Cleanup();
 }
 
@@ -49,7 +78,10 @@ std::vector<i2c_smbus_interface*> & ResourceManager::GetI2CBusses()
 
 void ResourceManager::RegisterRGBController(RGBController *rgb_controller)
 {
+    RGBControllersMutex.lock();
     rgb_controllers.push_back(rgb_controller);
+    RGBControllersMutex.unlock();
+
     DeviceListChanged();
 }
 
@@ -58,6 +90,11 @@ std::vector<RGBController*> & ResourceManager::GetRGBControllers()
     return rgb_controllers;
 }
 
+std::mutex & ResourceManager::GetRGBControllersMutex()
+{
+    return RGBControllersMutex;
+}
+
 void ResourceManager::RegisterI2CBusDetector(I2CBusDetectorFunction detector)
 {
     i2c_bus_detectors.push_back(detector);
@@ -69,10 +106,11 @@ void ResourceManager::RegisterI2CDeviceDetector(std::string name, I2CDeviceDetec
     i2c_device_detectors.push_back(detector);
 }
 
-void ResourceManager::RegisterDeviceDetector(std::string name, DeviceDetectorFunction detector)
+void ResourceManager::RegisterDeviceDetector(std::string name, DeviceDetectorFunction detector, std::vector<unsigned short> hotplug_vids)
 {
     device_detector_strings.push_back(name);
     device_detectors.push_back(detector);
+    device_detector_vids.push_back(hotplug_vids);
 }
 
 void ResourceManager::RegisterDeviceListChangeCallback(ResourceManagerCallback new_callback, void * new_callback_arg)
@@ -81,6 +119,12 @@ void ResourceManager::RegisterDeviceListChangeCallback(ResourceManagerCallback n
     DeviceListChangeCallbackArgs.push_back(new_callback_arg);
 }
 
+void ResourceManager::RegisterDeviceListDeltaCallback(ResourceManagerDeltaCallback new_callback, void * new_callback_arg)
+{
+    DeviceListDeltaCallbacks.push_back(new_callback);
+    DeviceListDeltaCallbackArgs.push_back(new_callback_arg);
+}
+
 void ResourceManager::DeviceListChanged()
 {
     DeviceListChangeMutex.lock();
@@ -96,11 +140,65 @@ void ResourceManager::DeviceListChanged()
     DeviceListChangeMutex.unlock();
 }
 
+void ResourceManager::DeviceListChanged(std::vector<RGBController*>& added, std::vector<RGBController*>& removed)
+{
+    DeviceListChangeMutex.lock();
+
+    /*-------------------------------------------------*\
+    | Call the delta callbacks first.  Removed          |
+    | controllers are stopped but still allocated       |
+    | during the callback                               |
+    \*-------------------------------------------------*/
+    for(unsigned int callback_idx = 0; callback_idx < DeviceListDeltaCallbacks.size(); callback_idx++)
+    {
+        DeviceListDeltaCallbacks[callback_idx](DeviceListDeltaCallbackArgs[callback_idx], added, removed);
+    }
+
+    /*-------------------------------------------------*\
+    | Then call the plain change callbacks              |
+    \*-------------------------------------------------*/
+    for(unsigned int callback_idx = 0; callback_idx < DeviceListChangeCallbacks.size(); callback_idx++)
+    {
+        DeviceListChangeCallbacks[callback_idx](DeviceListChangeCallbackArgs[callback_idx]);
+    }
+
+    DeviceListChangeMutex.unlock();
+}
+
 NetworkServer* ResourceManager::GetServer()
 {
     return(server);
 }
 
+EffectsEngine* ResourceManager::GetEffectsEngine()
+{
+    return(effects);
+}
+
+void ResourceManager::SetGlobalBrightness(unsigned int brightness)
+{
+    RGBOutputStage::SetGlobalBrightness(brightness);
+
+    /*---------------------------------------------------------*\
+    | Resend every device's current frame at the new level      |
+    \*---------------------------------------------------------*/
+    RGBControllersMutex.lock();
+
+    for(std::size_t controller_idx = 0; controller_idx < rgb_controllers.size(); controller_idx++)
+    {
+        rgb_controllers[controller_idx]->RefreshOutput();
+    }
+
+    RGBControllersMutex.unlock();
+}
+
+void ResourceManager::CommitFrame()
+{
+    RGBControllersMutex.lock();
+    RGBController::CommitStagedLEDs(rgb_controllers);
+    RGBControllersMutex.unlock();
+}
+
 unsigned int ResourceManager::GetDetectionPercent()
 {
     return (detection_percent.load());
@@ -115,12 +213,21 @@ void ResourceManager::Cleanup()
 {
     ResourceManager::get()->WaitForDeviceDetection();
 
+    RGBControllersMutex.lock();
+
     for(RGBController* rgb_controller : rgb_controllers)
     {
         delete rgb_controller;
     }
     rgb_controllers.clear();
 
+    FreeRemovedControllers();
+    tombstone_controllers.clear();
+    controller_detectors.clear();
+    device_paths.clear();
+
+    RGBControllersMutex.unlock();
+
     for(i2c_smbus_interface* bus : busses)
     {
         delete bus;
@@ -165,12 +272,8 @@ void ResourceManager::DetectDevices()
     std::this_thread::sleep_for(1ms);
 }
 
-void ResourceManager::DetectDevicesThreadFunction()
+static std::vector<std::string> ReadDisabledDevicesList()
 {
-    DetectDeviceMutex.lock();
-    unsigned int prev_count = 0;
-    float        percent = 0.0f;
-
     std::vector<std::string> disabled_devices_list;
 
     /*-------------------------------------------------*\
@@ -190,6 +293,29 @@ void ResourceManager::DetectDevicesThreadFunction()
 
     infile.close();
 
+    return(disabled_devices_list);
+}
+
+static bool IsDetectorDisabled(std::vector<std::string>& disabled_devices_list, std::string name)
+{
+    for(std::size_t disabled_idx = 0; disabled_idx < disabled_devices_list.size(); disabled_idx++)
+    {
+        if(disabled_devices_list[disabled_idx] == name)
+        {
+            return(true);
+        }
+    }
+
+    return(false);
+}
+
+void ResourceManager::DetectDevicesThreadFunction()
+{
+    DetectDeviceMutex.lock();
+    float        percent = 0.0f;
+
+    std::vector<std::string> disabled_devices_list = ReadDisabledDevicesList();
+
     ProfileManager profile_manager(rgb_controllers);
 
     /*-------------------------------------------------*\
@@ -213,30 +339,28 @@ void ResourceManager::DetectDevicesThreadFunction()
         detection_string = i2c_device_detector_strings[i2c_detector_idx].c_str();
         DeviceListChanged();
 
-        bool this_device_disabled = false;
-        for(std::size_t disabled_idx = 0; disabled_idx < disabled_devices_list.size(); disabled_idx++)
-        {
-            if(disabled_devices_list[disabled_idx] == detection_string)
-            {
-                this_device_disabled = true;
-                break;
-            }
-        }
+        bool this_device_disabled = IsDetectorDisabled(disabled_devices_list, detection_string);
+
+        std::vector<RGBController*> added;
+        std::vector<RGBController*> removed;
 
         if(!this_device_disabled)
             {
-            i2c_device_detectors[i2c_detector_idx](busses, rgb_controllers);
+            i2c_device_detectors[i2c_detector_idx](busses, added);
             }
 
         /*-------------------------------------------------*\
-        | If the device list size has changed, call the     |
+        | Add the new controllers to the list and call the  |
         | device list changed callbacks                     |
         \*-------------------------------------------------*/
-        if(rgb_controllers.size() != prev_count)
+        if(added.size() > 0)
         {
-            DeviceListChanged();
+            RGBControllersMutex.lock();
+            rgb_controllers.insert(rgb_controllers.end(), added.begin(), added.end());
+            RGBControllersMutex.unlock();
+
+            DeviceListChanged(added, removed);
         }
-        prev_count = rgb_controllers.size();
 
         percent = (i2c_detector_idx + 1.0f) / (i2c_device_detectors.size() + device_detectors.size());
 
@@ -251,37 +375,44 @@ void ResourceManager::DetectDevicesThreadFunction()
         detection_string = device_detector_strings[detector_idx].c_str();
         DeviceListChanged();
 
-        bool this_device_disabled = false;
-        for(std::size_t disabled_idx = 0; disabled_idx < disabled_devices_list.size(); disabled_idx++)
-        {
-            if(disabled_devices_list[disabled_idx] == detection_string)
-            {
-                this_device_disabled = true;
-                break;
-            }
-        }
+        bool this_device_disabled = IsDetectorDisabled(disabled_devices_list, detection_string);
+
+        std::vector<RGBController*> added;
+        std::vector<RGBController*> removed;
 
         if(!this_device_disabled)
             {
-            device_detectors[detector_idx](rgb_controllers);
+            device_detectors[detector_idx](added);
             }
 
         /*-------------------------------------------------*\
-        | If the device list size has changed, call the     |
-        | device list changed callbacks                     |
+        | Add the new controllers to the list, remember     |
+        | which detector found them and call the device     |
+        | list changed callbacks                            |
         \*-------------------------------------------------*/
-        if(rgb_controllers.size() != prev_count)
+        if(added.size() > 0)
         {
-            DeviceListChanged();
+            RGBControllersMutex.lock();
+
+            for(RGBController* rgb_controller : added)
+            {
+                rgb_controllers.push_back(rgb_controller);
+                controller_detectors[rgb_controller] = detector_idx;
+            }
+
+            RGBControllersMutex.unlock();
+
+            DeviceListChanged(added, removed);
         }
-        prev_count = rgb_controllers.size();
 
         percent = (detector_idx + 1.0f + i2c_device_detectors.size()) / (i2c_device_detectors.size() + device_detectors.size());
 
         detection_percent = percent * 100.0f;
     }
 
+    RGBControllersMutex.lock();
     profile_manager.LoadSizeFromProfile("sizes.ors");
+    RGBControllersMutex.unlock();
 
     /*-------------------------------------------------*\
     | Make sure that when the detection is done,        |
@@ -309,3 +440,563 @@ void ResourceManager::WaitForDeviceDetection()
     DetectDeviceMutex.lock();
     DetectDeviceMutex.unlock();
 }
+
+static bool IsSameDevice(RGBController* a, RGBController* b)
+{
+    return((a->name     == b->name)
+        && (a->location == b->location)
+        && (a->serial   == b->serial));
+}
+
+/*-------------------------------------------------*\
+| A replugged device usually gets a new location,   |
+| so only the name and serial are compared when     |
+| looking for the slot it had before                |
+\*-------------------------------------------------*/
+static bool IsReplugOf(RGBController* tombstone, RGBController* b)
+{
+    return((tombstone->name   == b->name)
+        && (tombstone->serial == b->serial));
+}
+
+static bool MatchesVendor(std::vector<unsigned short>& detector_vids, std::vector<unsigned short>& vids)
+{
+    if(vids.size() == 0)
+    {
+        return(true);
+    }
+
+    for(std::size_t vid_idx = 0; vid_idx < vids.size(); vid_idx++)
+    {
+        if(std::find(detector_vids.begin(), detector_vids.end(), vids[vid_idx]) != detector_vids.end())
+        {
+            return(true);
+        }
+    }
+
+    return(false);
+}
+
+/*-------------------------------------------------*\
+| Create the dummy that keeps an unplugged          |
+| controller's slot, carrying its description so    |
+| the slot still reads the same to clients          |
+\*-------------------------------------------------*/
+static RGBController* CreateTombstone(RGBController* rgb_controller)
+{
+    RGBController_Dummy* tombstone   = new RGBController_Dummy();
+    unsigned char*       description = rgb_controller->GetDeviceDescription();
+    unsigned int         description_size;
+
+    memcpy(&description_size, description, sizeof(description_size));
+
+    tombstone->ReadDeviceDescription(description, description_size);
+
+    delete[] description;
+
+    return(tombstone);
+}
+
+void ResourceManager::RescanHotplugDevices(std::vector<unsigned short>& vids)
+{
+    /*-------------------------------------------------*\
+    | A full detection picks up any change by itself    |
+    \*-------------------------------------------------*/
+    if(detection_is_required.load())
+    {
+        return;
+    }
+
+    DetectDeviceMutex.lock();
+
+    std::vector<std::string>                    disabled_devices_list = ReadDisabledDevicesList();
+    std::vector<unsigned int>                   rescanned_detectors;
+    std::vector<std::vector<RGBController*>>    rescanned_found;
+
+    /*-------------------------------------------------*\
+    | Rerun only the USB detectors that handle a vendor |
+    | seen in the events.  An empty vendor list reruns  |
+    | all of them.  The detectors run without the list  |
+    | lock so other threads keep using the list, and    |
+    | skip the paths that already have a controller     |
+    \*-------------------------------------------------*/
+    RGBControllersMutex.lock();
+    rescan_active = true;
+    rescan_open_controllers.clear();
+    RGBControllersMutex.unlock();
+
+    for(unsigned int detector_idx = 0; detector_idx < device_detectors.size(); detector_idx++)
+    {
+        if((device_detector_vids[detector_idx].size() == 0)
+        || !MatchesVendor(device_detector_vids[detector_idx], vids)
+        || IsDetectorDisabled(disabled_devices_list, device_detector_strings[detector_idx]))
+        {
+            continue;
+        }
+
+        std::vector<RGBController*> found;
+
+        device_detectors[detector_idx](found);
+
+        rescanned_detectors.push_back(detector_idx);
+        rescanned_found.push_back(found);
+    }
+
+    std::vector<RGBController*> added;
+    std::vector<RGBController*> removed;
+    std::vector<RGBController*> duplicates;
+
+    RGBControllersMutex.lock();
+
+    rescan_active = false;
+
+    for(std::size_t rescan_idx = 0; rescan_idx < rescanned_detectors.size(); rescan_idx++)
+    {
+        unsigned int                    detector_idx    = rescanned_detectors[rescan_idx];
+        std::vector<RGBController*>&    found           = rescanned_found[rescan_idx];
+        std::vector<std::size_t>        existing;
+        std::vector<std::size_t>        tombstones;
+
+        for(std::size_t controller_idx = 0; controller_idx < rgb_controllers.size(); controller_idx++)
+        {
+            std::map<RGBController*, unsigned int>::iterator it = controller_detectors.find(rgb_controllers[controller_idx]);
+
+            if(it == controller_detectors.end() || it->second != detector_idx)
+            {
+                continue;
+            }
+
+            if(std::find(tombstone_controllers.begin(), tombstone_controllers.end(), it->first) != tombstone_controllers.end())
+            {
+                tombstones.push_back(controller_idx);
+            }
+            else
+            {
+                existing.push_back(controller_idx);
+            }
+        }
+
+        /*-------------------------------------------------*\
+        | Keep the existing controller for devices that are |
+        | still present so their identity doesn't change.   |
+        | The detector skipped the ones whose path it found |
+        | open.  Detectors that don't check paths create a  |
+        | duplicate instead, which is matched and freed     |
+        \*-------------------------------------------------*/
+        std::vector<bool>           existing_found(existing.size(), false);
+        std::vector<RGBController*> unmatched;
+
+        for(std::size_t existing_idx = 0; existing_idx < existing.size(); existing_idx++)
+        {
+            RGBController* rgb_controller = rgb_controllers[existing[existing_idx]];
+
+            if(std::find(rescan_open_controllers.begin(), rescan_open_controllers.end(), rgb_controller) != rescan_open_controllers.end())
+            {
+                existing_found[existing_idx] = true;
+            }
+        }
+
+        for(RGBController* found_controller : found)
+        {
+            bool matched = false;
+
+            for(std::size_t existing_idx = 0; existing_idx < existing.size(); existing_idx++)
+            {
+                if(!existing_found[existing_idx] && IsSameDevice(rgb_controllers[existing[existing_idx]], found_controller))
+                {
+                    existing_found[existing_idx] = true;
+                    matched = true;
+                    break;
+                }
+            }
+
+            if(matched)
+            {
+                ForgetDevicePaths(found_controller);
+                duplicates.push_back(found_controller);
+            }
+            else
+            {
+                unmatched.push_back(found_controller);
+            }
+        }
+
+        /*-------------------------------------------------*\
+        | A device that was replugged between two events    |
+        | shows up at a new location, and a device coming   |
+        | back after a rescan has left a dummy.  Either way |
+        | the new controller takes over the old slot        |
+        \*-------------------------------------------------*/
+        for(RGBController* found_controller : unmatched)
+        {
+            bool matched = false;
+
+            for(std::size_t existing_idx = 0; existing_idx < existing.size(); existing_idx++)
+            {
+                if(!existing_found[existing_idx] && IsReplugOf(rgb_controllers[existing[existing_idx]], found_controller))
+                {
+                    std::size_t controller_idx = existing[existing_idx];
+
+                    ForgetDevicePaths(rgb_controllers[controller_idx]);
+                    controller_detectors.erase(rgb_controllers[controller_idx]);
+                    removed.push_back(rgb_controllers[controller_idx]);
+
+                    rgb_controllers[controller_idx] = found_controller;
+                    existing_found[existing_idx] = true;
+                    matched = true;
+                    break;
+                }
+            }
+
+            for(std::size_t tombstone_idx = 0; !matched && tombstone_idx < tombstones.size(); tombstone_idx++)
+            {
+                std::size_t     controller_idx  = tombstones[tombstone_idx];
+                RGBController*  tombstone       = rgb_controllers[controller_idx];
+
+                if(IsReplugOf(tombstone, found_controller))
+                {
+                    tombstone_controllers.erase(std::find(tombstone_controllers.begin(), tombstone_controllers.end(), tombstone));
+                    controller_detectors.erase(tombstone);
+                    removed.push_back(tombstone);
+
+                    rgb_controllers[controller_idx] = found_controller;
+                    tombstones.erase(tombstones.begin() + tombstone_idx);
+                    matched = true;
+                }
+            }
+
+            if(!matched)
+            {
+                rgb_controllers.push_back(found_controller);
+            }
+
+            controller_detectors[found_controller] = detector_idx;
+            added.push_back(found_controller);
+        }
+
+        /*-------------------------------------------------*\
+        | Leave a dummy in the slot of each device that is  |
+        | gone so the indices of later devices never shift  |
+        \*-------------------------------------------------*/
+        for(std::size_t existing_idx = 0; existing_idx < existing.size(); existing_idx++)
+        {
+            if(existing_found[existing_idx])
+            {
+                continue;
+            }
+
+            std::size_t     controller_idx  = existing[existing_idx];
+            RGBController*  rgb_controller  = rgb_controllers[controller_idx];
+
+            /*-------------------------------------------------*\
+            | The device is gone, so stopping its thread is     |
+            | quick, and the colors can then be copied safely   |
+            \*-------------------------------------------------*/
+            rgb_controller->StopDeviceThread();
+
+            RGBController*  tombstone       = CreateTombstone(rgb_controller);
+
+            ForgetDevicePaths(rgb_controller);
+            controller_detectors.erase(rgb_controller);
+            removed.push_back(rgb_controller);
+
+            rgb_controllers[controller_idx] = tombstone;
+            controller_detectors[tombstone] = detector_idx;
+            tombstone_controllers.push_back(tombstone);
+            added.push_back(tombstone);
+        }
+    }
+
+    RGBControllersMutex.unlock();
+
+    DetectDeviceMutex.unlock();
+
+    /*-------------------------------------------------*\
+    | Nothing can reach the duplicates or the removed   |
+    | controllers through the list any more.  Stop the  |
+    | removed ones before anyone is told about them     |
+    \*-------------------------------------------------*/
+    for(RGBController* rgb_controller : duplicates)
+    {
+        delete rgb_controller;
+    }
+
+    for(RGBController* rgb_controller : removed)
+    {
+        rgb_controller->StopDeviceThread();
+    }
+
+    if(added.size() == 0 && removed.size() == 0)
+    {
+        return;
+    }
+
+    RGBControllersMutex.lock();
+    removed_controllers.insert(removed_controllers.end(), removed.begin(), removed.end());
+    RGBControllersMutex.unlock();
+
+    DeviceListChanged(added, removed);
+
+    /*-------------------------------------------------*\
+    | Free the removed controllers now unless a holder  |
+    | still has pointers to drop                        |
+    \*-------------------------------------------------*/
+    RGBControllersMutex.lock();
+
+    if(!hold_removed_controllers)
+    {
+        FreeRemovedControllers();
+    }
+
+    RGBControllersMutex.unlock();
+}
+
+void ResourceManager::RegisterDevicePath(const char* path, RGBController* controller)
+{
+    RGBControllersMutex.lock();
+    device_paths.insert(std::make_pair(std::string(path), controller));
+    RGBControllersMutex.unlock();
+}
+
+bool ResourceManager::IsDevicePathOpen(const char* path)
+{
+    std::lock_guard<std::mutex> lock(RGBControllersMutex);
+
+    /*-------------------------------------------------*\
+    | A full detection starts from an empty list and    |
+    | opens every path                                  |
+    \*-------------------------------------------------*/
+    if(!rescan_active)
+    {
+        return(false);
+    }
+
+    std::pair<std::multimap<std::string, RGBController*>::iterator, std::multimap<std::string, RGBController*>::iterator> range = device_paths.equal_range(path);
+
+    if(range.first == range.second)
+    {
+        return(false);
+    }
+
+    for(std::multimap<std::string, RGBController*>::iterator it = range.first; it != range.second; it++)
+    {
+        rescan_open_controllers.push_back(it->second);
+    }
+
+    return(true);
+}
+
+void ResourceManager::ForgetDevicePaths(RGBController* controller)
+{
+    /*-------------------------------------------------*\
+    | The caller holds the controller list lock         |
+    \*-------------------------------------------------*/
+    for(std::multimap<std::string, RGBController*>::iterator it = device_paths.begin(); it != device_paths.end();)
+    {
+        if(it->second == controller)
+        {
+            it = device_paths.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
+void ResourceManager::HoldRemovedControllers()
+{
+    RGBControllersMutex.lock();
+    hold_removed_controllers = true;
+    RGBControllersMutex.unlock();
+}
+
+void ResourceManager::FreeRemovedControllers()
+{
+    /*-------------------------------------------------*\
+    | The caller holds the controller list lock         |
+    \*-------------------------------------------------*/
+    for(RGBController* rgb_controller : removed_controllers)
+    {
+        delete rgb_controller;
+    }
+    removed_controllers.clear();
+}
+
+void ResourceManager::StartHotplugMonitor()
+{
+#ifdef __linux__
+    if(HotplugMonitorThread != nullptr)
+    {
+        return;
+    }
+
+    hotplug_monitor_running = true;
+    HotplugMonitorThread    = new std::thread(&ResourceManager::HotplugMonitorThreadFunction, this);
+#endif
+}
+
+void ResourceManager::StopHotplugMonitor()
+{
+    hotplug_monitor_running = false;
+
+    if(HotplugMonitorThread)
+    {
+        HotplugMonitorThread->join();
+        delete HotplugMonitorThread;
+        HotplugMonitorThread = nullptr;
+    }
+}
+
+#ifdef __linux__
+/*-------------------------------------------------*\
+| Check whether a kernel uevent is a USB or hidraw  |
+| add/remove.  The message is a header followed by  |
+| null separated KEY=value strings.  The vendor ID  |
+| is read from PRODUCT=vid/pid/rev for USB devices  |
+| and from the BBBB:VVVV:PPPP.NNNN node in the      |
+| DEVPATH for hidraw, and is -1 if neither is found |
+\*-------------------------------------------------*/
+static bool IsHotplugEvent(const char* buf, int len, int* vid)
+{
+    bool action_match       = false;
+    bool subsystem_match    = false;
+
+    *vid = -1;
+
+    for(int pos = 0; pos < len; pos += strlen(&buf[pos]) + 1)
+    {
+        const char* field = &buf[pos];
+
+        if(strcmp(field, "ACTION=add") == 0 || strcmp(field, "ACTION=remove") == 0)
+        {
+            action_match = true;
+        }
+        else if(strcmp(field, "SUBSYSTEM=hidraw") == 0 || strcmp(field, "DEVTYPE=usb_device") == 0)
+        {
+            subsystem_match = true;
+        }
+        else if(strncmp(field, "PRODUCT=", 8) == 0)
+        {
+            unsigned int product_vid;
+
+            if(sscanf(&field[8], "%x/", &product_vid) == 1)
+            {
+                *vid = product_vid;
+            }
+        }
+        else if(strncmp(field, "DEVPATH=", 8) == 0)
+        {
+            for(const char* node = strchr(field, '/'); node != NULL; node = strchr(node + 1, '/'))
+            {
+                unsigned int hid_bus;
+                unsigned int hid_vid;
+                unsigned int hid_pid;
+                unsigned int hid_idx;
+
+                if((strlen(node) > 15) && (node[5] == ':') && (node[10] == ':') && (node[15] == '.')
+                && (sscanf(node, "/%4x:%4x:%4x.%x", &hid_bus, &hid_vid, &hid_pid, &hid_idx) == 4))
+                {
+                    *vid = hid_vid;
+                    break;
+                }
+            }
+        }
+    }
+
+    return(action_match && subsystem_match);
+}
+#endif
+
+void ResourceManager::HotplugMonitorThreadFunction()
+{
+#ifdef __linux__
+    /*-------------------------------------------------*\
+    | Listen for kernel uevents over netlink            |
+    \*-------------------------------------------------*/
+    int sock = socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC, NETLINK_KOBJECT_UEVENT);
+
+    if(sock < 0)
+    {
+        return;
+    }
+
+    struct sockaddr_nl addr;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.nl_family  = AF_NETLINK;
+    addr.nl_pid     = 0;
+    addr.nl_groups  = 1;
+
+    if(bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+        close(sock);
+        return;
+    }
+
+    bool                        rescan_pending  = false;
+    bool                        rescan_all      = false;
+    std::vector<unsigned short> rescan_vids;
+    char                        buf[4096];
+
+    while(hotplug_monitor_running.load())
+    {
+        struct pollfd fds;
+
+        fds.fd      = sock;
+        fds.events  = POLLIN;
+        fds.revents = 0;
+
+        /*-------------------------------------------------*\
+        | Once an event has been seen, rescan only after no |
+        | further event has arrived for the debounce time   |
+        \*-------------------------------------------------*/
+        int rv = poll(&fds, 1, rescan_pending ? HOTPLUG_DEBOUNCE_MS : 250);
+
+        if(rv > 0)
+        {
+            int len = recv(sock, buf, sizeof(buf) - 1, 0);
+
+            if(len > 0)
+            {
+                int vid;
+
+                buf[len] = '\0';
+
+                if(IsHotplugEvent(buf, len, &vid))
+                {
+                    rescan_pending = true;
+
+                    /*-------------------------------------------------*\
+                    | Collect the vendors seen until the rescan.  An    |
+                    | event without a vendor ID rescans every detector  |
+                    \*-------------------------------------------------*/
+                    if(vid < 0)
+                    {
+                        rescan_all = true;
+                    }
+                    else if(std::find(rescan_vids.begin(), rescan_vids.end(), (unsigned short)vid) == rescan_vids.end())
+                    {
+                        rescan_vids.push_back((unsigned short)vid);
+                    }
+                }
+            }
+        }
+        else if(rv == 0 && rescan_pending)
+        {
+            if(rescan_all)
+            {
+                rescan_vids.clear();
+            }
+
+            RescanHotplugDevices(rescan_vids);
+
+            rescan_pending  = false;
+            rescan_all      = false;
+            rescan_vids.clear();
+        }
+    }
+
+    close(sock);
+#endif
+}
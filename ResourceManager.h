@@ -1,12 +1,15 @@
 #pragma once
 
+#include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <functional>
 #include <thread>
 #include <string>
 
 #include "i2c_smbus.h"
+#include "EffectsEngine.h"
 #include "NetworkClient.h"
 #include "NetworkServer.h"
 #include "RGBController.h"
@@ -16,6 +19,7 @@ typedef std::function<void(std::vector<RGBController*>&)>
 typedef std::function<void(std::vector<i2c_smbus_interface*>&, std::vector<RGBController*>&)>   I2CDeviceDetectorFunction;
 
 typedef void (*ResourceManagerCallback)(void *);
+typedef void (*ResourceManagerDeltaCallback)(void *, std::vector<RGBController*>& added, std::vector<RGBController*>& removed);
 
 class ResourceManager
 {
@@ -30,18 +34,25 @@ public:
     
     void RegisterRGBController(RGBController *);
     std::vector<RGBController*> & GetRGBControllers();
+    std::mutex & GetRGBControllersMutex();
     
     void RegisterI2CBusDetector         (I2CBusDetectorFunction     detector);
-    void RegisterDeviceDetector         (std::string name, DeviceDetectorFunction     detector);
+    void RegisterDeviceDetector         (std::string name, DeviceDetectorFunction     detector, std::vector<unsigned short> hotplug_vids = std::vector<unsigned short>());
     void RegisterI2CDeviceDetector      (std::string name, I2CDeviceDetectorFunction  detector);
     
     void RegisterDeviceListChangeCallback(ResourceManagerCallback new_callback, void * new_callback_arg);
+    void RegisterDeviceListDeltaCallback(ResourceManagerDeltaCallback new_callback, void * new_callback_arg);
 
     unsigned int GetDetectionPercent();
     const char*  GetDetectionString();
     NetworkServer* GetServer();
+    EffectsEngine* GetEffectsEngine();
+
+    void SetGlobalBrightness(unsigned int brightness);
+    void CommitFrame();
 
     void DeviceListChanged();
+    void DeviceListChanged(std::vector<RGBController*>& added, std::vector<RGBController*>& removed);
 
     void Cleanup();
 
@@ -53,7 +64,32 @@ public:
 
     void WaitForDeviceDetection();
 
+    void RescanHotplugDevices(std::vector<unsigned short>& vids);
+
+    void StartHotplugMonitor();
+
+    void StopHotplugMonitor();
+
+    void HotplugMonitorThreadFunction();
+
+    void HoldRemovedControllers();
+
+    void FreeRemovedControllers();
+
+    /*-------------------------------------------------------------------------------------*\
+    | Called by device detectors.  RegisterDevicePath records the path a detector opened    |
+    | for a controller.  IsDevicePathOpen is checked before opening a path, and during a    |
+    | hotplug rescan returns true for a path that already has a controller, which marks     |
+    | that controller as still present.  The detector then skips the path instead of        |
+    | opening and initializing the device a second time                                     |
+    \*-------------------------------------------------------------------------------------*/
+    void RegisterDevicePath(const char* path, RGBController* controller);
+
+    bool IsDevicePathOpen(const char* path);
+
 private:
+    void ForgetDevicePaths(RGBController* controller);
+
     static std::unique_ptr<ResourceManager>     instance;
 
     /*-------------------------------------------------------------------------------------*\
@@ -67,11 +103,22 @@ private:
     //std::vector<RGBController*>                 rgb_controllers_hw;
     std::vector<RGBController*>                 rgb_controllers;
 
+    /*-------------------------------------------------------------------------------------*\
+    | Every thread that reads or changes rgb_controllers holds this lock while it does.     |
+    | When the effects lock is also needed, this one is taken first                         |
+    \*-------------------------------------------------------------------------------------*/
+    std::mutex                                  RGBControllersMutex;
+
     /*-------------------------------------------------------------------------------------*\
     | Network Server                                                                        |
     \*-------------------------------------------------------------------------------------*/
     NetworkServer*                              server;
 
+    /*-------------------------------------------------------------------------------------*\
+    | Effects Engine                                                                        |
+    \*-------------------------------------------------------------------------------------*/
+    EffectsEngine*                              effects;
+
     /*-------------------------------------------------------------------------------------*\
     | Network Clients                                                                       |
     \*-------------------------------------------------------------------------------------*/
@@ -82,6 +129,7 @@ private:
     \*-------------------------------------------------------------------------------------*/
     std::vector<DeviceDetectorFunction>         device_detectors;
     std::vector<std::string>                    device_detector_strings;
+    std::vector<std::vector<unsigned short>>    device_detector_vids;
     std::vector<I2CBusDetectorFunction>         i2c_bus_detectors;
     std::vector<I2CDeviceDetectorFunction>      i2c_device_detectors;
     std::vector<std::string>                    i2c_device_detector_strings;
@@ -95,6 +143,34 @@ private:
     std::atomic<bool>                           detection_is_required;
     std::atomic<unsigned int>                   detection_percent;
     const char*                                 detection_string;
+
+    /*-------------------------------------------------------------------------------------*\
+    | Hotplug State                                                                         |
+    |   controller_detectors maps each controller found by a device detector to the index   |
+    |   of that detector so a rescan can tell which controllers it owns.  A controller that |
+    |   is unplugged leaves a dummy in its slot so later indices never shift, and the slot  |
+    |   is reused if the same device comes back.  Unplugged controllers are stopped at once |
+    |   and freed after the change callbacks, or by FreeRemovedControllers if a holder has  |
+    |   asked to keep them until it has dropped its pointers                                |
+    \*-------------------------------------------------------------------------------------*/
+    std::map<RGBController*, unsigned int>      controller_detectors;
+    std::vector<RGBController*>                 tombstone_controllers;
+    std::vector<RGBController*>                 removed_controllers;
+    bool                                        hold_removed_controllers;
+
+    /*-------------------------------------------------------------------------------------*\
+    | Device Paths                                                                          |
+    |   device_paths maps each path registered by a detector to its controllers, a path can |
+    |   have several when one device is split into more than one controller.  While a       |
+    |   hotplug rescan runs its detectors, the controllers whose paths they skip are        |
+    |   collected in rescan_open_controllers.  Both are protected by RGBControllersMutex    |
+    \*-------------------------------------------------------------------------------------*/
+    std::multimap<std::string, RGBController*>  device_paths;
+    std::vector<RGBController*>                 rescan_open_controllers;
+    bool                                        rescan_active;
+
+    std::thread *                               HotplugMonitorThread;
+    std::atomic<bool>                           hotplug_monitor_running;
     
     /*-------------------------------------------------------------------------------------*\
     | Device List Changed Callback                                                          |
@@ -102,4 +178,6 @@ private:
     std::mutex                                  DeviceListChangeMutex;
     std::vector<ResourceManagerCallback>        DeviceListChangeCallbacks;
     std::vector<void *>                         DeviceListChangeCallbackArgs;
+    std::vector<ResourceManagerDeltaCallback>   DeviceListDeltaCallbacks;
+    std::vector<void *>                         DeviceListDeltaCallbackArgs;
 };
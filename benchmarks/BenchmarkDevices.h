@@ -0,0 +1,168 @@
+/*-----------------------------------------*\
+|  BenchmarkDevices.h                       |
+|                                           |
+|  Dummy devices and timing helpers shared  |
+|  by the standalone benchmarks             |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#pragma once
+
+#include "RGBController.h"
+#include "RGBController_Dummy.h"
+#include "ResourceManager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+void DetectDebugControllers(std::vector<RGBController*> &rgb_controllers);
+
+/*---------------------------------------------------------*\
+| Create a dummy device with a direct and a static mode and |
+| one linear zone of num_leds LEDs                          |
+\*---------------------------------------------------------*/
+static inline RGBController_Dummy* CreateBenchmarkDevice(RGBController_Dummy* dummy, unsigned int device_idx, unsigned int num_leds)
+{
+    dummy->name         = "Benchmark Device " + std::to_string(device_idx);
+    dummy->type         = DEVICE_TYPE_LEDSTRIP;
+    dummy->description  = "Benchmark Device";
+    dummy->location     = "Benchmark Location " + std::to_string(device_idx);
+    dummy->version      = "1.0";
+    dummy->serial       = "BENCH" + std::to_string(device_idx);
+
+    mode direct_mode = {};
+
+    direct_mode.name        = "Direct";
+    direct_mode.value       = 0;
+    direct_mode.flags       = MODE_FLAG_HAS_PER_LED_COLOR;
+    direct_mode.color_mode  = MODE_COLORS_PER_LED;
+
+    dummy->modes.push_back(direct_mode);
+
+    mode static_mode = {};
+
+    static_mode.name        = "Static";
+    static_mode.value       = 1;
+    static_mode.flags       = MODE_FLAG_HAS_MODE_SPECIFIC_COLOR;
+    static_mode.colors_min  = 1;
+    static_mode.colors_max  = 1;
+    static_mode.color_mode  = MODE_COLORS_MODE_SPECIFIC;
+    static_mode.colors.resize(1);
+
+    dummy->modes.push_back(static_mode);
+
+    zone linear_zone = {};
+
+    linear_zone.name        = "Linear Zone";
+    linear_zone.type        = ZONE_TYPE_LINEAR;
+    linear_zone.leds_min    = num_leds;
+    linear_zone.leds_max    = num_leds;
+    linear_zone.leds_count  = num_leds;
+    linear_zone.matrix_map  = NULL;
+
+    dummy->zones.push_back(linear_zone);
+
+    for(unsigned int led_idx = 0; led_idx < num_leds; led_idx++)
+    {
+        led new_led = {};
+
+        new_led.name = "LED " + std::to_string(led_idx);
+
+        dummy->leds.push_back(new_led);
+    }
+
+    dummy->SetupColors();
+
+    return(dummy);
+}
+
+static inline RGBController_Dummy* CreateBenchmarkDevice(unsigned int device_idx, unsigned int num_leds)
+{
+    return(CreateBenchmarkDevice(new RGBController_Dummy(), device_idx, num_leds));
+}
+
+/*---------------------------------------------------------*\
+| Create the devices DebugControllerDetect makes for the    |
+| given debug.txt entries, e.g. "debug_keyboard".  It reads |
+| debug.txt from the working directory, so it is run from a |
+| temporary directory                                       |
+\*---------------------------------------------------------*/
+static inline std::vector<RGBController*> CreateDebugDevices(std::vector<std::string> entries)
+{
+    std::vector<RGBController*> devices;
+    char                        debug_dir[] = "/tmp/openrgb_benchmark_XXXXXX";
+    char                        old_dir[4096];
+
+    if((mkdtemp(debug_dir) == NULL) || (getcwd(old_dir, sizeof(old_dir)) == NULL))
+    {
+        return(devices);
+    }
+
+    std::string debug_path  = std::string(debug_dir) + "/debug.txt";
+    FILE*       debug_file  = fopen(debug_path.c_str(), "w");
+
+    if(debug_file != NULL)
+    {
+        for(std::string& entry : entries)
+        {
+            fprintf(debug_file, "%s\n", entry.c_str());
+        }
+
+        fclose(debug_file);
+
+        /*---------------------------------------------------------*\
+        | Keyboards are registered with the resource manager, the   |
+        | other devices are returned in the list                    |
+        \*---------------------------------------------------------*/
+        std::vector<RGBController*>&    registered          = ResourceManager::get()->GetRGBControllers();
+        std::size_t                     registered_count    = registered.size();
+
+        if(chdir(debug_dir) == 0)
+        {
+            DetectDebugControllers(devices);
+
+            if(chdir(old_dir) != 0)
+            {
+                printf("Could not return to %s\n", old_dir);
+            }
+        }
+
+        devices.insert(devices.end(), registered.begin() + registered_count, registered.end());
+        registered.resize(registered_count);
+
+        remove(debug_path.c_str());
+    }
+
+    rmdir(debug_dir);
+
+    return(devices);
+}
+
+static inline double ElapsedMs(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    return(std::chrono::duration<double, std::milli>(end - start).count());
+}
+
+/*---------------------------------------------------------*\
+| Return the given percentile (0 to 100) of the samples,    |
+| sorting them in place                                     |
+\*---------------------------------------------------------*/
+static inline double Percentile(std::vector<double>& samples, double percentile)
+{
+    if(samples.size() == 0)
+    {
+        return(0.0);
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    std::size_t sample_idx = (std::size_t)((percentile / 100.0) * (samples.size() - 1) + 0.5);
+
+    return(samples[sample_idx]);
+}
@@ -0,0 +1,263 @@
+/*-----------------------------------------*\
+|  BenchmarkLatency.h                       |
+|                                           |
+|  End to end SDK latency measurement from  |
+|  a client's SetAllLEDs to the server's    |
+|  device call, shared by the benchmarks    |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#pragma once
+
+#include "BenchmarkDevices.h"
+#include "NetworkClient.h"
+#include "NetworkServer.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+/*---------------------------------------------------------*\
+| Sequence numbers are sent as the color of every LED, so   |
+| they wrap at 24 bits.  Send times are kept in a ring that |
+| is far larger than the frames in flight at any time       |
+\*---------------------------------------------------------*/
+#define LATENCY_SEQUENCE_MASK   0x00FFFFFF
+#define LATENCY_SLOTS           65536
+
+class LatencyRecorder
+{
+public:
+    LatencyRecorder()
+    {
+        Reset();
+    }
+
+    void Reset()
+    {
+        std::lock_guard<std::mutex> lock(samples_mutex);
+
+        for(unsigned int slot_idx = 0; slot_idx < LATENCY_SLOTS; slot_idx++)
+        {
+            send_ns[slot_idx] = 0;
+        }
+
+        samples.clear();
+        next_sequence = 1;
+        sent          = 0;
+    }
+
+    /*---------------------------------------------------------*\
+    | Take a new sequence number and record when it was sent    |
+    \*---------------------------------------------------------*/
+    unsigned int Send()
+    {
+        unsigned int sequence = next_sequence.fetch_add(1) & LATENCY_SEQUENCE_MASK;
+
+        send_ns[sequence % LATENCY_SLOTS] = NowNs();
+        sent++;
+
+        return(sequence);
+    }
+
+    void Received(unsigned int sequence)
+    {
+        long long now_ns    = NowNs();
+        long long sent_ns   = send_ns[sequence % LATENCY_SLOTS].load();
+
+        if(sent_ns == 0)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(samples_mutex);
+
+        samples.push_back((now_ns - sent_ns) / 1000000.0);
+    }
+
+    unsigned int GetSent()
+    {
+        return(sent.load());
+    }
+
+    std::vector<double> GetSamples()
+    {
+        std::lock_guard<std::mutex> lock(samples_mutex);
+
+        return(samples);
+    }
+
+private:
+    std::atomic<long long>      send_ns[LATENCY_SLOTS];
+    std::atomic<unsigned int>   next_sequence;
+    std::atomic<unsigned int>   sent;
+    std::mutex                  samples_mutex;
+    std::vector<double>         samples;
+
+    static long long NowNs()
+    {
+        return(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+};
+
+/*---------------------------------------------------------*\
+| Server side device that records the latency of each new   |
+| sequence number it is asked to send                       |
+\*---------------------------------------------------------*/
+class LatencyDevice : public RGBController_Dummy
+{
+public:
+    LatencyDevice(LatencyRecorder* new_recorder, unsigned int device_idx, unsigned int num_leds)
+    {
+        recorder        = new_recorder;
+        last_sequence   = 0;
+
+        CreateBenchmarkDevice(this, device_idx, num_leds);
+    }
+
+    void DeviceUpdateLEDs()
+    {
+        if(colors.size() == 0)
+        {
+            return;
+        }
+
+        unsigned int sequence = colors[0] & LATENCY_SEQUENCE_MASK;
+
+        if((sequence != 0) && (sequence != last_sequence))
+        {
+            recorder->Received(sequence);
+
+            last_sequence = sequence;
+        }
+    }
+
+private:
+    LatencyRecorder*    recorder;
+    unsigned int        last_sequence;
+};
+
+typedef struct
+{
+    unsigned int    sent;
+    unsigned int    received;
+    double          mean;
+    double          stddev;
+    double          p50;
+    double          p99;
+    double          max;
+} LatencyResult;
+
+static inline LatencyResult GetLatencyResult(LatencyRecorder& recorder)
+{
+    LatencyResult       result  = {};
+    std::vector<double> samples = recorder.GetSamples();
+
+    result.sent     = recorder.GetSent();
+    result.received = (unsigned int)samples.size();
+
+    if(samples.size() == 0)
+    {
+        return(result);
+    }
+
+    double sum = 0.0;
+
+    for(double sample : samples)
+    {
+        sum += sample;
+    }
+
+    result.mean = sum / samples.size();
+
+    double variance = 0.0;
+
+    for(double sample : samples)
+    {
+        variance += (sample - result.mean) * (sample - result.mean);
+    }
+
+    result.stddev   = sqrt(variance / samples.size());
+    result.p50      = Percentile(samples, 50.0);
+    result.p99      = Percentile(samples, 99.0);
+    result.max      = Percentile(samples, 100.0);
+
+    return(result);
+}
+
+static inline void PrintLatencyHeader()
+{
+    printf("%-16s  %8s  %8s  %8s  %8s  %8s  %8s  %8s\n", "transport", "sent", "received", "mean ms", "stddev", "p50 ms", "p99 ms", "max ms");
+}
+
+static inline void PrintLatencyResult(const char* transport, LatencyResult& result)
+{
+    printf("%-16s  %8u  %8u  %8.3f  %8.3f  %8.3f  %8.3f  %8.3f\n", transport, result.sent, result.received, result.mean, result.stddev, result.p50, result.p99, result.max);
+}
+
+/*---------------------------------------------------------*\
+| Connect a client and wait until it has every controller.  |
+| Connecting to 127.0.0.1 lets the client use shared memory |
+| if the server offers it, any other loopback address keeps |
+| it on the socket                                          |
+\*---------------------------------------------------------*/
+static inline NetworkClient* ConnectBenchmarkClient(std::vector<RGBController*>& client_controllers, const char* ip, unsigned short port, bool stream)
+{
+    NetworkClient* client = new NetworkClient(client_controllers);
+
+    client->SetIP(ip);
+    client->SetPort(port);
+    client->SetName("Latency Benchmark");
+    client->SetStreamEnabled(stream);
+
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + 10s;
+
+    client->StartClient();
+
+    while(!client->GetOnline() && (std::chrono::steady_clock::now() < deadline))
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    if(!client->GetOnline())
+    {
+        client->StopClient();
+        delete client;
+        return(NULL);
+    }
+
+    return(client);
+}
+
+/*---------------------------------------------------------*\
+| Send a new sequence number to every device once per frame |
+| interval for duration, then let the last frames arrive    |
+\*---------------------------------------------------------*/
+static inline void StreamLatencyFrames(LatencyRecorder& recorder, std::vector<RGBController*>& devices, double fps, std::chrono::milliseconds duration)
+{
+    std::chrono::nanoseconds                interval((long long)(1000000000.0 / fps));
+    std::chrono::steady_clock::time_point   next    = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point   end     = next + duration;
+
+    while(next < end)
+    {
+        for(RGBController* device : devices)
+        {
+            device->SetAllLEDs(recorder.Send());
+            device->UpdateLEDs();
+        }
+
+        next += interval;
+
+        std::this_thread::sleep_until(next);
+    }
+
+    std::this_thread::sleep_for(250ms);
+}
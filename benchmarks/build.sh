@@ -0,0 +1,71 @@
+#!/bin/bash
+
+#-----------------------------------------------------------------------#
+# OpenRGB Benchmark Build Script                                        #
+#                                                                       #
+# Builds the standalone benchmarks in this directory against the SDK    #
+# and RGBController sources, without Qt or any hardware detectors       #
+#                                                                       #
+#   benchmarks/build.sh [build dir] [benchmark name...]                 #
+#-----------------------------------------------------------------------#
+
+set -e
+
+BENCHMARK_DIR=$(cd "$(dirname "$0")" && pwd)
+ROOT_DIR=$(dirname "$BENCHMARK_DIR")
+BUILD_DIR=${1:-build}
+shift || true
+
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:--O2 -g}
+
+INCLUDES="-I$ROOT_DIR -I$ROOT_DIR/RGBController -I$ROOT_DIR/net_port -I$ROOT_DIR/i2c_smbus -I$BENCHMARK_DIR"
+
+#-----------------------------------------------------------------------#
+# Sources needed by the SDK server and client, with only the debug      #
+# device detector                                                       #
+#-----------------------------------------------------------------------#
+CORE_SOURCES="
+    ResourceManager.cpp
+    ProfileManager.cpp
+    EffectsEngine.cpp
+    NetworkServer.cpp
+    NetworkClient.cpp
+    NetworkProtocol.cpp
+    NetworkSharedMemory.cpp
+    RGBController/DebugControllerDetect.cpp
+    RGBController/RGBController.cpp
+    RGBController/RGBControllerStats.cpp
+    RGBController/RGBColorTransform.cpp
+    RGBController/RGBController_Dummy.cpp
+    RGBController/RGBController_Network.cpp
+    RGBController/RGBDescriptionCodec.cpp
+    RGBController/RGBOutputStage.cpp
+    net_port/net_port.cpp
+"
+
+LIBS="-lpthread -lrt -lstdc++fs"
+
+mkdir -p "$BUILD_DIR"
+
+#-----------------------------------------------------------------------#
+# Build the core sources once and link every benchmark against them     #
+#-----------------------------------------------------------------------#
+CORE_OBJECTS=""
+
+for SOURCE in $CORE_SOURCES; do
+    OBJECT="$BUILD_DIR/$(echo "$SOURCE" | tr '/' '_' | sed 's/\.cpp$/.o/')"
+
+    $CXX -std=c++17 $CXXFLAGS $INCLUDES -c "$ROOT_DIR/$SOURCE" -o "$OBJECT"
+
+    CORE_OBJECTS="$CORE_OBJECTS $OBJECT"
+done
+
+if [ $# -eq 0 ]; then
+    set -- $(cd "$BENCHMARK_DIR" && ls *.cpp | sed 's/\.cpp$//')
+fi
+
+for BENCHMARK in "$@"; do
+    echo "Building $BENCHMARK"
+    $CXX -std=c++17 $CXXFLAGS $INCLUDES "$BENCHMARK_DIR/$BENCHMARK.cpp" $CORE_OBJECTS $LIBS -o "$BUILD_DIR/$BENCHMARK"
+done
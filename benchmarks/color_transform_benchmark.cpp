@@ -0,0 +1,166 @@
+/*-----------------------------------------*\
+|  color_transform_benchmark.cpp            |
+|                                           |
+|  Time per LED of the RGBColorTransform    |
+|  routines against the per-LED loops the   |
+|  drivers used before them                 |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "BenchmarkDevices.h"
+#include "RGBColorTransform.h"
+
+#define BENCHMARK_MIN_MS        50.0
+#define BENCHMARK_RUNS          7
+
+typedef void (*BenchmarkFunction)(const RGBColor* colors, std::size_t count, unsigned char* out);
+
+static unsigned char lut[256];
+
+/*---------------------------------------------------------*\
+| The loops drivers wrote by hand, one color at a time      |
+\*---------------------------------------------------------*/
+static void LoopBytesGRB(const RGBColor* colors, std::size_t count, unsigned char* out)
+{
+    for(std::size_t idx = 0; idx < count; idx++)
+    {
+        out[(idx * 3) + 0] = RGBGetGValue(colors[idx]);
+        out[(idx * 3) + 1] = RGBGetRValue(colors[idx]);
+        out[(idx * 3) + 2] = RGBGetBValue(colors[idx]);
+    }
+}
+
+static void LoopPlanar(const RGBColor* colors, std::size_t count, unsigned char* out)
+{
+    for(std::size_t idx = 0; idx < count; idx++)
+    {
+        out[idx]                = RGBGetRValue(colors[idx]);
+        out[count + idx]        = RGBGetGValue(colors[idx]);
+        out[(count * 2) + idx]  = RGBGetBValue(colors[idx]);
+    }
+}
+
+static void LoopScale(const RGBColor* colors, std::size_t count, unsigned char* out)
+{
+    RGBColor* scaled = (RGBColor*)out;
+
+    for(std::size_t idx = 0; idx < count; idx++)
+    {
+        unsigned int red = ((RGBGetRValue(colors[idx]) * 200) + 255) / 510;
+        unsigned int grn = ((RGBGetGValue(colors[idx]) * 200) + 255) / 510;
+        unsigned int blu = ((RGBGetBValue(colors[idx]) * 200) + 255) / 510;
+
+        scaled[idx] = ToRGBColor(red, grn, blu);
+    }
+}
+
+static void LoopLUT(const RGBColor* colors, std::size_t count, unsigned char* out)
+{
+    RGBColor* mapped = (RGBColor*)out;
+
+    for(std::size_t idx = 0; idx < count; idx++)
+    {
+        mapped[idx] = ToRGBColor((unsigned int)lut[RGBGetRValue(colors[idx])], (unsigned int)lut[RGBGetGValue(colors[idx])], (unsigned int)lut[RGBGetBValue(colors[idx])]);
+    }
+}
+
+static void TransformBytesGRB(const RGBColor* colors, std::size_t count, unsigned char* out)
+{
+    RGBColorsToBytes(colors, count, out, RGB_ORDER_GRB);
+}
+
+static void TransformPlanar(const RGBColor* colors, std::size_t count, unsigned char* out)
+{
+    RGBColorsToPlanar(colors, count, out, out + count, out + (count * 2));
+}
+
+static void TransformScale(const RGBColor* colors, std::size_t count, unsigned char* out)
+{
+    RGBColorsScale(colors, count, (RGBColor*)out, 100);
+}
+
+static void TransformLUT(const RGBColor* colors, std::size_t count, unsigned char* out)
+{
+    RGBColorsApplyLUT(colors, count, (RGBColor*)out, lut, lut, lut);
+}
+
+/*---------------------------------------------------------*\
+| Median nanoseconds per LED over BENCHMARK_RUNS runs, each |
+| repeating the call for at least BENCHMARK_MIN_MS          |
+\*---------------------------------------------------------*/
+static double NsPerLED(BenchmarkFunction function, std::vector<RGBColor>& colors, std::vector<unsigned char>& out)
+{
+    std::vector<double> samples;
+
+    for(unsigned int run_idx = 0; run_idx < BENCHMARK_RUNS; run_idx++)
+    {
+        unsigned long long                      calls   = 0;
+        std::chrono::steady_clock::time_point   start   = std::chrono::steady_clock::now();
+        double                                  elapsed = 0.0;
+
+        while(elapsed < BENCHMARK_MIN_MS)
+        {
+            for(unsigned int call_idx = 0; call_idx < 64; call_idx++)
+            {
+                function(colors.data(), colors.size(), out.data());
+
+                /*---------------------------------------------------------*\
+                | Keep the compiler from dropping calls whose output is     |
+                | never read                                                |
+                \*---------------------------------------------------------*/
+                asm volatile("" : : "r"(out.data()) : "memory");
+            }
+
+            calls  += 64;
+            elapsed = ElapsedMs(start, std::chrono::steady_clock::now());
+        }
+
+        samples.push_back((elapsed * 1000000.0) / (calls * colors.size()));
+    }
+
+    return(Percentile(samples, 50.0));
+}
+
+int main()
+{
+    const char*         names[4]        = { "bytes GRB", "planar", "scale", "lut" };
+    BenchmarkFunction   loops[4]        = { LoopBytesGRB, LoopPlanar, LoopScale, LoopLUT };
+    BenchmarkFunction   transforms[4]   = { TransformBytesGRB, TransformPlanar, TransformScale, TransformLUT };
+
+    /*---------------------------------------------------------*\
+    | A small strip, one E1.31 universe, a keyboard sized       |
+    | buffer and a large matrix                                 |
+    \*---------------------------------------------------------*/
+    std::size_t         counts[4]       = { 60, 170, 300, 4096 };
+
+    for(unsigned int value = 0; value < 256; value++)
+    {
+        lut[value] = (unsigned char)(255 - value);
+    }
+
+    printf("%-10s  %6s  %10s  %10s  %8s\n", "routine", "leds", "loop ns", "transform", "speedup");
+
+    for(unsigned int routine_idx = 0; routine_idx < 4; routine_idx++)
+    {
+        for(std::size_t count : counts)
+        {
+            std::vector<RGBColor>       colors(count);
+            std::vector<unsigned char>  out(count * sizeof(RGBColor));
+
+            for(std::size_t idx = 0; idx < count; idx++)
+            {
+                colors[idx] = ToRGBColor((idx * 7) & 0xFF, (idx * 13) & 0xFF, (idx * 29) & 0xFF);
+            }
+
+            double loop_ns      = NsPerLED(loops[routine_idx], colors, out);
+            double transform_ns = NsPerLED(transforms[routine_idx], colors, out);
+
+            printf("%-10s  %6zu  %10.3f  %10.3f  %7.1fx\n", names[routine_idx], count, loop_ns, transform_ns, loop_ns / transform_ns);
+        }
+    }
+
+    printf("\nNanoseconds per LED, median of %d runs\n", BENCHMARK_RUNS);
+
+    return(0);
+}
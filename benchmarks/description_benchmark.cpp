@@ -0,0 +1,171 @@
+/*-----------------------------------------*\
+|  description_benchmark.cpp                |
+|                                           |
+|  Size and parse time of the legacy and    |
+|  compact controller descriptions          |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "BenchmarkDevices.h"
+
+#include <cstring>
+
+#define BENCHMARK_MIN_MS        200.0
+#define BENCHMARK_MAX_PARSES    10000
+
+/*---------------------------------------------------------*\
+| A matrix named the way RGBController_E131 names its zones |
+| and LEDs                                                  |
+\*---------------------------------------------------------*/
+static RGBController_Dummy* CreateE131Matrix(unsigned int height, unsigned int width)
+{
+    RGBController_Dummy* dummy = new RGBController_Dummy();
+
+    dummy->name         = "E1.31 Streaming ACN Device";
+    dummy->type         = DEVICE_TYPE_LEDSTRIP;
+    dummy->description  = "E1.31 Streaming ACN Device";
+    dummy->location     = "E1.31 Universe 1";
+
+    mode direct_mode = {};
+
+    direct_mode.name        = "Direct";
+    direct_mode.flags       = MODE_FLAG_HAS_PER_LED_COLOR;
+    direct_mode.color_mode  = MODE_COLORS_PER_LED;
+
+    dummy->modes.push_back(direct_mode);
+
+    zone matrix_zone = {};
+
+    matrix_zone.name        = "Matrix";
+    matrix_zone.type        = ZONE_TYPE_MATRIX;
+    matrix_zone.leds_min    = height * width;
+    matrix_zone.leds_max    = height * width;
+    matrix_zone.leds_count  = height * width;
+    matrix_zone.matrix_map  = dummy->NewMatrixMap(height, width);
+
+    for(unsigned int led_idx = 0; led_idx < (height * width); led_idx++)
+    {
+        matrix_zone.matrix_map->map[led_idx] = led_idx;
+    }
+
+    dummy->zones.push_back(matrix_zone);
+
+    for(unsigned int led_idx = 0; led_idx < (height * width); led_idx++)
+    {
+        led new_led = {};
+
+        new_led.name = matrix_zone.name + " LED ";
+        new_led.name.append(std::to_string(led_idx));
+
+        dummy->leds.push_back(new_led);
+    }
+
+    dummy->SetupColors();
+
+    return(dummy);
+}
+
+static unsigned int DescriptionSize(unsigned char* description)
+{
+    unsigned int description_size;
+
+    memcpy(&description_size, description, sizeof(description_size));
+
+    return(description_size);
+}
+
+/*---------------------------------------------------------*\
+| Median time in microseconds to read the description into  |
+| one controller, repeated for at least BENCHMARK_MIN_MS    |
+\*---------------------------------------------------------*/
+static double ParseUs(RGBController* target, unsigned char* description)
+{
+    unsigned int        description_size    = DescriptionSize(description);
+    std::vector<double> samples;
+    double              total_ms            = 0.0;
+
+    while((total_ms < BENCHMARK_MIN_MS) && (samples.size() < BENCHMARK_MAX_PARSES))
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        if(!target->ReadDeviceDescription(description, description_size))
+        {
+            return(-1.0);
+        }
+
+        double elapsed = ElapsedMs(start, std::chrono::steady_clock::now());
+
+        samples.push_back(elapsed * 1000.0);
+        total_ms += elapsed;
+    }
+
+    return(Percentile(samples, 50.0));
+}
+
+int main()
+{
+    std::vector<RGBController*> devices     = CreateDebugDevices({ "debug_keyboard" });
+    std::vector<std::string>    device_names;
+
+    if(devices.size() != 1)
+    {
+        printf("Could not create the debug keyboard\n");
+        return(1);
+    }
+
+    device_names.push_back("debug keyboard");
+
+    devices.push_back(CreateE131Matrix(32, 32));
+    device_names.push_back("e131 32x32");
+
+    /*---------------------------------------------------------*\
+    | The legacy format stores a matrix map's byte size in 16   |
+    | bits, which limits maps to 16382 LEDs                     |
+    \*---------------------------------------------------------*/
+    devices.push_back(CreateE131Matrix(120, 120));
+    device_names.push_back("e131 120x120");
+
+    RGBController_Dummy* target = new RGBController_Dummy();
+
+    printf("%-14s  %6s  %12s  %12s  %6s  %12s  %12s\n", "device", "leds", "legacy bytes", "compact", "ratio", "legacy us", "compact us");
+
+    for(std::size_t device_idx = 0; device_idx < devices.size(); device_idx++)
+    {
+        unsigned char*  legacy          = devices[device_idx]->GetDeviceDescription();
+        unsigned char*  compact         = devices[device_idx]->GetDeviceDescriptionCompact();
+        unsigned int    legacy_size     = DescriptionSize(legacy);
+        unsigned int    compact_size    = DescriptionSize(compact);
+        double          legacy_us       = ParseUs(target, legacy);
+        double          compact_us      = ParseUs(target, compact);
+
+        if((legacy_us < 0.0) || (compact_us < 0.0))
+        {
+            printf("Could not read the %s description\n", device_names[device_idx].c_str());
+            return(1);
+        }
+
+        printf("%-14s  %6zu  %12u  %12u  %5.1fx  %12.1f  %12.1f\n",
+               device_names[device_idx].c_str(),
+               devices[device_idx]->leds.size(),
+               legacy_size,
+               compact_size,
+               (double)legacy_size / compact_size,
+               legacy_us,
+               compact_us);
+
+        delete[] legacy;
+        delete[] compact;
+    }
+
+    printf("\nParse times are the median of repeated reads into one controller\n");
+
+    delete target;
+
+    for(RGBController* device : devices)
+    {
+        delete device;
+    }
+
+    return(0);
+}
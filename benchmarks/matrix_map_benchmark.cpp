@@ -0,0 +1,221 @@
+/*-----------------------------------------*\
+|  matrix_map_benchmark.cpp                 |
+|                                           |
+|  Matrix map allocation from the           |
+|  controller arena against one heap        |
+|  allocation per map, and the client-side  |
+|  cost of debug keyboard descriptions      |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "BenchmarkDevices.h"
+
+#include <cstring>
+
+#define BENCHMARK_CONTROLLERS   200
+#define BENCHMARK_MAPS          20000
+#define BENCHMARK_WALKS         20
+#define BENCHMARK_RUNS          5
+
+/*---------------------------------------------------------*\
+| Map shape of the debug keyboard                           |
+\*---------------------------------------------------------*/
+#define MAP_HEIGHT              6
+#define MAP_WIDTH               23
+
+static unsigned int WalkMaps(std::vector<matrix_map_type*>& maps)
+{
+    unsigned int sum = 0;
+
+    for(unsigned int walk_idx = 0; walk_idx < BENCHMARK_WALKS; walk_idx++)
+    {
+        for(matrix_map_type* map : maps)
+        {
+            for(unsigned int cell_idx = 0; cell_idx < (map->height * map->width); cell_idx++)
+            {
+                sum += map->map[cell_idx];
+            }
+        }
+    }
+
+    return(sum);
+}
+
+/*---------------------------------------------------------*\
+| Maps from one controller's arena, freed with it           |
+\*---------------------------------------------------------*/
+static void RunArena(double& alloc_ms, double& walk_ms, double& free_ms)
+{
+    RGBController_Dummy*            controller = new RGBController_Dummy();
+    std::vector<matrix_map_type*>   maps;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for(unsigned int map_idx = 0; map_idx < BENCHMARK_MAPS; map_idx++)
+    {
+        maps.push_back(controller->NewMatrixMap(MAP_HEIGHT, MAP_WIDTH));
+    }
+
+    std::chrono::steady_clock::time_point allocated = std::chrono::steady_clock::now();
+
+    volatile unsigned int sum = WalkMaps(maps);
+    (void)sum;
+
+    std::chrono::steady_clock::time_point walked = std::chrono::steady_clock::now();
+
+    delete controller;
+
+    std::chrono::steady_clock::time_point freed = std::chrono::steady_clock::now();
+
+    alloc_ms    = ElapsedMs(start, allocated);
+    walk_ms     = ElapsedMs(allocated, walked);
+    free_ms     = ElapsedMs(walked, freed);
+}
+
+/*---------------------------------------------------------*\
+| The old layout, a header and a cell array allocated per   |
+| map, with a name allocated in between as drivers did      |
+\*---------------------------------------------------------*/
+static void RunHeap(double& alloc_ms, double& walk_ms, double& free_ms)
+{
+    std::vector<matrix_map_type*>   maps;
+    std::vector<std::string*>       names;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for(unsigned int map_idx = 0; map_idx < BENCHMARK_MAPS; map_idx++)
+    {
+        matrix_map_type* map = new matrix_map_type;
+
+        names.push_back(new std::string("Keyboard Matrix Zone " + std::to_string(map_idx)));
+
+        map->height = MAP_HEIGHT;
+        map->width  = MAP_WIDTH;
+        map->map    = new unsigned int[MAP_HEIGHT * MAP_WIDTH];
+
+        memset(map->map, 0xFF, MAP_HEIGHT * MAP_WIDTH * sizeof(unsigned int));
+
+        maps.push_back(map);
+    }
+
+    std::chrono::steady_clock::time_point allocated = std::chrono::steady_clock::now();
+
+    volatile unsigned int sum = WalkMaps(maps);
+    (void)sum;
+
+    std::chrono::steady_clock::time_point walked = std::chrono::steady_clock::now();
+
+    for(std::size_t map_idx = 0; map_idx < maps.size(); map_idx++)
+    {
+        delete[] maps[map_idx]->map;
+        delete maps[map_idx];
+        delete names[map_idx];
+    }
+
+    std::chrono::steady_clock::time_point freed = std::chrono::steady_clock::now();
+
+    alloc_ms    = ElapsedMs(start, allocated);
+    walk_ms     = ElapsedMs(allocated, walked);
+    free_ms     = ElapsedMs(walked, freed);
+}
+
+/*---------------------------------------------------------*\
+| Read the debug keyboard's description into new            |
+| controllers as a client does on connect, then free them   |
+\*---------------------------------------------------------*/
+static void RunKeyboards(unsigned char* description, unsigned int description_size, double& read_ms, double& free_ms)
+{
+    std::vector<RGBController_Dummy*> controllers;
+
+    for(unsigned int controller_idx = 0; controller_idx < BENCHMARK_CONTROLLERS; controller_idx++)
+    {
+        controllers.push_back(new RGBController_Dummy());
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for(RGBController_Dummy* controller : controllers)
+    {
+        controller->ReadDeviceDescription(description, description_size);
+    }
+
+    std::chrono::steady_clock::time_point read = std::chrono::steady_clock::now();
+
+    /*---------------------------------------------------------*\
+    | Stop the device threads first so only the controller and  |
+    | arena teardown is timed                                   |
+    \*---------------------------------------------------------*/
+    for(RGBController_Dummy* controller : controllers)
+    {
+        controller->StopDeviceThread();
+    }
+
+    std::chrono::steady_clock::time_point stopped = std::chrono::steady_clock::now();
+
+    for(RGBController_Dummy* controller : controllers)
+    {
+        delete controller;
+    }
+
+    std::chrono::steady_clock::time_point freed = std::chrono::steady_clock::now();
+
+    read_ms = ElapsedMs(start, read);
+    free_ms = ElapsedMs(stopped, freed);
+}
+
+int main()
+{
+    std::vector<RGBController*> keyboards = CreateDebugDevices({ "debug_keyboard" });
+
+    if(keyboards.size() != 1)
+    {
+        printf("Could not create the debug keyboard\n");
+        return(1);
+    }
+
+    unsigned char*  description = keyboards[0]->GetDeviceDescription();
+    unsigned int    description_size;
+
+    memcpy(&description_size, description, sizeof(description_size));
+
+    std::vector<double> arena_alloc, arena_walk, arena_free;
+    std::vector<double> heap_alloc, heap_walk, heap_free;
+    std::vector<double> keyboard_read, keyboard_free;
+
+    for(unsigned int run_idx = 0; run_idx < BENCHMARK_RUNS; run_idx++)
+    {
+        double alloc_ms, walk_ms, free_ms;
+
+        RunArena(alloc_ms, walk_ms, free_ms);
+
+        arena_alloc.push_back(alloc_ms);
+        arena_walk.push_back(walk_ms);
+        arena_free.push_back(free_ms);
+
+        RunHeap(alloc_ms, walk_ms, free_ms);
+
+        heap_alloc.push_back(alloc_ms);
+        heap_walk.push_back(walk_ms);
+        heap_free.push_back(free_ms);
+
+        RunKeyboards(description, description_size, alloc_ms, free_ms);
+
+        keyboard_read.push_back(alloc_ms);
+        keyboard_free.push_back(free_ms);
+    }
+
+    printf("%d maps of %dx%d, %d walks, median of %d runs\n\n", BENCHMARK_MAPS, MAP_HEIGHT, MAP_WIDTH, BENCHMARK_WALKS, BENCHMARK_RUNS);
+    printf("%-8s  %10s  %10s  %10s\n", "layout", "alloc ms", "walk ms", "free ms");
+    printf("%-8s  %10.3f  %10.3f  %10.3f\n", "arena", Percentile(arena_alloc, 50.0), Percentile(arena_walk, 50.0), Percentile(arena_free, 50.0));
+    printf("%-8s  %10.3f  %10.3f  %10.3f\n", "heap", Percentile(heap_alloc, 50.0), Percentile(heap_walk, 50.0), Percentile(heap_free, 50.0));
+
+    printf("\n%d debug keyboards read from a %u byte description\n\n", BENCHMARK_CONTROLLERS, description_size);
+    printf("%12s  %12s\n", "read us/dev", "free us/dev");
+    printf("%12.2f  %12.2f\n", Percentile(keyboard_read, 50.0) * 1000.0 / BENCHMARK_CONTROLLERS, Percentile(keyboard_free, 50.0) * 1000.0 / BENCHMARK_CONTROLLERS);
+
+    delete[] description;
+    delete keyboards[0];
+
+    return(0);
+}
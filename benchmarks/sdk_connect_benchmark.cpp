@@ -0,0 +1,129 @@
+/*-----------------------------------------*\
+|  sdk_connect_benchmark.cpp                |
+|                                           |
+|  Localhost SDK time-to-ready against the  |
+|  number of devices on the server          |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "BenchmarkDevices.h"
+#include "NetworkClient.h"
+#include "NetworkServer.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+#define BENCHMARK_PORT      16842
+#define BENCHMARK_LEDS      60
+#define BENCHMARK_RUNS      5
+
+/*---------------------------------------------------------*\
+| Connect a new client and return the time from StartClient |
+| until it has every controller, or a negative time if it   |
+| doesn't get there within ten seconds                      |
+\*---------------------------------------------------------*/
+static double ConnectOnce(unsigned short port)
+{
+    std::vector<RGBController*>* client_controllers = new std::vector<RGBController*>();
+    NetworkClient*               client             = new NetworkClient(*client_controllers);
+
+    client->SetIP("127.0.0.1");
+    client->SetPort(port);
+    client->SetName("Connect Benchmark");
+
+    std::chrono::steady_clock::time_point start     = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point deadline  = start + 10s;
+
+    client->StartClient();
+
+    while(!client->GetOnline() && (std::chrono::steady_clock::now() < deadline))
+    {
+        std::this_thread::sleep_for(100us);
+    }
+
+    double elapsed = ElapsedMs(start, std::chrono::steady_clock::now());
+    bool   online  = client->GetOnline();
+
+    /*---------------------------------------------------------*\
+    | Disconnect so the next run doesn't share the machine with |
+    | this client's device threads                              |
+    \*---------------------------------------------------------*/
+    client->StopClient();
+
+    delete client;
+    delete client_controllers;
+
+    return(online ? elapsed : -1.0);
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned short              port = (argc > 1) ? (unsigned short)atoi(argv[1]) : BENCHMARK_PORT;
+    std::vector<RGBController*> server_controllers;
+    std::mutex                  server_controllers_mutex;
+    NetworkServer               server(server_controllers, server_controllers_mutex);
+
+    server.SetPort(port);
+    server.StartServer();
+
+    if(!server.GetOnline())
+    {
+        printf("Could not start the server on port %hu\n", port);
+        return(1);
+    }
+
+    const unsigned int  device_counts[]     = { 1, 10, 50, 100, 200 };
+    std::vector<double> results;
+
+    for(unsigned int device_count : device_counts)
+    {
+        server_controllers_mutex.lock();
+
+        while(server_controllers.size() < device_count)
+        {
+            server_controllers.push_back(CreateBenchmarkDevice((unsigned int)server_controllers.size(), BENCHMARK_LEDS));
+        }
+
+        server_controllers_mutex.unlock();
+
+        std::vector<double> samples;
+
+        for(unsigned int run_idx = 0; run_idx < BENCHMARK_RUNS; run_idx++)
+        {
+            double elapsed = ConnectOnce(port);
+
+            if(elapsed < 0.0)
+            {
+                printf("Client did not come online with %u devices\n", device_count);
+                return(1);
+            }
+
+            samples.push_back(elapsed);
+        }
+
+        results.push_back(Percentile(samples, 50.0));
+    }
+
+    /*---------------------------------------------------------*\
+    | The client logs its own progress, so the table is printed |
+    | once at the end                                           |
+    \*---------------------------------------------------------*/
+    printf("\n%8s  %16s\n", "devices", "time-to-ready ms");
+
+    for(std::size_t count_idx = 0; count_idx < results.size(); count_idx++)
+    {
+        printf("%8u  %16.1f\n", device_counts[count_idx], results[count_idx]);
+    }
+
+    printf("\nMedian of %d connects, %d LEDs per device\n", BENCHMARK_RUNS, BENCHMARK_LEDS);
+
+    server.StopServer();
+
+    return(0);
+}
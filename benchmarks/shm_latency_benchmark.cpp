@@ -0,0 +1,103 @@
+/*-----------------------------------------*\
+|  shm_latency_benchmark.cpp                |
+|                                           |
+|  Same-host SDK latency over the shared    |
+|  memory transport against TCP loopback    |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "BenchmarkLatency.h"
+
+#include <cstdlib>
+
+#define BENCHMARK_PORT      16843
+#define BENCHMARK_DEVICES   100
+#define BENCHMARK_LEDS      60
+#define BENCHMARK_FPS       144.0
+#define BENCHMARK_MS        5000
+
+/*---------------------------------------------------------*\
+| Stream to every device through one client connected to ip |
+\*---------------------------------------------------------*/
+static bool RunTransport(LatencyRecorder& recorder, const char* ip, unsigned short port, LatencyResult& result)
+{
+    std::vector<RGBController*> client_controllers;
+    NetworkClient*              client = ConnectBenchmarkClient(client_controllers, ip, port, false);
+
+    if(client == NULL)
+    {
+        printf("Client did not come online on %s\n", ip);
+        return(false);
+    }
+
+    recorder.Reset();
+
+    StreamLatencyFrames(recorder, client_controllers, BENCHMARK_FPS, std::chrono::milliseconds(BENCHMARK_MS));
+
+    result = GetLatencyResult(recorder);
+
+    client->StopClient();
+    delete client;
+
+    return(true);
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned short              port = (argc > 1) ? (unsigned short)atoi(argv[1]) : BENCHMARK_PORT;
+    LatencyRecorder*            recorder = new LatencyRecorder();
+    std::vector<RGBController*> server_controllers;
+    std::mutex                  server_controllers_mutex;
+    NetworkServer               server(server_controllers, server_controllers_mutex);
+
+    for(unsigned int device_idx = 0; device_idx < BENCHMARK_DEVICES; device_idx++)
+    {
+        server_controllers.push_back(new LatencyDevice(recorder, device_idx, BENCHMARK_LEDS));
+    }
+
+    server.SetPort(port);
+    server.StartServer();
+
+    if(!server.GetOnline())
+    {
+        printf("Could not start the server on port %hu\n", port);
+        return(1);
+    }
+
+    if(!NetworkSharedMemory::IsSupported())
+    {
+        printf("Shared memory is not supported on this platform\n");
+    }
+
+    LatencyResult   shm_result;
+    LatencyResult   tcp_result;
+    bool            ok = RunTransport(*recorder, "127.0.0.1", port, shm_result)
+                      && RunTransport(*recorder, "127.0.0.2", port, tcp_result);
+
+    server.StopServer();
+
+    /*---------------------------------------------------------*\
+    | The client logs its own progress, so the table is printed |
+    | once at the end                                           |
+    \*---------------------------------------------------------*/
+    if(ok)
+    {
+        printf("\n");
+
+        PrintLatencyHeader();
+        PrintLatencyResult("shared memory", shm_result);
+        PrintLatencyResult("tcp loopback", tcp_result);
+
+        printf("\n%d devices, %d LEDs each, %.0f FPS for %d ms\n", BENCHMARK_DEVICES, BENCHMARK_LEDS, BENCHMARK_FPS, BENCHMARK_MS);
+    }
+
+    for(RGBController* controller : server_controllers)
+    {
+        delete controller;
+    }
+
+    delete recorder;
+
+    return(ok ? 0 : 1);
+}
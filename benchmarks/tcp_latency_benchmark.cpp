@@ -0,0 +1,115 @@
+/*-----------------------------------------*\
+|  tcp_latency_benchmark.cpp                |
+|                                           |
+|  Loopback SDK latency percentiles over    |
+|  TCP for small, frequent LED updates      |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "BenchmarkLatency.h"
+
+#include <cstdlib>
+#include <string>
+
+#define BENCHMARK_PORT          16845
+#define BENCHMARK_MAX_DEVICES   50
+#define BENCHMARK_LEDS          12
+#define BENCHMARK_FPS           144.0
+#define BENCHMARK_MS            5000
+
+/*---------------------------------------------------------*\
+| Stream to the first num_devices devices through one TCP   |
+| client.  127.0.0.2 keeps the client off the shared memory |
+| transport                                                 |
+\*---------------------------------------------------------*/
+static bool RunDevices(LatencyRecorder& recorder, unsigned int num_devices, unsigned short port, LatencyResult& result)
+{
+    std::vector<RGBController*> client_controllers;
+    NetworkClient*              client = ConnectBenchmarkClient(client_controllers, "127.0.0.2", port, false);
+
+    if(client == NULL)
+    {
+        printf("Client did not come online\n");
+        return(false);
+    }
+
+    std::vector<RGBController*> devices(client_controllers.begin(), client_controllers.begin() + num_devices);
+
+    recorder.Reset();
+
+    StreamLatencyFrames(recorder, devices, BENCHMARK_FPS, std::chrono::milliseconds(BENCHMARK_MS));
+
+    result = GetLatencyResult(recorder);
+
+    client->StopClient();
+    delete client;
+
+    return(true);
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned short              port = (argc > 1) ? (unsigned short)atoi(argv[1]) : BENCHMARK_PORT;
+    LatencyRecorder*            recorder = new LatencyRecorder();
+    std::vector<RGBController*> server_controllers;
+    std::mutex                  server_controllers_mutex;
+    NetworkServer               server(server_controllers, server_controllers_mutex);
+    const unsigned int          device_counts[] = { 1, 10, BENCHMARK_MAX_DEVICES };
+
+    for(unsigned int device_idx = 0; device_idx < BENCHMARK_MAX_DEVICES; device_idx++)
+    {
+        server_controllers.push_back(new LatencyDevice(recorder, device_idx, BENCHMARK_LEDS));
+    }
+
+    server.SetPort(port);
+    server.StartServer();
+
+    if(!server.GetOnline())
+    {
+        printf("Could not start the server on port %hu\n", port);
+        return(1);
+    }
+
+    std::vector<LatencyResult>  results;
+    bool                        ok = true;
+
+    for(unsigned int num_devices : device_counts)
+    {
+        LatencyResult result;
+
+        ok = ok && RunDevices(*recorder, num_devices, port, result);
+
+        results.push_back(result);
+    }
+
+    server.StopServer();
+
+    /*---------------------------------------------------------*\
+    | The client logs its own progress, so the table is printed |
+    | once at the end                                           |
+    \*---------------------------------------------------------*/
+    if(ok)
+    {
+        printf("\n");
+
+        PrintLatencyHeader();
+        for(std::size_t count_idx = 0; count_idx < results.size(); count_idx++)
+        {
+            std::string transport = "tcp " + std::to_string(device_counts[count_idx]) + " devices";
+
+            PrintLatencyResult(transport.c_str(), results[count_idx]);
+        }
+
+        printf("\n%d LEDs per device, %.0f FPS for %d ms\n", BENCHMARK_LEDS, BENCHMARK_FPS, BENCHMARK_MS);
+    }
+
+    for(RGBController* controller : server_controllers)
+    {
+        delete controller;
+    }
+
+    delete recorder;
+
+    return(ok ? 0 : 1);
+}
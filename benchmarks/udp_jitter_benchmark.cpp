@@ -0,0 +1,101 @@
+/*-----------------------------------------*\
+|  udp_jitter_benchmark.cpp                 |
+|                                           |
+|  Loopback SDK latency and jitter over the |
+|  UDP color stream against TCP             |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "BenchmarkLatency.h"
+
+#include <cstdlib>
+
+#define BENCHMARK_PORT      16844
+#define BENCHMARK_DEVICES   10
+#define BENCHMARK_LEDS      60
+#define BENCHMARK_FPS       144.0
+#define BENCHMARK_MS        5000
+
+/*---------------------------------------------------------*\
+| Stream to every device through one client, over UDP if    |
+| stream is set.  127.0.0.2 keeps the client off the shared |
+| memory transport                                          |
+\*---------------------------------------------------------*/
+static bool RunTransport(LatencyRecorder& recorder, bool stream, unsigned short port, LatencyResult& result)
+{
+    std::vector<RGBController*> client_controllers;
+    NetworkClient*              client = ConnectBenchmarkClient(client_controllers, "127.0.0.2", port, stream);
+
+    if(client == NULL)
+    {
+        printf("Client did not come online\n");
+        return(false);
+    }
+
+    recorder.Reset();
+
+    StreamLatencyFrames(recorder, client_controllers, BENCHMARK_FPS, std::chrono::milliseconds(BENCHMARK_MS));
+
+    result = GetLatencyResult(recorder);
+
+    client->StopClient();
+    delete client;
+
+    return(true);
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned short              port = (argc > 1) ? (unsigned short)atoi(argv[1]) : BENCHMARK_PORT;
+    LatencyRecorder*            recorder = new LatencyRecorder();
+    std::vector<RGBController*> server_controllers;
+    std::mutex                  server_controllers_mutex;
+    NetworkServer               server(server_controllers, server_controllers_mutex);
+
+    for(unsigned int device_idx = 0; device_idx < BENCHMARK_DEVICES; device_idx++)
+    {
+        server_controllers.push_back(new LatencyDevice(recorder, device_idx, BENCHMARK_LEDS));
+    }
+
+    server.SetPort(port);
+    server.StartServer();
+
+    if(!server.GetOnline())
+    {
+        printf("Could not start the server on port %hu\n", port);
+        return(1);
+    }
+
+    LatencyResult   tcp_result;
+    LatencyResult   udp_result;
+    bool            ok = RunTransport(*recorder, false, port, tcp_result)
+                      && RunTransport(*recorder, true, port, udp_result);
+
+    server.StopServer();
+
+    /*---------------------------------------------------------*\
+    | The client logs its own progress, so the table is printed |
+    | once at the end                                           |
+    \*---------------------------------------------------------*/
+    if(ok)
+    {
+        printf("\n");
+
+        PrintLatencyHeader();
+        PrintLatencyResult("tcp", tcp_result);
+        PrintLatencyResult("udp stream", udp_result);
+
+        printf("\n%d devices, %d LEDs each, %.0f FPS for %d ms.  Jitter is the\n", BENCHMARK_DEVICES, BENCHMARK_LEDS, BENCHMARK_FPS, BENCHMARK_MS);
+        printf("stddev and the p99 to p50 spread, datagrams may be dropped\n");
+    }
+
+    for(RGBController* controller : server_controllers)
+    {
+        delete controller;
+    }
+
+    delete recorder;
+
+    return(ok ? 0 : 1);
+}
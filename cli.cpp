@@ -3,14 +3,23 @@
 #include <string>
 #include <tuple>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
 #include "OpenRGB.h"
 #include "ProfileManager.h"
 #include "ResourceManager.h"
 #include "RGBController.h"
+#include "RGBController_Network.h"
 #include "i2c_smbus.h"
 #include "NetworkClient.h"
 #include "NetworkServer.h"
 
+#ifdef HIDAPI_MOCK
+#include "hidapi_mock.h"
+#endif
+
 /*-------------------------------------------------------------*\
 | Quirk for MSVC; which doesn't support this case-insensitive   |
 | function                                                      |
@@ -49,6 +58,12 @@ struct ServerOptions
     unsigned short  port = OPENRGB_SDK_PORT;
 };
 
+struct ParallelOptions
+{
+    bool            enabled     = false;
+    unsigned int    timeout_ms  = 5000;
+};
+
 struct Options
 {
     std::vector<DeviceOptions> devices;
@@ -60,6 +75,7 @@ struct Options
     bool hasDevice;
     DeviceOptions allDeviceOptions;
     ServerOptions servOpts;
+    ParallelOptions parallelOpts;
 };
 
 
@@ -367,11 +383,19 @@ void OptionHelp()
     help_text += "                                           Must be specified after specifying a zone.\n";
     help_text += "                                           If the specified size is out of range, or the zone does not offer resizing capability, the size will not be changed\n";
     help_text += "-v,  --version                           Display version and software build information\n";
+    help_text += "--stats                                  Lists update timing statistics for every device. Use with --client to query a running server\n";
+    help_text += "--parallel [timeout_ms]                  Applies settings to all devices concurrently and reports the time taken per device\n";
+    help_text += "                                           Devices sharing an SMBus or HID handle are still updated one at a time (default timeout 5000)\n";
+    help_text += "--brightness [0-100]                     Scales the output of every device in per-LED mode, in percent\n";
     help_text += "-p,  --profile filename.orp              Load the profile from filename.orp\n";
     help_text += "-sp, --save-profile filename.orp         Save the given settings to profile filename.orp\n";
     help_text += "--i2c-tools                              Shows the I2C/SMBus Tools page in the GUI. Implies --gui, even if not specified.\n";
     help_text += "                                           USE I2C TOOLS AT YOUR OWN RISK! Don't use this option if you don't know what you're doing!\n";
     help_text += "                                           There is a risk of bricking your motherboard, RGB controller, and RAM if you send invalid SMBus/I2C transactions.\n";
+#ifdef HIDAPI_MOCK
+    help_text += "--hid-benchmark [frames]                 Drives every mock HID device as fast as possible and reports reports/frame and FPS (default 100 frames)\n";
+    help_text += "                                           Simulated per-report latency is set with OPENRGB_HID_MOCK_LATENCY_US (default 1000)\n";
+#endif
 
     std::cout << help_text << std::endl;
 }
@@ -500,6 +524,64 @@ void OptionListDevices(std::vector<RGBController *> &rgb_controllers)
     }
 }
 
+void OptionStats(std::vector<RGBController *> &rgb_controllers)
+{
+    ResourceManager::get()->WaitForDeviceDetection();
+
+    for(std::size_t controller_idx = 0; controller_idx < rgb_controllers.size(); controller_idx++)
+    {
+        RGBController *             controller  = rgb_controllers[controller_idx];
+        RGBControllerStatsSnapshot  stats       = controller->GetStats();
+
+        /*---------------------------------------------------------*\
+        | Print device name                                         |
+        \*---------------------------------------------------------*/
+        std::cout << controller_idx << ": " << controller->name << std::endl;
+
+        /*---------------------------------------------------------*\
+        | Print counters                                            |
+        \*---------------------------------------------------------*/
+        std::cout << "  LED updates:      " << stats.update_leds_count << std::endl;
+        std::cout << "  Mode updates:     " << stats.update_mode_count << std::endl;
+        std::cout << "  Modes unchanged:  " << stats.update_mode_skipped << std::endl;
+        std::cout << "  Frames coalesced: " << stats.frames_coalesced << std::endl;
+        std::cout << "  I/O errors:       " << stats.io_errors << std::endl;
+
+        if(stats.update_leds_count == 0)
+        {
+            std::cout << std::endl;
+            continue;
+        }
+
+        /*---------------------------------------------------------*\
+        | Print queue-to-start latency and update duration in us    |
+        \*---------------------------------------------------------*/
+        std::cout << "  Queue latency:    avg " << (stats.queue_latency_total / stats.update_leds_count)
+                  << "us, p50 <" << RGBControllerStats::GetPercentile(stats.queue_latency_hist, 0.50)
+                  << "us, p99 <" << RGBControllerStats::GetPercentile(stats.queue_latency_hist, 0.99)
+                  << "us, max " << stats.queue_latency_max << "us" << std::endl;
+
+        std::cout << "  Update duration:  avg " << (stats.update_leds_total / stats.update_leds_count)
+                  << "us, p50 <" << RGBControllerStats::GetPercentile(stats.update_leds_hist, 0.50)
+                  << "us, p99 <" << RGBControllerStats::GetPercentile(stats.update_leds_hist, 0.99)
+                  << "us, max " << stats.update_leds_max << "us" << std::endl;
+
+        /*---------------------------------------------------------*\
+        | Print commit-to-start skew for frames sent by a commit    |
+        \*---------------------------------------------------------*/
+        if(stats.commit_count > 0)
+        {
+            std::cout << "  Commit skew:      avg " << (stats.commit_skew_total / stats.commit_count)
+                      << "us, p50 <" << RGBControllerStats::GetPercentile(stats.commit_skew_hist, 0.50)
+                      << "us, p99 <" << RGBControllerStats::GetPercentile(stats.commit_skew_hist, 0.99)
+                      << "us, max " << stats.commit_skew_max << "us ("
+                      << stats.commit_count << " frames)" << std::endl;
+        }
+
+        std::cout << std::endl;
+    }
+}
+
 bool OptionDevice(int *current_device, std::string argument, Options *options, std::vector<RGBController *> &rgb_controllers)
 {
     ResourceManager::get()->WaitForDeviceDetection();
@@ -624,6 +706,23 @@ bool OptionSize(int *current_device, int *current_zone, std::string argument, Op
     return true;
 }
 
+/*---------------------------------------------------------*\
+| Wait for the device thread to finish the queued mode and  |
+| LED updates, giving up after about five seconds           |
+\*---------------------------------------------------------*/
+void WaitForDeviceUpdate(RGBController* device)
+{
+    for(int timeout = 0; timeout < 5000; timeout++)
+    {
+        if(!device->GetUpdatePending())
+        {
+            break;
+        }
+
+        std::this_thread::sleep_for(1ms);
+    }
+}
+
 bool OptionProfile(std::string argument, std::vector<RGBController *> &rgb_controllers)
 {
     ResourceManager::get()->WaitForDeviceDetection();
@@ -631,21 +730,27 @@ bool OptionProfile(std::string argument, std::vector<RGBController *> &rgb_contr
     /*---------------------------------------------------------*\
     | Attempt to load profile                                   |
     \*---------------------------------------------------------*/
-    if(profile_manager->LoadProfile(argument))
+    if(profile_manager->ActivateProfile(argument))
     {
         /*-----------------------------------------------------*\
-        | Change device mode if profile loading was successful  |
+        | The profile has been queued on every device, wait for |
+        | the devices to finish writing it                      |
         \*-----------------------------------------------------*/
-        for(std::size_t controller_idx = 0; controller_idx < rgb_controllers.size(); controller_idx++)
+        for(int timeout = 0; timeout < 5000; timeout++)
         {
-            RGBController* device = rgb_controllers[controller_idx];
+            bool pending = false;
 
-            device->SetMode(device->active_mode);
+            for(std::size_t controller_idx = 0; controller_idx < rgb_controllers.size(); controller_idx++)
+            {
+                pending = pending || rgb_controllers[controller_idx]->GetUpdatePending();
+            }
 
-            if(device->modes[device->active_mode].color_mode == MODE_COLORS_PER_LED)
+            if(!pending)
             {
-                device->DeviceUpdateLEDs();
+                break;
             }
+
+            std::this_thread::sleep_for(1ms);
         }
 
         std::cout << "Profile loaded successfully" << std::endl;
@@ -667,6 +772,102 @@ bool OptionSaveProfile(std::string argument)
     return(true);
 }
 
+#ifdef HIDAPI_MOCK
+void OptionHIDBenchmark(std::string argument, std::vector<RGBController *> &rgb_controllers)
+{
+    unsigned int    frames          = 100;
+    unsigned int    device_count    = 0;
+    double          total_seconds   = 0.0;
+
+    if(argument != "" && argument[0] != '-')
+    {
+        frames = std::stoi(argument);
+    }
+
+    if(frames == 0)
+    {
+        frames = 1;
+    }
+
+    ResourceManager::get()->WaitForDeviceDetection();
+
+    std::cout << "HID benchmark: " << frames << " frames per device, " << hid_mock_get_report_latency() << "us simulated latency per report" << std::endl;
+
+    for(std::size_t controller_idx = 0; controller_idx < rgb_controllers.size(); controller_idx++)
+    {
+        RGBController *controller = rgb_controllers[controller_idx];
+
+        /*---------------------------------------------------------*\
+        | Probe with a single frame.  Controllers that do not       |
+        | produce any mock reports are not HID devices, skip them   |
+        \*---------------------------------------------------------*/
+        hid_mock_reset_stats();
+
+        controller->UpdateLEDs();
+
+        WaitForDeviceUpdate(controller);
+
+        hid_mock_stats probe_stats = hid_mock_get_stats();
+
+        if((probe_stats.output_reports + probe_stats.feature_reports) == 0)
+        {
+            continue;
+        }
+
+        /*---------------------------------------------------------*\
+        | Drive the controller at full speed, changing the color    |
+        | every frame so that every frame carries new data.  Each   |
+        | frame goes through the device thread like a real update   |
+        | and is waited for before the next one is queued           |
+        \*---------------------------------------------------------*/
+        hid_mock_reset_stats();
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        for(unsigned int frame_idx = 0; frame_idx < frames; frame_idx++)
+        {
+            unsigned char level = (unsigned char)(frame_idx & 0xFF);
+
+            controller->SetAllLEDs(ToRGBColor(level, 255 - level, level ^ 0x80));
+            controller->UpdateLEDs();
+
+            while(controller->GetUpdatePending())
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        hid_mock_stats stats = hid_mock_get_stats();
+
+        double reports_per_frame    = (double)(stats.output_reports + stats.feature_reports) / frames;
+        double bytes_per_frame      = (double)stats.bytes_written / frames;
+        double fps                  = frames / elapsed.count();
+
+        std::cout << controller_idx << ": " << controller->name << std::endl;
+        std::cout << "  LEDs:             " << controller->leds.size() << std::endl;
+        std::cout << "  Reports/frame:    " << reports_per_frame << " (" << bytes_per_frame << " bytes)" << std::endl;
+        std::cout << "  Frame time:       " << (elapsed.count() * 1000.0 / frames) << " ms" << std::endl;
+        std::cout << "  Achievable FPS:   " << fps << std::endl;
+        std::cout << std::endl;
+
+        device_count++;
+        total_seconds += elapsed.count() / frames;
+    }
+
+    if(device_count == 0)
+    {
+        std::cout << "No mock HID devices found" << std::endl;
+    }
+    else
+    {
+        std::cout << device_count << " HID devices, " << (total_seconds * 1000.0) << " ms per frame when updated sequentially ("
+                  << (1.0 / total_seconds) << " FPS)" << std::endl;
+    }
+}
+#endif
+
 int ProcessOptions(int argc, char *argv[], Options *options, std::vector<NetworkClient*> &clients, std::vector<RGBController *> &rgb_controllers)
 {
     unsigned int ret_flags  = 0;
@@ -827,6 +1028,46 @@ int ProcessOptions(int argc, char *argv[], Options *options, std::vector<Network
             exit(0);
         }
 
+        /*---------------------------------------------------------*\
+        | --stats (no arguments)                                    |
+        \*---------------------------------------------------------*/
+        else if(option == "--stats")
+        {
+            OptionStats(rgb_controllers);
+            exit(0);
+        }
+
+        /*---------------------------------------------------------*\
+        | --parallel [timeout_ms]                                   |
+        \*---------------------------------------------------------*/
+        else if(option == "--parallel")
+        {
+            options->parallelOpts.enabled = true;
+
+            if(argument != "" && argument.find_first_not_of("0123456789") == std::string::npos)
+            {
+                options->parallelOpts.timeout_ms = std::stoi(argument);
+
+                arg_index++;
+            }
+        }
+
+        /*---------------------------------------------------------*\
+        | --brightness [0-100]                                      |
+        \*---------------------------------------------------------*/
+        else if(option == "--brightness")
+        {
+            if(argument == "" || argument.size() > 3 || argument.find_first_not_of("0123456789") != std::string::npos || std::stoi(argument) > 100)
+            {
+                std::cout << "Error: Invalid brightness " << argument << ", must be 0-100" << std::endl;
+                return RET_FLAG_PRINT_HELP;
+            }
+
+            ResourceManager::get()->SetGlobalBrightness(((std::stoi(argument) * 255) + 50) / 100);
+
+            arg_index++;
+        }
+
         /*---------------------------------------------------------*\
         | -d / --device                                             |
         \*---------------------------------------------------------*/
@@ -912,6 +1153,17 @@ int ProcessOptions(int argc, char *argv[], Options *options, std::vector<Network
             arg_index++;
         }
 
+#ifdef HIDAPI_MOCK
+        /*---------------------------------------------------------*\
+        | --hid-benchmark                                           |
+        \*---------------------------------------------------------*/
+        else if(option == "--hid-benchmark")
+        {
+            OptionHIDBenchmark(argument, rgb_controllers);
+            exit(0);
+        }
+
+#endif
         /*---------------------------------------------------------*\
         | Invalid option                                            |
         \*---------------------------------------------------------*/
@@ -972,18 +1224,21 @@ void ApplyOptions(DeviceOptions& options, std::vector<RGBController *> &rgb_cont
             if(options.colors.size() != 0)
             {
                 std::size_t last_set_color;
+                RGBColor*   frame = device->BeginFrame();
 
-                for(std::size_t led_idx = 0; led_idx < device->leds.size(); led_idx++)
+                for(std::size_t led_idx = 0; led_idx < device->colors.size(); led_idx++)
                 {
                     if(led_idx < options.colors.size())
                     {
                         last_set_color = led_idx;
                     }
 
-                    device->colors[led_idx] = ToRGBColor(std::get<0>(options.colors[last_set_color]),
-                                                         std::get<1>(options.colors[last_set_color]),
-                                                         std::get<2>(options.colors[last_set_color]));
+                    frame[led_idx] = ToRGBColor(std::get<0>(options.colors[last_set_color]),
+                                                std::get<1>(options.colors[last_set_color]),
+                                                std::get<2>(options.colors[last_set_color]));
                 }
+
+                device->PublishFrame();
             }
             break;
 
@@ -1008,17 +1263,182 @@ void ApplyOptions(DeviceOptions& options, std::vector<RGBController *> &rgb_cont
     }
 
     /*---------------------------------------------------------*\
-    | Set device mode                                           |
+    | Set device mode.  The device thread takes the published   |
+    | frame before it sends the mode                            |
     \*---------------------------------------------------------*/
     device->active_mode = mode;
-    device->DeviceUpdateMode();
+    device->ForceUpdateMode();
 
     /*---------------------------------------------------------*\
     | Set device per-LED colors if necessary                    |
     \*---------------------------------------------------------*/
     if(device->modes[mode].color_mode == MODE_COLORS_PER_LED)
     {
-        device->DeviceUpdateLEDs();
+        device->UpdateLEDs();
+    }
+
+    /*---------------------------------------------------------*\
+    | Don't return until the device has been written, the CLI   |
+    | may exit right after and parallel apply times this call   |
+    \*---------------------------------------------------------*/
+    WaitForDeviceUpdate(device);
+}
+
+/*---------------------------------------------------------------------------------------------------------*\
+| Parallel apply                                                                                            |
+|                                                                                                           |
+| Devices are grouped by the bus they talk over and each group gets its own thread.  SMBus devices report  |
+| their location as "<bus name>, address 0xNN" so everything before the address shares a group.  HID and   |
+| serial devices report their path, so controllers that share one handle end up in the same group.  All    |
+| network devices share the client socket and are kept in a single group.                                  |
+\*---------------------------------------------------------------------------------------------------------*/
+
+struct ParallelApplyState
+{
+    std::mutex                  mutex;
+    std::condition_variable     cv;
+    unsigned int                groups_done = 0;
+    std::vector<bool>           device_done;
+    std::vector<double>         device_time_ms;
+};
+
+std::string GetDeviceBusKey(RGBController* device, unsigned int device_idx)
+{
+    if(dynamic_cast<RGBController_Network*>(device) != NULL)
+    {
+        return("network");
+    }
+
+    std::size_t address_pos = device->location.find(", address");
+
+    if(address_pos != std::string::npos)
+    {
+        return(device->location.substr(0, address_pos));
+    }
+
+    if(device->location == "")
+    {
+        return("device " + std::to_string(device_idx));
+    }
+
+    return(device->location);
+}
+
+void ApplyOptionsParallel(std::vector<DeviceOptions>& apply_list, unsigned int timeout_ms, std::vector<RGBController *> &rgb_controllers)
+{
+    /*---------------------------------------------------------*\
+    | Group the requested devices by bus                        |
+    \*---------------------------------------------------------*/
+    std::map<std::string, std::vector<unsigned int>> groups;
+
+    for(unsigned int apply_idx = 0; apply_idx < apply_list.size(); apply_idx++)
+    {
+        unsigned int device_idx = apply_list[apply_idx].device;
+
+        groups[GetDeviceBusKey(rgb_controllers[device_idx], device_idx)].push_back(apply_idx);
+    }
+
+    /*---------------------------------------------------------*\
+    | The state is shared with the worker threads so that a     |
+    | thread which outlives the timeout never touches freed     |
+    | memory                                                    |
+    \*---------------------------------------------------------*/
+    std::shared_ptr<ParallelApplyState> state = std::make_shared<ParallelApplyState>();
+
+    state->device_done.resize(apply_list.size(), false);
+    state->device_time_ms.resize(apply_list.size(), 0.0);
+
+    std::vector<std::thread> threads;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for(std::map<std::string, std::vector<unsigned int>>::iterator group = groups.begin(); group != groups.end(); group++)
+    {
+        std::vector<unsigned int> group_list = group->second;
+
+        threads.push_back(std::thread([state, group_list, &apply_list, &rgb_controllers]()
+        {
+            for(unsigned int group_idx = 0; group_idx < group_list.size(); group_idx++)
+            {
+                unsigned int apply_idx = group_list[group_idx];
+
+                std::chrono::steady_clock::time_point device_start = std::chrono::steady_clock::now();
+
+                ApplyOptions(apply_list[apply_idx], rgb_controllers);
+
+                std::chrono::steady_clock::time_point device_end = std::chrono::steady_clock::now();
+
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->device_done[apply_idx]    = true;
+                state->device_time_ms[apply_idx] = std::chrono::duration<double, std::milli>(device_end - device_start).count();
+            }
+
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->groups_done++;
+            state->cv.notify_all();
+        }));
+    }
+
+    /*---------------------------------------------------------*\
+    | Wait for all groups to finish or for the timeout          |
+    \*---------------------------------------------------------*/
+    std::unique_lock<std::mutex> lock(state->mutex);
+
+    bool finished = state->cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), [&state, &groups]()
+    {
+        return(state->groups_done == groups.size());
+    });
+
+    double total_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    /*---------------------------------------------------------*\
+    | Report per-device timing                                  |
+    \*---------------------------------------------------------*/
+    for(std::map<std::string, std::vector<unsigned int>>::iterator group = groups.begin(); group != groups.end(); group++)
+    {
+        std::cout << group->first << std::endl;
+
+        for(unsigned int group_idx = 0; group_idx < group->second.size(); group_idx++)
+        {
+            unsigned int apply_idx  = group->second[group_idx];
+            unsigned int device_idx = apply_list[apply_idx].device;
+
+            std::cout << "  " << device_idx << ": " << rgb_controllers[device_idx]->name << " - ";
+
+            if(state->device_done[apply_idx])
+            {
+                std::cout << state->device_time_ms[apply_idx] << " ms" << std::endl;
+            }
+            else
+            {
+                std::cout << "did not finish" << std::endl;
+            }
+        }
+    }
+
+    std::cout << "Applied " << apply_list.size() << " devices on " << groups.size() << " buses in " << total_ms << " ms" << std::endl;
+
+    lock.unlock();
+
+    /*---------------------------------------------------------*\
+    | Join finished threads, leave stuck ones behind            |
+    \*---------------------------------------------------------*/
+    for(unsigned int thread_idx = 0; thread_idx < threads.size(); thread_idx++)
+    {
+        if(finished)
+        {
+            threads[thread_idx].join();
+        }
+        else
+        {
+            threads[thread_idx].detach();
+        }
+    }
+
+    if(!finished)
+    {
+        std::cout << "Error: Timed out after " << timeout_ms << " ms waiting for devices" << std::endl;
+        exit(1);
     }
 }
 
@@ -1058,7 +1478,18 @@ unsigned int cli_main(int argc, char *argv[], std::vector<RGBController *> &rgb_
             \*---------------------------------------------------------*/
             if((ret_flags & RET_FLAG_START_GUI) == 0)
             {
+                /*---------------------------------------------------------*\
+                | Watch for USB devices being plugged in or removed while   |
+                | the daemon runs, if this process detected them itself     |
+                \*---------------------------------------------------------*/
+                if(clients.size() == 0)
+                {
+                    ResourceManager::get()->StartHotplugMonitor();
+                }
+
                 WaitWhileServerOnline(network_server);
+
+                ResourceManager::get()->StopHotplugMonitor();
             }
         }
         else
@@ -1094,7 +1525,26 @@ unsigned int cli_main(int argc, char *argv[], std::vector<RGBController *> &rgb_
     | through all of the specific devices and apply settings.   |
     | Otherwise, apply settings to all devices.                 |
     \*---------------------------------------------------------*/
-    if (options.hasDevice)
+    if(options.parallelOpts.enabled)
+    {
+        std::vector<DeviceOptions> apply_list;
+
+        if(options.hasDevice)
+        {
+            apply_list = options.devices;
+        }
+        else
+        {
+            for(unsigned int device_idx = 0; device_idx < rgb_controllers.size(); device_idx++)
+            {
+                options.allDeviceOptions.device = device_idx;
+                apply_list.push_back(options.allDeviceOptions);
+            }
+        }
+
+        ApplyOptionsParallel(apply_list, options.parallelOpts.timeout_ms, rgb_controllers);
+    }
+    else if (options.hasDevice)
     {
         for(unsigned int device_idx = 0; device_idx < options.devices.size(); device_idx++)
         {
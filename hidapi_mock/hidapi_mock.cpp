@@ -0,0 +1,563 @@
+/*-----------------------------------------*\
+|  hidapi_mock.cpp                          |
+|                                           |
+|  In-process fake hidapi backend used for  |
+|  benchmarking HID controllers without     |
+|  the physical devices attached            |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "hidapi_mock.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cwchar>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+/*-----------------------------------------------------*\
+| Maximum number of pending input reports per device.   |
+| Controllers that never read would otherwise grow the  |
+| queue without bound.                                  |
+\*-----------------------------------------------------*/
+#define HID_MOCK_MAX_PENDING_INPUT  32
+
+struct hid_device_
+{
+    unsigned int                            descriptor_idx;
+    std::string                             path;
+    bool                                    nonblocking;
+    std::mutex                              report_mutex;
+    std::deque<std::vector<unsigned char>>  pending_input;
+    std::vector<std::vector<unsigned char>> feature_reports;
+};
+
+static std::atomic<unsigned int>        report_latency_us(1000);
+static std::atomic<unsigned int>        record_depth(256);
+
+static std::atomic<unsigned long long>  stat_output_reports(0);
+static std::atomic<unsigned long long>  stat_feature_reports(0);
+static std::atomic<unsigned long long>  stat_input_reports(0);
+static std::atomic<unsigned long long>  stat_bytes_written(0);
+static std::atomic<unsigned long long>  stat_bytes_read(0);
+static std::atomic<unsigned long long>  stat_open_count(0);
+
+static std::mutex                                   record_mutex;
+static std::vector<std::deque<hid_mock_report>>     record_list;
+
+/*-----------------------------------------------------*\
+| Path format is mock-hid:<descriptor index>            |
+\*-----------------------------------------------------*/
+static std::string MockPath(unsigned int descriptor_idx)
+{
+    char path[32];
+
+    snprintf(path, sizeof(path), "mock-hid:%u", descriptor_idx);
+
+    return(path);
+}
+
+static bool MockPathToIndex(const char* path, unsigned int* descriptor_idx)
+{
+    if(path == NULL)
+    {
+        return(false);
+    }
+
+    if(sscanf(path, "mock-hid:%u", descriptor_idx) != 1)
+    {
+        return(false);
+    }
+
+    return(*descriptor_idx < hid_mock_device_count);
+}
+
+static wchar_t* MockWideString(const char* str)
+{
+    std::size_t len = strlen(str);
+    wchar_t*    ret = (wchar_t*)malloc((len + 1) * sizeof(wchar_t));
+
+    for(std::size_t i = 0; i < len; i++)
+    {
+        ret[i] = (wchar_t)(unsigned char)str[i];
+    }
+
+    ret[len] = L'\0';
+
+    return(ret);
+}
+
+static int MockCopyWideString(const char* str, wchar_t* string, size_t maxlen)
+{
+    if((string == NULL) || (maxlen == 0))
+    {
+        return(-1);
+    }
+
+    std::size_t i = 0;
+
+    for(; (str[i] != '\0') && (i < (maxlen - 1)); i++)
+    {
+        string[i] = (wchar_t)(unsigned char)str[i];
+    }
+
+    string[i] = L'\0';
+
+    return(0);
+}
+
+/*-----------------------------------------------------*\
+| Simulate the time the report spends on the bus.       |
+| Called with the device report mutex held, so reports  |
+| to one device are serialized just like on real        |
+| hardware while separate devices run in parallel.      |
+\*-----------------------------------------------------*/
+static void MockReportDelay()
+{
+    unsigned int latency = report_latency_us.load();
+
+    if(latency > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(latency));
+    }
+}
+
+static void MockRecord(hid_device* device, unsigned char type, const unsigned char* data, size_t length)
+{
+    unsigned int depth = record_depth.load();
+
+    if(depth == 0)
+    {
+        return;
+    }
+
+    hid_mock_report report;
+
+    report.type = type;
+    report.data.assign(data, data + length);
+
+    std::lock_guard<std::mutex> lock(record_mutex);
+
+    std::deque<hid_mock_report>& records = record_list[device->descriptor_idx];
+
+    records.push_back(report);
+
+    while(records.size() > depth)
+    {
+        records.pop_front();
+    }
+}
+
+void hid_mock_set_report_latency(unsigned int latency_us)
+{
+    report_latency_us = latency_us;
+}
+
+unsigned int hid_mock_get_report_latency()
+{
+    return(report_latency_us.load());
+}
+
+void hid_mock_set_record_depth(unsigned int depth)
+{
+    record_depth = depth;
+}
+
+hid_mock_stats hid_mock_get_stats()
+{
+    hid_mock_stats stats;
+
+    stats.output_reports    = stat_output_reports.load();
+    stats.feature_reports   = stat_feature_reports.load();
+    stats.input_reports     = stat_input_reports.load();
+    stats.bytes_written     = stat_bytes_written.load();
+    stats.bytes_read        = stat_bytes_read.load();
+    stats.open_count        = stat_open_count.load();
+
+    return(stats);
+}
+
+void hid_mock_reset_stats()
+{
+    stat_output_reports     = 0;
+    stat_feature_reports    = 0;
+    stat_input_reports      = 0;
+    stat_bytes_written      = 0;
+    stat_bytes_read         = 0;
+    stat_open_count         = 0;
+}
+
+std::vector<hid_mock_report> hid_mock_get_reports(const char* path)
+{
+    std::vector<hid_mock_report>    reports;
+    unsigned int                    descriptor_idx;
+
+    if(MockPathToIndex(path, &descriptor_idx))
+    {
+        std::lock_guard<std::mutex> lock(record_mutex);
+
+        if(descriptor_idx < record_list.size())
+        {
+            reports.assign(record_list[descriptor_idx].begin(), record_list[descriptor_idx].end());
+        }
+    }
+
+    return(reports);
+}
+
+/******************************************************************************************\
+*                                                                                          *
+*   hidapi API                                                                             *
+*                                                                                          *
+\******************************************************************************************/
+
+int HID_API_EXPORT HID_API_CALL hid_init(void)
+{
+    static std::once_flag init_flag;
+
+    std::call_once(init_flag, []()
+    {
+        const char* latency_env = getenv("OPENRGB_HID_MOCK_LATENCY_US");
+
+        if(latency_env != NULL)
+        {
+            report_latency_us = (unsigned int)strtoul(latency_env, NULL, 10);
+        }
+
+        std::lock_guard<std::mutex> lock(record_mutex);
+        record_list.resize(hid_mock_device_count);
+    });
+
+    return(0);
+}
+
+int HID_API_EXPORT HID_API_CALL hid_exit(void)
+{
+    return(0);
+}
+
+struct hid_device_info HID_API_EXPORT * HID_API_CALL hid_enumerate(unsigned short vendor_id, unsigned short product_id)
+{
+    struct hid_device_info* root = NULL;
+    struct hid_device_info* last = NULL;
+
+    for(unsigned int descriptor_idx = 0; descriptor_idx < hid_mock_device_count; descriptor_idx++)
+    {
+        const hid_mock_descriptor* desc = &hid_mock_device_list[descriptor_idx];
+
+        if(((vendor_id  != 0) && (vendor_id  != desc->vendor_id))
+         ||((product_id != 0) && (product_id != desc->product_id)))
+        {
+            continue;
+        }
+
+#ifndef USE_HID_USAGE
+        /*-------------------------------------------------*\
+        | Without usage support (hidraw/libusb) there is    |
+        | one entry per interface, so skip additional       |
+        | usages on an interface already listed             |
+        \*-------------------------------------------------*/
+        if((descriptor_idx > 0)
+         &&(hid_mock_device_list[descriptor_idx - 1].vendor_id        == desc->vendor_id)
+         &&(hid_mock_device_list[descriptor_idx - 1].product_id       == desc->product_id)
+         &&(hid_mock_device_list[descriptor_idx - 1].interface_number == desc->interface_number))
+        {
+            continue;
+        }
+#endif
+
+        char serial[32];
+
+        snprintf(serial, sizeof(serial), "MOCK%04X%04X%02u", desc->vendor_id, desc->product_id, descriptor_idx);
+
+        struct hid_device_info* info = (struct hid_device_info*)calloc(1, sizeof(struct hid_device_info));
+
+        info->path                  = strdup(MockPath(descriptor_idx).c_str());
+        info->vendor_id             = desc->vendor_id;
+        info->product_id            = desc->product_id;
+        info->serial_number         = MockWideString(serial);
+        info->release_number        = 0x0100;
+        info->manufacturer_string   = MockWideString("OpenRGB Mock");
+        info->product_string        = MockWideString(desc->name);
+        info->usage_page            = desc->usage_page;
+        info->usage                 = desc->usage;
+        info->interface_number      = desc->interface_number;
+        info->next                  = NULL;
+
+        if(last == NULL)
+        {
+            root = info;
+        }
+        else
+        {
+            last->next = info;
+        }
+
+        last = info;
+    }
+
+    return(root);
+}
+
+void HID_API_EXPORT HID_API_CALL hid_free_enumeration(struct hid_device_info *devs)
+{
+    while(devs)
+    {
+        struct hid_device_info* next = devs->next;
+
+        free(devs->path);
+        free(devs->serial_number);
+        free(devs->manufacturer_string);
+        free(devs->product_string);
+        free(devs);
+
+        devs = next;
+    }
+}
+
+HID_API_EXPORT hid_device * HID_API_CALL hid_open(unsigned short vendor_id, unsigned short product_id, const wchar_t * /*serial_number*/)
+{
+    for(unsigned int descriptor_idx = 0; descriptor_idx < hid_mock_device_count; descriptor_idx++)
+    {
+        if((hid_mock_device_list[descriptor_idx].vendor_id  == vendor_id)
+         &&(hid_mock_device_list[descriptor_idx].product_id == product_id))
+        {
+            return(hid_open_path(MockPath(descriptor_idx).c_str()));
+        }
+    }
+
+    return(NULL);
+}
+
+HID_API_EXPORT hid_device * HID_API_CALL hid_open_path(const char *path)
+{
+    unsigned int descriptor_idx;
+
+    hid_init();
+
+    if(!MockPathToIndex(path, &descriptor_idx))
+    {
+        return(NULL);
+    }
+
+    hid_device* device      = new hid_device;
+
+    device->descriptor_idx  = descriptor_idx;
+    device->path            = path;
+    device->nonblocking     = false;
+
+    stat_open_count++;
+
+    return(device);
+}
+
+int HID_API_EXPORT HID_API_CALL hid_write(hid_device *device, const unsigned char *data, size_t length)
+{
+    if((device == NULL) || (data == NULL) || (length == 0))
+    {
+        return(-1);
+    }
+
+    std::lock_guard<std::mutex> lock(device->report_mutex);
+
+    MockReportDelay();
+
+    /*-----------------------------------------------------*\
+    | Queue the simulated reply for the next read           |
+    \*-----------------------------------------------------*/
+    std::vector<unsigned char> reply(data, data + length);
+
+    if(hid_mock_device_list[device->descriptor_idx].reply == HID_MOCK_REPLY_ECHO_INCREMENT)
+    {
+        reply[0]++;
+    }
+
+    device->pending_input.push_back(reply);
+
+    if(device->pending_input.size() > HID_MOCK_MAX_PENDING_INPUT)
+    {
+        device->pending_input.pop_front();
+    }
+
+    MockRecord(device, HID_MOCK_REPORT_OUTPUT, data, length);
+
+    stat_output_reports++;
+    stat_bytes_written += length;
+
+    return((int)length);
+}
+
+int HID_API_EXPORT HID_API_CALL hid_read_timeout(hid_device *device, unsigned char *data, size_t length, int /*milliseconds*/)
+{
+    if((device == NULL) || (data == NULL))
+    {
+        return(-1);
+    }
+
+    std::lock_guard<std::mutex> lock(device->report_mutex);
+
+    /*-----------------------------------------------------*\
+    | Nothing pending is reported as a timeout rather than  |
+    | blocking, a real device would never answer either     |
+    \*-----------------------------------------------------*/
+    if(device->pending_input.empty())
+    {
+        return(0);
+    }
+
+    std::vector<unsigned char>& reply = device->pending_input.front();
+
+    size_t copy_len = (reply.size() < length) ? reply.size() : length;
+
+    memset(data, 0, length);
+    memcpy(data, reply.data(), copy_len);
+
+    device->pending_input.pop_front();
+
+    stat_input_reports++;
+    stat_bytes_read += copy_len;
+
+    return((int)copy_len);
+}
+
+int HID_API_EXPORT HID_API_CALL hid_read(hid_device *device, unsigned char *data, size_t length)
+{
+    return(hid_read_timeout(device, data, length, device && device->nonblocking ? 0 : -1));
+}
+
+int HID_API_EXPORT HID_API_CALL hid_set_nonblocking(hid_device *device, int nonblock)
+{
+    if(device == NULL)
+    {
+        return(-1);
+    }
+
+    device->nonblocking = (nonblock != 0);
+
+    return(0);
+}
+
+int HID_API_EXPORT HID_API_CALL hid_send_feature_report(hid_device *device, const unsigned char *data, size_t length)
+{
+    if((device == NULL) || (data == NULL) || (length == 0))
+    {
+        return(-1);
+    }
+
+    std::lock_guard<std::mutex> lock(device->report_mutex);
+
+    MockReportDelay();
+
+    /*-----------------------------------------------------*\
+    | Keep the last feature report per report ID so that    |
+    | hid_get_feature_report can return it                  |
+    \*-----------------------------------------------------*/
+    bool stored = false;
+
+    for(std::size_t report_idx = 0; report_idx < device->feature_reports.size(); report_idx++)
+    {
+        if(device->feature_reports[report_idx][0] == data[0])
+        {
+            device->feature_reports[report_idx].assign(data, data + length);
+            stored = true;
+            break;
+        }
+    }
+
+    if(!stored)
+    {
+        device->feature_reports.push_back(std::vector<unsigned char>(data, data + length));
+    }
+
+    MockRecord(device, HID_MOCK_REPORT_FEATURE, data, length);
+
+    stat_feature_reports++;
+    stat_bytes_written += length;
+
+    return((int)length);
+}
+
+int HID_API_EXPORT HID_API_CALL hid_get_feature_report(hid_device *device, unsigned char *data, size_t length)
+{
+    if((device == NULL) || (data == NULL) || (length == 0))
+    {
+        return(-1);
+    }
+
+    std::lock_guard<std::mutex> lock(device->report_mutex);
+
+    MockReportDelay();
+
+    unsigned char report_id = data[0];
+
+    memset(data, 0, length);
+    data[0] = report_id;
+
+    for(std::size_t report_idx = 0; report_idx < device->feature_reports.size(); report_idx++)
+    {
+        std::vector<unsigned char>& report = device->feature_reports[report_idx];
+
+        if(report[0] == report_id)
+        {
+            size_t copy_len = (report.size() < length) ? report.size() : length;
+
+            memcpy(data, report.data(), copy_len);
+            break;
+        }
+    }
+
+    stat_input_reports++;
+    stat_bytes_read += length;
+
+    return((int)length);
+}
+
+void HID_API_EXPORT HID_API_CALL hid_close(hid_device *device)
+{
+    delete device;
+}
+
+int HID_API_EXPORT_CALL hid_get_manufacturer_string(hid_device * /*device*/, wchar_t *string, size_t maxlen)
+{
+    return(MockCopyWideString("OpenRGB Mock", string, maxlen));
+}
+
+int HID_API_EXPORT_CALL hid_get_product_string(hid_device *device, wchar_t *string, size_t maxlen)
+{
+    if(device == NULL)
+    {
+        return(-1);
+    }
+
+    return(MockCopyWideString(hid_mock_device_list[device->descriptor_idx].name, string, maxlen));
+}
+
+int HID_API_EXPORT_CALL hid_get_serial_number_string(hid_device *device, wchar_t *string, size_t maxlen)
+{
+    if(device == NULL)
+    {
+        return(-1);
+    }
+
+    const hid_mock_descriptor* desc = &hid_mock_device_list[device->descriptor_idx];
+    char                       serial[32];
+
+    snprintf(serial, sizeof(serial), "MOCK%04X%04X%02u", desc->vendor_id, desc->product_id, device->descriptor_idx);
+
+    return(MockCopyWideString(serial, string, maxlen));
+}
+
+int HID_API_EXPORT_CALL hid_get_indexed_string(hid_device * /*device*/, int /*string_index*/, wchar_t *string, size_t maxlen)
+{
+    return(MockCopyWideString("", string, maxlen));
+}
+
+HID_API_EXPORT const wchar_t* HID_API_CALL hid_error(hid_device * /*device*/)
+{
+    return(NULL);
+}
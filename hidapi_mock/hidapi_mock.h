@@ -0,0 +1,97 @@
+/*-----------------------------------------*\
+|  hidapi_mock.h                            |
+|                                           |
+|  In-process fake hidapi backend used for  |
+|  benchmarking HID controllers without     |
+|  the physical devices attached            |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <hidapi/hidapi.h>
+
+/*-----------------------------------------------------*\
+| Reply behavior for simulated input reports            |
+|   ECHO           - Input report is a copy of the      |
+|                    last output report                 |
+|   ECHO_INCREMENT - Same as ECHO, but the first byte   |
+|                    (command) is incremented, used by  |
+|                    devices that answer 0xNN with      |
+|                    0xNN+1 (NZXT Hue 2, etc)           |
+\*-----------------------------------------------------*/
+enum
+{
+    HID_MOCK_REPLY_ECHO             = 0,
+    HID_MOCK_REPLY_ECHO_INCREMENT   = 1,
+};
+
+/*-----------------------------------------------------*\
+| Report types recorded by the mock                     |
+\*-----------------------------------------------------*/
+enum
+{
+    HID_MOCK_REPORT_OUTPUT          = 0,
+    HID_MOCK_REPORT_FEATURE         = 1,
+};
+
+typedef struct
+{
+    unsigned short  vendor_id;
+    unsigned short  product_id;
+    int             interface_number;
+    unsigned short  usage_page;
+    unsigned short  usage;
+    unsigned char   reply;
+    const char *    name;
+} hid_mock_descriptor;
+
+typedef struct
+{
+    unsigned char               type;
+    std::vector<unsigned char>  data;
+} hid_mock_report;
+
+typedef struct
+{
+    unsigned long long  output_reports;
+    unsigned long long  feature_reports;
+    unsigned long long  input_reports;
+    unsigned long long  bytes_written;
+    unsigned long long  bytes_read;
+    unsigned long long  open_count;
+} hid_mock_stats;
+
+/*-----------------------------------------------------*\
+| Device descriptor table, see hidapi_mock_devices.cpp  |
+\*-----------------------------------------------------*/
+extern const hid_mock_descriptor    hid_mock_device_list[];
+extern const unsigned int           hid_mock_device_count;
+
+/*-----------------------------------------------------*\
+| Simulated time taken by every output/feature report.  |
+| Defaults to 1000us (one full-speed USB frame) and can |
+| be overridden with OPENRGB_HID_MOCK_LATENCY_US        |
+\*-----------------------------------------------------*/
+void                            hid_mock_set_report_latency(unsigned int latency_us);
+unsigned int                    hid_mock_get_report_latency();
+
+/*-----------------------------------------------------*\
+| Number of reports kept per device for inspection.     |
+| Set to 0 to disable recording.                        |
+\*-----------------------------------------------------*/
+void                            hid_mock_set_record_depth(unsigned int depth);
+
+/*-----------------------------------------------------*\
+| Statistics across all mock devices                    |
+\*-----------------------------------------------------*/
+hid_mock_stats                  hid_mock_get_stats();
+void                            hid_mock_reset_stats();
+
+/*-----------------------------------------------------*\
+| Recorded reports of the device at the given path      |
+\*-----------------------------------------------------*/
+std::vector<hid_mock_report>    hid_mock_get_reports(const char* path);
@@ -0,0 +1,187 @@
+/*-----------------------------------------*\
+|  hidapi_mock_devices.cpp                  |
+|                                           |
+|  HID descriptors presented by the mock    |
+|  hidapi backend.  Entries mirror the      |
+|  tables in each *ControllerDetect.cpp     |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "hidapi_mock.h"
+
+#define ECHO        HID_MOCK_REPLY_ECHO
+#define ECHO_INC    HID_MOCK_REPLY_ECHO_INCREMENT
+
+const hid_mock_descriptor hid_mock_device_list[] =
+{
+    /*---------------------------------------------------------------------------------------------------------*\
+    | AMD Wraith Prism                                                                                          |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x2516,   0x0051,     1,  0xFF00, 0x0001, ECHO,       "AMD Wraith Prism"                                  },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | Aorus CPU Cooler                                                                                          |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x1044,   0x7A42,     0,  0xFF01, 0x0001, ECHO,       "Aorus ATC800 CPU Cooler"                           },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | ASUS Aura Core                                                                                            |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x0B05,   0x1854,     0,  0xFF31, 0x0076, ECHO,       "ASUS Aura Core"                                    },
+    { 0x0B05,   0x1869,     0,  0xFF31, 0x0076, ECHO,       "ASUS Aura Core"                                    },
+    { 0x0B05,   0x1866,     0,  0xFF31, 0x0076, ECHO,       "ASUS Aura Core"                                    },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | ASUS Aura USB                                                                                             |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x0B05,   0x1867,     0,  0xFF72, 0x00A1, ECHO,       "ASUS Aura Addressable"                             },
+    { 0x0B05,   0x1872,     0,  0xFF72, 0x00A1, ECHO,       "ASUS Aura Addressable"                             },
+    { 0x0B05,   0x1889,     0,  0xFF72, 0x00A1, ECHO,       "ASUS Aura Addressable"                             },
+    { 0x0B05,   0x18A3,     0,  0xFF72, 0x00A1, ECHO,       "ASUS Aura Addressable"                             },
+    { 0x0B05,   0x18F3,     0,  0xFF72, 0x00A1, ECHO,       "ASUS Aura Motherboard"                             },
+    { 0x0B05,   0x1939,     0,  0xFF72, 0x00A1, ECHO,       "ASUS Aura Motherboard"                             },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | Cooler Master                                                                                             |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x2516,   0x0109,     0,  0xFF00, 0x0001, ECHO,       "Cooler Master MP750 (Extra Large)"                 },
+    { 0x2516,   0x0105,     0,  0xFF00, 0x0001, ECHO,       "Cooler Master MP750 (Medium)"                      },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | Corsair Lighting Node                                                                                     |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x1B1C,   0x0C1A,     0,  0xFFC0, 0x0001, ECHO,       "Corsair Lighting Node Core"                        },
+    { 0x1B1C,   0x0C0B,     0,  0xFFC0, 0x0001, ECHO,       "Corsair Lighting Node Pro"                         },
+    { 0x1B1C,   0x0C10,     0,  0xFFC0, 0x0001, ECHO,       "Corsair Commander Pro"                             },
+    { 0x1B1C,   0x0C1E,     0,  0xFFC0, 0x0001, ECHO,       "Corsair LS100 Lighting Kit"                        },
+    { 0x1B1C,   0x1D00,     0,  0xFFC0, 0x0001, ECHO,       "Corsair 1000D Obsidian"                            },
+    { 0x1B1C,   0x1D04,     0,  0xFFC0, 0x0001, ECHO,       "Corsair SPEC OMEGA RGB"                            },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | Corsair Peripherals                                                                                       |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x1B1C,   0x1B17,     1,  0xFFC2, 0x0004, ECHO,       "Corsair K65 RGB"                                   },
+    { 0x1B1C,   0x1B37,     1,  0xFFC2, 0x0004, ECHO,       "Corsair K65 LUX RGB"                               },
+    { 0x1B1C,   0x1B39,     1,  0xFFC2, 0x0004, ECHO,       "Corsair K65 RGB RAPIDFIRE"                         },
+    { 0x1B1C,   0x1B4F,     1,  0xFFC2, 0x0004, ECHO,       "Corsair K68 RGB"                                   },
+    { 0x1B1C,   0x1B13,     1,  0xFFC2, 0x0004, ECHO,       "Corsair K70 RGB"                                   },
+    { 0x1B1C,   0x1B33,     1,  0xFFC2, 0x0004, ECHO,       "Corsair K70 LUX RGB"                               },
+    { 0x1B1C,   0x1B38,     1,  0xFFC2, 0x0004, ECHO,       "Corsair K70 RGB RAPIDFIRE"                         },
+    { 0x1B1C,   0x1B49,     1,  0xFFC2, 0x0004, ECHO,       "Corsair K70 RGB MK.2"                              },
+    { 0x1B1C,   0x1B6B,     1,  0xFFC2, 0x0004, ECHO,       "Corsair K70 RGB MK.2 SE"                           },
+    { 0x1B1C,   0x1B55,     1,  0xFFC2, 0x0004, ECHO,       "Corsair K70 RGB MK.2 Low Profile"                  },
+    { 0x1B1C,   0x1B11,     1,  0xFFC2, 0x0004, ECHO,       "Corsair K95 RGB"                                   },
+    { 0x1B1C,   0x1B2D,     1,  0xFFC2, 0x0004, ECHO,       "Corsair K95 RGB PLATINUM"                          },
+    { 0x1B1C,   0x1B20,     1,  0xFFC2, 0x0004, ECHO,       "Corsair Strafe"                                    },
+    { 0x1B1C,   0x1B48,     1,  0xFFC2, 0x0004, ECHO,       "Corsair Strafe MK.2"                               },
+    { 0x1B1C,   0x1B74,     1,  0xFFC2, 0x0004, ECHO,       "Corsair Glaive RGB PRO"                            },
+    { 0x1B1C,   0x1B3C,     1,  0xFFC2, 0x0004, ECHO,       "Corsair Harpoon RGB"                               },
+    { 0x1B1C,   0x1B75,     1,  0xFFC2, 0x0004, ECHO,       "Corsair Harpoon RGB PRO"                           },
+    { 0x1B1C,   0x1B2E,     1,  0xFFC2, 0x0004, ECHO,       "Corsair M65 PRO"                                   },
+    { 0x1B1C,   0x1B5A,     1,  0xFFC2, 0x0004, ECHO,       "Corsair M65 RGB Elite"                             },
+    { 0x1B1C,   0x1B3E,     1,  0xFFC2, 0x0004, ECHO,       "Corsair Scimitar PRO RGB"                          },
+    { 0x1B1C,   0x1B2F,     1,  0xFFC2, 0x0004, ECHO,       "Corsair Sabre RGB"                                 },
+    { 0x1B1C,   0x1B3B,     0,  0xFFC2, 0x0004, ECHO,       "Corsair MM800 RGB Polaris"                         },
+    { 0x1B1C,   0x0A34,     0,  0xFFC2, 0x0004, ECHO,       "Corsair ST100 RGB"                                 },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | Ducky                                                                                                     |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x04D9,   0x0348,     1,  0xFF00, 0x0001, ECHO,       "Ducky Shine 7/Ducky One 2 RGB"                     },
+    { 0x04D9,   0x0356,     1,  0xFF00, 0x0001, ECHO,       "Ducky One 2 RGB TKL"                               },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | EK                                                                                                        |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x0483,   0x5750,     0,  0xFFA0, 0x0001, ECHO,       "EK Loop Connect"                                   },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | Glorious                                                                                                  |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x258A,   0x0036,     1,  0xFF00, 0x0001, ECHO,       "Glorious Model O"                                  },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | Holtek                                                                                                    |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x04D9,   0xA070,     1,  0xFF00, 0x0002, ECHO,       "Holtek USB Gaming Mouse"                           },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | HyperX                                                                                                    |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x0951,   0x16BE,     2,  0xFF01, 0x0001, ECHO,       "HyperX Alloy Elite RGB"                            },
+    { 0x0951,   0x16DC,     2,  0xFF01, 0x0001, ECHO,       "HyperX Alloy FPS RGB"                              },
+    { 0x0951,   0x16E5,     3,  0xFF01, 0x0001, ECHO,       "HyperX Alloy Origins"                              },
+    { 0x0951,   0x16E6,     3,  0xFF01, 0x0001, ECHO,       "HyperX Alloy Origins Core"                         },
+    { 0x0951,   0x16D3,     1,  0xFF01, 0x0001, ECHO,       "HyperX Pulsefire Surge"                            },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | Logitech keyboards expose two usages on the same interface                                                |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x046D,   0xC337,     1,  0xFF43, 0x0602, ECHO,       "Logitech G810 Orion Spectrum"                      },
+    { 0x046D,   0xC337,     1,  0xFF43, 0x0604, ECHO,       "Logitech G810 Orion Spectrum"                      },
+    { 0x046D,   0xC331,     1,  0xFF43, 0x0602, ECHO,       "Logitech G810 Orion Spectrum"                      },
+    { 0x046D,   0xC331,     1,  0xFF43, 0x0604, ECHO,       "Logitech G810 Orion Spectrum"                      },
+    { 0x046D,   0xC342,     1,  0xFF43, 0x0602, ECHO,       "Logitech G512"                                     },
+    { 0x046D,   0xC342,     1,  0xFF43, 0x0604, ECHO,       "Logitech G512"                                     },
+    { 0x046D,   0xC33C,     1,  0xFF43, 0x0602, ECHO,       "Logitech G512 RGB"                                 },
+    { 0x046D,   0xC33C,     1,  0xFF43, 0x0604, ECHO,       "Logitech G512 RGB"                                 },
+    { 0x046D,   0xC084,     1,  0xFF00, 0x0002, ECHO,       "Logitech G203 Prodigy"                             },
+    { 0x046D,   0xC092,     1,  0xFF00, 0x0002, ECHO,       "Logitech G203 Lightsync"                           },
+    { 0x046D,   0xC083,     1,  0xFF00, 0x0002, ECHO,       "Logitech G403 Prodigy"                             },
+    { 0x046D,   0xC08F,     1,  0xFF00, 0x0002, ECHO,       "Logitech G403 Hero"                                },
+    { 0x046D,   0xC332,     1,  0xFF00, 0x0002, ECHO,       "Logitech G502 Proteus Spectrum"                    },
+    { 0x046D,   0xC08B,     1,  0xFF00, 0x0002, ECHO,       "Logitech G502 Hero"                                },
+    { 0x046D,   0xC539,     2,  0xFF00, 0x0002, ECHO,       "Logitech G Lightspeed Wireless Gaming Mouse"       },
+    { 0x046D,   0xC088,     2,  0xFF00, 0x0002, ECHO,       "Logitech G Pro Wireless Gaming Mouse (Wired)"      },
+    { 0x046D,   0xC53A,     2,  0xFF00, 0x0002, ECHO,       "Logitech G Powerplay Mousepad with Lightspeed"     },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | MSI 3-Zone Keyboard                                                                                       |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x1770,   0xFF00,     0,  0xFF00, 0x0001, ECHO,       "MSI 3-Zone Keyboard"                               },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | NZXT                                                                                                      |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x1E71,   0x2001,     0,  0xFF00, 0x0001, ECHO_INC,   "NZXT Hue 2"                                        },
+    { 0x1E71,   0x2002,     0,  0xFF00, 0x0001, ECHO_INC,   "NZXT Hue 2 Ambient"                                },
+    { 0x1E71,   0x2006,     0,  0xFF00, 0x0001, ECHO_INC,   "NZXT Smart Device V2"                              },
+    { 0x1E71,   0x2009,     0,  0xFF00, 0x0001, ECHO_INC,   "NZXT RGB & Fan Controller"                         },
+    { 0x1E71,   0x170E,     0,  0xFF00, 0x0001, ECHO,       "NZXT Kraken X2"                                    },
+    { 0x1E71,   0x1715,     0,  0xFF00, 0x0001, ECHO,       "NZXT Kraken M2"                                    },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | Redragon                                                                                                  |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x0C45,   0x5204,     1,  0xFF1C, 0x0092, ECHO,       "Redragon K550 Yama"                                },
+    { 0x0C45,   0x5104,     1,  0xFF1C, 0x0092, ECHO,       "Redragon K552 Kumara"                              },
+    { 0x0C45,   0x5004,     1,  0xFF1C, 0x0092, ECHO,       "Redragon K556 Devarajas"                           },
+    { 0x0C45,   0x652F,     1,  0xFF1C, 0x0092, ECHO,       "Tecware Phantom Elite"                             },
+    { 0x0C45,   0x8520,     1,  0xFF1C, 0x0092, ECHO,       "Warrior Kane TC235"                                },
+    { 0x04D9,   0xFC30,     2,  0xFFA0, 0x0001, ECHO,       "Redragon M711 Cobra"                               },
+    { 0x04D9,   0xFC39,     2,  0xFFA0, 0x0001, ECHO,       "Redragon M715 Dagger"                              },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | Gigabyte RGB Fusion 2 USB                                                                                 |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x048D,   0x8297,     0,  0xFF89, 0x00CC, ECHO,       "Gigabyte RGB Fusion 2 USB (X570)"                  },
+    { 0x048D,   0x5702,     0,  0xFF89, 0x00CC, ECHO,       "Gigabyte RGB Fusion 2 USB (B550)"                  },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | SteelSeries                                                                                               |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x1038,   0x1702,     0,  0xFFC0, 0x0001, ECHO,       "SteelSeries Rival 100"                             },
+    { 0x1038,   0x170C,     0,  0xFFC0, 0x0001, ECHO,       "SteelSeries Rival 100 DotA 2 Edition"              },
+    { 0x1038,   0x1814,     0,  0xFFC0, 0x0001, ECHO,       "SteelSeries Rival 105"                             },
+    { 0x1038,   0x1729,     0,  0xFFC0, 0x0001, ECHO,       "SteelSeries Rival 110"                             },
+    { 0x1038,   0x1710,     0,  0xFFC0, 0x0001, ECHO,       "SteelSeries Rival 300"                             },
+    { 0x1038,   0x1714,     0,  0xFFC0, 0x0001, ECHO,       "Acer Predator Gaming Mouse (Rival 300)"            },
+    { 0x1038,   0x1394,     0,  0xFFC0, 0x0001, ECHO,       "SteelSeries Rival 300 CS:GO Fade Edition"          },
+    { 0x1038,   0x1716,     0,  0xFFC0, 0x0001, ECHO,       "SteelSeries Rival 300 CS:GO Fade Edition (stm32)"  },
+    { 0x1038,   0x171A,     0,  0xFFC0, 0x0001, ECHO,       "SteelSeries Rival 300 CS:GO Hyperbeast Edition"    },
+    { 0x1038,   0x1392,     0,  0xFFC0, 0x0001, ECHO,       "SteelSeries Rival 300 Dota 2 Edition"              },
+    { 0x1038,   0x1718,     0,  0xFFC0, 0x0001, ECHO,       "SteelSeries Rival 300 HP Omen Edition"             },
+    { 0x1038,   0x1229,     3,  0xFFC0, 0x0001, ECHO,       "SteelSeries Siberia 350"                           },
+    { 0x1038,   0x161C,     1,  0xFFC0, 0x0001, ECHO,       "SteelSeries Apex 5"                                },
+    { 0x1038,   0x1612,     1,  0xFFC0, 0x0001, ECHO,       "SteelSeries Apex 7"                                },
+    { 0x1038,   0x1618,     1,  0xFFC0, 0x0001, ECHO,       "SteelSeries Apex 7 TKL"                            },
+    { 0x1038,   0x1610,     1,  0xFFC0, 0x0001, ECHO,       "SteelSeries Apex Pro"                              },
+    { 0x1038,   0x1614,     1,  0xFFC0, 0x0001, ECHO,       "SteelSeries Apex Pro TKL"                          },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | Tecknet                                                                                                   |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x04D9,   0xFC05,     0,  0xFFA0, 0x0001, ECHO,       "Tecknet M0008"                                     },
+    /*---------------------------------------------------------------------------------------------------------*\
+    | Thermaltake                                                                                               |
+    \*---------------------------------------------------------------------------------------------------------*/
+    { 0x264A,   0x3006,     1,  0xFF01, 0x0001, ECHO,       "Thermaltake Poseidon Z RGB"                        },
+    { 0x264A,   0x1FA5,     0,  0xFF00, 0x0001, ECHO,       "Thermaltake Riing"                                 },
+    { 0x264A,   0x1FAD,     0,  0xFF00, 0x0001, ECHO,       "Thermaltake Riing"                                 },
+    { 0x264A,   0x1FB5,     0,  0xFF00, 0x0001, ECHO,       "Thermaltake Riing"                                 },
+};
+
+const unsigned int hid_mock_device_count = sizeof(hid_mock_device_list) / sizeof(hid_mock_device_list[0]);
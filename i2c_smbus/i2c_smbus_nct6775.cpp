@@ -195,6 +195,7 @@ void i2c_smbus_nct6775_detect(std::vector<i2c_smbus_interface*> &busses)
 {
     i2c_smbus_interface* bus;
     int sioaddr = 0x2E;
+    SuperIOSession session(sioaddr);
     superio_enter(sioaddr);
 
     int val = (superio_inb(sioaddr, SIO_REG_DEVID) << 8) | superio_inb(sioaddr, SIO_REG_DEVID + 1);
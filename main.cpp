@@ -150,10 +150,14 @@ int main(int argc, char* argv[])
     std::vector<RGBController*> &rgb_controllers = ResourceManager::get()->GetRGBControllers();
 
     ProfileManager profile_manager(rgb_controllers);
+
+    bool local_detection = false;
     
     if(!AttemptLocalConnection(rgb_controllers))
     {
         ResourceManager::get()->DetectDevices();
+
+        local_detection = true;
     }
 
     /*---------------------------------------------------------*\
@@ -172,6 +176,16 @@ int main(int argc, char* argv[])
     \*---------------------------------------------------------*/
     if(ret_flags & RET_FLAG_START_GUI)
     {
+        /*---------------------------------------------------------*\
+        | Watch for USB devices being plugged in or removed.  This  |
+        | waits until the command line has been handled so a rescan |
+        | never changes the list under a one-shot command           |
+        \*---------------------------------------------------------*/
+        if(local_detection)
+        {
+            ResourceManager::get()->StartHotplugMonitor();
+        }
+
         QApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
         QApplication a(argc, argv);
 
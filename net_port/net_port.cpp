@@ -13,13 +13,22 @@
 #include <sys/ioctl.h>
 #include <netinet/tcp.h>
 #include <sys/types.h>
+#include <sys/uio.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
 #endif
 #include <memory.h>
 #include <errno.h>
 #include <stdlib.h>
 #include <iostream>
 
-const char yes = 1;
+/*---------------------------------------------------------*\
+| Socket options are int-sized, a shorter length makes      |
+| setsockopt fail on Linux                                  |
+\*---------------------------------------------------------*/
+const int yes = 1;
 
 net_port::net_port()
 {
@@ -159,7 +168,7 @@ bool net_port::tcp_client_connect()
         /*-------------------------------------------------*\
         | Set socket options - no delay                     |
         \*-------------------------------------------------*/
-        setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+        setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, (const char *)&yes, sizeof(yes));
 
         if (select(sock + 1, NULL, &fdset, NULL, &tv) == 1)
         {
@@ -235,7 +244,7 @@ bool net_port::tcp_server(const char * port)
     /*-------------------------------------------------*\
     | Set socket options - no delay                     |
     \*-------------------------------------------------*/
-    setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+    setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, (const char *)&yes, sizeof(yes));
 
     return(true);
 }
@@ -265,7 +274,7 @@ SOCKET * net_port::tcp_server_listen()
     \*-------------------------------------------------*/
     u_long arg = 0;
     ioctlsocket(*client, FIONBIO, &arg);
-    setsockopt(*client, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+    setsockopt(*client, IPPROTO_TCP, TCP_NODELAY, (const char *)&yes, sizeof(yes));
     clients.push_back(client);
 
     return client;
@@ -347,3 +356,127 @@ int net_port::tcp_write(char * buffer, int length)
     }
     return(ret);
 }
+
+/*---------------------------------------------------------*\
+| Wait up to 5 seconds for room in the socket send buffer   |
+\*---------------------------------------------------------*/
+static bool net_wait_writable(SOCKET sock)
+{
+    fd_set              set;
+    struct timeval      timeout;
+
+    timeout.tv_sec      = 5;
+    timeout.tv_usec     = 0;
+
+    FD_ZERO(&set);
+    FD_SET(sock, &set);
+
+    return(select(sock + 1, NULL, &set, NULL, &timeout) == 1);
+}
+
+bool net_send_packet(SOCKET sock, const char * header, int header_size, const char * data, int data_size)
+{
+#ifdef WIN32
+    WSABUF  bufs[2];
+    DWORD   num_bufs    = 0;
+
+    bufs[num_bufs].buf  = (char *)header;
+    bufs[num_bufs].len  = header_size;
+    num_bufs++;
+
+    if((data != NULL) && (data_size > 0))
+    {
+        bufs[num_bufs].buf  = (char *)data;
+        bufs[num_bufs].len  = data_size;
+        num_bufs++;
+    }
+
+    WSABUF * buf = bufs;
+
+    while(num_bufs > 0)
+    {
+        DWORD sent = 0;
+
+        if(WSASend(sock, buf, num_bufs, &sent, 0, NULL, NULL) == SOCKET_ERROR)
+        {
+            if((WSAGetLastError() == WSAEWOULDBLOCK) && net_wait_writable(sock))
+            {
+                continue;
+            }
+
+            return(false);
+        }
+
+        /*-------------------------------------------------*\
+        | Skip past whatever was sent                       |
+        \*-------------------------------------------------*/
+        while((num_bufs > 0) && (sent >= buf->len))
+        {
+            sent -= buf->len;
+            buf++;
+            num_bufs--;
+        }
+
+        if(num_bufs > 0)
+        {
+            buf->buf += sent;
+            buf->len -= sent;
+        }
+    }
+#else
+    struct iovec    iov[2];
+    struct msghdr   msg     = {};
+
+    msg.msg_iov             = iov;
+    msg.msg_iovlen          = 0;
+
+    iov[msg.msg_iovlen].iov_base    = (void *)header;
+    iov[msg.msg_iovlen].iov_len     = header_size;
+    msg.msg_iovlen++;
+
+    if((data != NULL) && (data_size > 0))
+    {
+        iov[msg.msg_iovlen].iov_base    = (void *)data;
+        iov[msg.msg_iovlen].iov_len     = data_size;
+        msg.msg_iovlen++;
+    }
+
+    while(msg.msg_iovlen > 0)
+    {
+        ssize_t sent = sendmsg(sock, &msg, MSG_NOSIGNAL);
+
+        if(sent < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+
+            if(((errno == EAGAIN) || (errno == EWOULDBLOCK)) && net_wait_writable(sock))
+            {
+                continue;
+            }
+
+            return(false);
+        }
+
+        /*-------------------------------------------------*\
+        | Skip past whatever was sent                       |
+        \*-------------------------------------------------*/
+        while((msg.msg_iovlen > 0) && ((std::size_t)sent >= msg.msg_iov->iov_len))
+        {
+            sent -= msg.msg_iov->iov_len;
+            msg.msg_iov++;
+            msg.msg_iovlen--;
+        }
+
+        if(msg.msg_iovlen > 0)
+        {
+            msg.msg_iov->iov_base    = (char *)msg.msg_iov->iov_base + sent;
+            msg.msg_iov->iov_len    -= sent;
+        }
+    }
+#endif
+
+    return(true);
+}
@@ -84,4 +84,9 @@ private:
     addrinfo*   result_list;
 };
 
+//Send a packet header and its payload with a single gathered
+//write, continuing after partial sends and waiting out a full
+//send buffer.  Returns false if the connection failed
+bool net_send_packet(SOCKET sock, const char * header, int header_size, const char * data, int data_size);
+
 #endif
@@ -14,6 +14,7 @@
 #include <QtCore/qmath.h>
 #include <QDebug>
 #include <QMouseEvent>
+#include <QPaintEvent>
 
 DeviceView::DeviceView(QWidget *parent) :
     QWidget(parent),
@@ -144,6 +145,31 @@ static const std::map<std::string, led_label> led_label_lookup =
     { "Key: Number Pad 9",      { "9"     , "9",               }},
 };
 
+/*-----------------------------------------------------*\
+| Keys that are expanded to fill empty matrix spaces,   |
+| see setController for details                         |
+\*-----------------------------------------------------*/
+enum
+{
+    LED_FILL_NONE       = 0,
+    LED_FILL_LEFT       = 1,
+    LED_FILL_UP_DOWN    = 2,
+    LED_FILL_WIDE       = 3,
+};
+
+static const std::map<std::string, unsigned char> led_fill_lookup =
+{
+    { "Key: Tab",               LED_FILL_LEFT       },
+    { "Key: Caps Lock",         LED_FILL_LEFT       },
+    { "Key: Left Shift",        LED_FILL_LEFT       },
+    { "Key: Right Shift",       LED_FILL_LEFT       },
+    { "Key: Backspace",         LED_FILL_LEFT       },
+    { "Key: Number Pad 0",      LED_FILL_LEFT       },
+    { "Key: Number Pad Enter",  LED_FILL_UP_DOWN    },
+    { "Key: Number Pad +",      LED_FILL_UP_DOWN    },
+    { "Key: Space",             LED_FILL_WIDE       },
+};
+
 void DeviceView::setController(RGBController * controller_ptr)
 {
     /*-----------------------------------------------------*\
@@ -163,6 +189,29 @@ void DeviceView::setController(RGBController * controller_ptr)
     led_pos.resize(controller->leds.size());
     led_labels.resize(controller->leds.size());
 
+    /*-----------------------------------------------------*\
+    | Look up LED labels and fill types once per LED rather |
+    | than comparing names inside the layout loop           |
+    \*-----------------------------------------------------*/
+    std::vector<unsigned char> led_fill(controller->leds.size(), LED_FILL_NONE);
+
+    for(std::size_t led_idx = 0; led_idx < controller->leds.size(); led_idx++)
+    {
+        std::map<std::string, led_label>::const_iterator label_it = led_label_lookup.find(controller->leds[led_idx].name);
+
+        if(label_it != led_label_lookup.end())
+        {
+            led_labels[led_idx] = label_it->second.label_utf8;
+        }
+
+        std::map<std::string, unsigned char>::const_iterator fill_it = led_fill_lookup.find(controller->leds[led_idx].name);
+
+        if(fill_it != led_fill_lookup.end())
+        {
+            led_fill[led_idx] = fill_it->second;
+        }
+    }
+
     /*-----------------------------------------------------*\
     | Process position and size for zones                   |
     \*-----------------------------------------------------*/
@@ -250,18 +299,12 @@ void DeviceView::setController(RGBController * controller_ptr)
                         \*-----------------------------------------------------*/
                         if(led_x < map->width - 1 && map->map[map_idx + 1] == 0xFFFFFFFF)
                         {
-                            if( ( controller->leds[color_idx].name == "Key: Tab"          )
-                             || ( controller->leds[color_idx].name == "Key: Caps Lock"    )
-                             || ( controller->leds[color_idx].name == "Key: Left Shift"   )
-                             || ( controller->leds[color_idx].name == "Key: Right Shift"  )
-                             || ( controller->leds[color_idx].name == "Key: Backspace"    )
-                             || ( controller->leds[color_idx].name == "Key: Number Pad 0" ) )
+                            if(led_fill[color_idx] == LED_FILL_LEFT)
                             {
                                 led_pos[color_idx].matrix_w += atom;
                             }
                         }
-                        if( ( controller->leds[color_idx].name == "Key: Number Pad Enter" )
-                         || ( controller->leds[color_idx].name == "Key: Number Pad +"     ) )
+                        if(led_fill[color_idx] == LED_FILL_UP_DOWN)
                         {
                             if(led_y < map->height - 1 && map->map[map_idx + map->width] == 0xFFFFFFFF)
                             {
@@ -274,7 +317,7 @@ void DeviceView::setController(RGBController * controller_ptr)
                                 led_pos[color_idx].matrix_h += atom;
                             }
                         }
-                        else if(controller->leds[color_idx].name == "Key: Space")
+                        else if(led_fill[color_idx] == LED_FILL_WIDE)
                         {
                             for(unsigned int map_idx2 = map_idx - 1; map_idx2 > led_y * map->width && map->map[map_idx2] == 0xFFFFFFFF; --map_idx2)
                             {
@@ -307,18 +350,13 @@ void DeviceView::setController(RGBController * controller_ptr)
     }
 
     /*-----------------------------------------------------*\
-    | Update LED labels                                     |
+    | Update cached size, offset and rendering              |
     \*-----------------------------------------------------*/
-    for(std::size_t led_idx = 0; led_idx < controller->leds.size(); led_idx++)
-    {
-        std::map<std::string, led_label>::const_iterator it = led_label_lookup.find(controller->leds[led_idx].name);
-
-        if(it != led_label_lookup.end())
-        {
-            led_labels[led_idx] = it->second.label_utf8;
-        }
-    }
+    updateCache();
+}
 
+void DeviceView::updateCache()
+{
     /*-----------------------------------------------------*\
     | Update cached size and offset                         |
     \*-----------------------------------------------------*/
@@ -330,6 +368,122 @@ void DeviceView::setController(RGBController * controller_ptr)
         size     = height() / matrix_h;
         offset_x = (width() - size) / 2;
     }
+
+    /*-----------------------------------------------------*\
+    | Convert the layout into pixel rectangles              |
+    \*-----------------------------------------------------*/
+    led_rects.resize(led_pos.size());
+    zone_rects.resize(zone_pos.size());
+
+    for(std::size_t led_idx = 0; led_idx < led_pos.size(); led_idx++)
+    {
+        int posx = led_pos[led_idx].matrix_x * size + offset_x;
+        int posy = led_pos[led_idx].matrix_y * size;
+        int posw = led_pos[led_idx].matrix_w * size;
+        int posh = led_pos[led_idx].matrix_h * size;
+
+        led_rects[led_idx] = QRect(posx, posy, posw, posh);
+    }
+
+    for(std::size_t zone_idx = 0; zone_idx < zone_pos.size(); zone_idx++)
+    {
+        int posx = zone_pos[zone_idx].matrix_x * size + offset_x;
+        int posy = zone_pos[zone_idx].matrix_y * size;
+        int posw = zone_pos[zone_idx].matrix_w * size;
+        int posh = zone_pos[zone_idx].matrix_h * size;
+
+        zone_rects[zone_idx] = QRect(posx, posy, posw, posh);
+    }
+
+    /*-----------------------------------------------------*\
+    | Lay out the LED labels once, centered in each LED     |
+    \*-----------------------------------------------------*/
+    QFont font = this->font();
+
+    led_label_text.resize(led_labels.size());
+    led_label_pos.resize(led_labels.size());
+    led_label_size.resize(led_labels.size());
+
+    for(std::size_t led_idx = 0; led_idx < led_labels.size(); led_idx++)
+    {
+        led_label_size[led_idx] = std::max(led_rects[led_idx].height() / 2, 1);
+        font.setPixelSize(led_label_size[led_idx]);
+
+        led_label_text[led_idx].setText(led_labels[led_idx]);
+        led_label_text[led_idx].setPerformanceHint(QStaticText::AggressiveCaching);
+        led_label_text[led_idx].prepare(QTransform(), font);
+
+        QSizeF label_size = led_label_text[led_idx].size();
+
+        led_label_pos[led_idx] = QPointF(led_rects[led_idx].center().x() - (label_size.width()  / 2),
+                                         led_rects[led_idx].center().y() - (label_size.height() / 2));
+    }
+
+    /*-----------------------------------------------------*\
+    | Render the static layer (zone names) once per resize, |
+    | rounding up so fractional scale factors keep the last |
+    | device pixel row and column                           |
+    \*-----------------------------------------------------*/
+    qreal pixel_ratio = devicePixelRatioF();
+
+    static_layer = QPixmap(qCeil(std::max(width(), 1) * pixel_ratio), qCeil(std::max(height(), 1) * pixel_ratio));
+    static_layer.setDevicePixelRatio(pixel_ratio);
+    static_layer.fill(Qt::transparent);
+
+    if(controller != NULL)
+    {
+        QPainter painter(&static_layer);
+
+        font.setPixelSize(12);
+        painter.setFont(font);
+        painter.setPen(palette().windowText().color());
+
+        for(std::size_t zone_idx = 0; zone_idx < zone_rects.size(); zone_idx++)
+        {
+            painter.drawText(zone_rects[zone_idx].bottomLeft() + QPoint(0, 1), QString(controller->zones[zone_idx].name.c_str()));
+        }
+    }
+
+    /*-----------------------------------------------------*\
+    | Force every LED to be considered dirty                |
+    \*-----------------------------------------------------*/
+    painted_colors.clear();
+}
+
+void DeviceView::updateColors()
+{
+    /*-----------------------------------------------------*\
+    | If the LED count changed, repaint everything          |
+    \*-----------------------------------------------------*/
+    if(controller == NULL || painted_colors.size() != controller->colors.size() || led_rects.size() != controller->colors.size())
+    {
+        if(controller != NULL)
+        {
+            painted_colors = controller->colors;
+        }
+
+        update();
+        return;
+    }
+
+    /*-----------------------------------------------------*\
+    | Only invalidate the LEDs whose color changed          |
+    \*-----------------------------------------------------*/
+    QRegion dirty;
+
+    for(std::size_t led_idx = 0; led_idx < painted_colors.size(); led_idx++)
+    {
+        if(painted_colors[led_idx] != controller->colors[led_idx])
+        {
+            painted_colors[led_idx] = controller->colors[led_idx];
+            dirty += led_rects[led_idx].adjusted(-1, -1, 1, 1);
+        }
+    }
+
+    if(!dirty.isEmpty())
+    {
+        update(dirty);
+    }
 }
 
 QSize DeviceView::sizeHint () const
@@ -401,25 +555,9 @@ void DeviceView::mouseReleaseEvent(QMouseEvent* event)
     \*-----------------------------------------------------*/
     if(!mouseMoved)
     {
-        int size     = width();
-        int offset_x = 0;
-
-        if(height() < size * matrix_h)
+        for(std::size_t zone_idx = 0; zone_idx < zone_rects.size(); zone_idx++)
         {
-            size     = height() / matrix_h;
-            offset_x = (width() - size) / 2;
-        }
-
-        for(std::size_t zone_idx = 0; zone_idx < controller->zones.size(); zone_idx++)
-        {
-            int posx = zone_pos[zone_idx].matrix_x * size + offset_x;
-            int posy = zone_pos[zone_idx].matrix_y * size;
-            int posw = zone_pos[zone_idx].matrix_w * size;
-            int posh = zone_pos[zone_idx].matrix_h * size;
-
-            QRect rect = {posx, posy, posw, posh};
-
-            if(rect.contains(event->pos()))
+            if(zone_rects[zone_idx].contains(event->pos()))
             {
                 selectZone(zone_idx, ctrlDown);
             }
@@ -430,18 +568,11 @@ void DeviceView::mouseReleaseEvent(QMouseEvent* event)
 
 void DeviceView::resizeEvent(QResizeEvent* /*event*/)
 {
-    size     = width();
-    offset_x = 0;
-
-    if(height() < size * matrix_h)
-    {
-        size     = height() / matrix_h;
-        offset_x = (width() - size) / 2;
-    }
+    updateCache();
     update();
 }
 
-void DeviceView::paintEvent(QPaintEvent* /* event */)
+void DeviceView::paintEvent(QPaintEvent* event)
 {
     QPainter painter(this);
     QFont font = painter.font();
@@ -462,25 +593,38 @@ void DeviceView::paintEvent(QPaintEvent* /* event */)
         setController(controller);
     }
 
+    QRect dirty_rect = event->rect();
+
     /*-----------------------------------------------------*\
-    | LED rectangles                                        |
+    | Static layer                                          |
     \*-----------------------------------------------------*/
+    painter.drawPixmap(0, 0, static_layer);
+
+    /*-----------------------------------------------------*\
+    | LED rectangles, only those inside the dirty region    |
+    \*-----------------------------------------------------*/
+    QPen    border_pen      = palette().dark().color();
+    QPen    selected_pen    = palette().highlight().color();
+    int     font_size       = -1;
+
     for(std::size_t led_idx = 0; led_idx < controller->leds.size(); led_idx++)
     {
-        int posx = led_pos[led_idx].matrix_x * size + offset_x;
-        int posy = led_pos[led_idx].matrix_y * size;
-        int posw = led_pos[led_idx].matrix_w * size;
-        int posh = led_pos[led_idx].matrix_h * size;
+        const QRect& rect = led_rects[led_idx];
 
-        QRect rect = {posx, posy, posw, posh};
+        if(!dirty_rect.intersects(rect.adjusted(-1, -1, 1, 1)))
+        {
+            continue;
+        }
 
         /*-----------------------------------------------------*\
         | Fill color                                            |
         \*-----------------------------------------------------*/
+        RGBColor color = controller->colors[led_idx];
+
         QColor currentColor = QColor::fromRgb(
-                    RGBGetRValue(controller->colors[led_idx]),
-                    RGBGetGValue(controller->colors[led_idx]),
-                    RGBGetBValue(controller->colors[led_idx]));
+                    RGBGetRValue(color),
+                    RGBGetGValue(color),
+                    RGBGetBValue(color));
         painter.setBrush(currentColor);
 
         /*-----------------------------------------------------*\
@@ -488,11 +632,11 @@ void DeviceView::paintEvent(QPaintEvent* /* event */)
         \*-----------------------------------------------------*/
         if(selectionFlags[led_idx])
         {
-            painter.setPen(palette().highlight().color());
+            painter.setPen(selected_pen);
         }
         else
         {
-            painter.setPen(palette().dark().color());
+            painter.setPen(border_pen);
         }
         painter.drawRect(rect);
 
@@ -500,8 +644,17 @@ void DeviceView::paintEvent(QPaintEvent* /* event */)
         | Label                                                 |
         | Set the font color so that the text is visible        |
         \*-----------------------------------------------------*/
-        font.setPixelSize(posh / 2);
-        painter.setFont(font);
+        if(led_labels[led_idx].isEmpty())
+        {
+            continue;
+        }
+
+        if(led_label_size[led_idx] != font_size)
+        {
+            font_size = led_label_size[led_idx];
+            font.setPixelSize(font_size);
+            painter.setFont(font);
+        }
 
         unsigned int luma = (unsigned int)(0.2126f * currentColor.red() + 0.7152f * currentColor.green() + 0.0722f * currentColor.blue());
 
@@ -513,33 +666,25 @@ void DeviceView::paintEvent(QPaintEvent* /* event */)
         {
             painter.setPen(Qt::white);
         }
-        painter.drawText(rect, Qt::AlignVCenter | Qt::AlignHCenter, QString(led_labels[led_idx]));
+        painter.drawStaticText(led_label_pos[led_idx], led_label_text[led_idx]);
     }
 
+    /*-----------------------------------------------------*\
+    | Highlight the zone name under the mouse, the others   |
+    | are part of the static layer                          |
+    \*-----------------------------------------------------*/
     font.setPixelSize(12);
     painter.setFont(font);
 
-    /*-----------------------------------------------------*\
-    | Zone names                                            |
-    \*-----------------------------------------------------*/
     for(std::size_t zone_idx = 0; zone_idx < controller->zones.size(); zone_idx++)
     {
-        int posx = zone_pos[zone_idx].matrix_x * size + offset_x;
-        int posy = zone_pos[zone_idx].matrix_y * size;
-        int posw = zone_pos[zone_idx].matrix_w * size;
-        int posh = zone_pos[zone_idx].matrix_h * size;
-
-        QRect rect = {posx, posy, posw, posh};
+        const QRect& rect = zone_rects[zone_idx];
 
         if(rect.contains(lastMousePos) && (!mouseDown || !mouseMoved))
         {
             painter.setPen(palette().highlight().color());
+            painter.drawText(rect.bottomLeft() + QPoint(0, 1), QString(controller->zones[zone_idx].name.c_str()));
         }
-        else
-        {
-            painter.setPen(palette().windowText().color());
-        }
-        painter.drawText(posx, posy + posh, QString(controller->zones[zone_idx].name.c_str()));
     }
 
     /*-----------------------------------------------------*\
@@ -571,16 +716,9 @@ void DeviceView::updateSelection()
         /*-----------------------------------------------------*\
         | Check intersection                                    |
         \*-----------------------------------------------------*/
-        int posx = led_pos[led_idx].matrix_x * size + offset_x;
-        int posy = led_pos[led_idx].matrix_y * size;
-        int posw = led_pos[led_idx].matrix_w * size;
-        int posh = led_pos[led_idx].matrix_h * size;
-
-        QRect rect = {posx, posy, posw, posh};
-
         selectionFlags[led_idx] = 0;
 
-        if(sel.intersects(rect))
+        if(sel.intersects(led_rects[led_idx]))
         {
             selectionFlags[led_idx] = 1;
         }
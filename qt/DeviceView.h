@@ -2,6 +2,8 @@
 #define DEVICEVIEW_H
 
 #include <QWidget>
+#include <QPixmap>
+#include <QStaticText>
 #include "RGBController.h"
 
 typedef struct
@@ -22,6 +24,7 @@ public:
     virtual QSize minimumSizeHint () const;
 
     void setController(RGBController * controller_ptr);
+    void updateColors();
 
 protected:
     void mousePressEvent(QMouseEvent *event);
@@ -50,6 +53,19 @@ private:
 
     float                               matrix_h;
 
+    /*-----------------------------------------------------*\
+    | Rendering cache, rebuilt by updateCache on resize     |
+    \*-----------------------------------------------------*/
+    std::vector<QRect>                  led_rects;
+    std::vector<QRect>                  zone_rects;
+    std::vector<QStaticText>            led_label_text;
+    std::vector<QPointF>                led_label_pos;
+    std::vector<int>                    led_label_size;
+    std::vector<RGBColor>               painted_colors;
+    QPixmap                             static_layer;
+
+    void updateCache();
+
     RGBController* controller;
 
 	QColor posColor(const QPoint &point);
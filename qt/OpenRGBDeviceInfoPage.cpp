@@ -15,9 +15,62 @@ OpenRGBDeviceInfoPage::OpenRGBDeviceInfoPage(RGBController *dev, QWidget *parent
     ui->VersionValue->setText(QString::fromStdString(dev->version));
     ui->LocationValue->setText(QString::fromStdString(dev->location));
     ui->SerialValue->setText(QString::fromStdString(dev->serial));
+
+    /*-----------------------------------------------------*\
+    | Refresh the update statistics once per second         |
+    \*-----------------------------------------------------*/
+    device      = dev;
+    stats_timer = new QTimer(this);
+
+    connect(stats_timer, SIGNAL(timeout()), this, SLOT(UpdateStats()));
+    stats_timer->start(1000);
+
+    ui->StatsValue->setText("");
 }
 
 OpenRGBDeviceInfoPage::~OpenRGBDeviceInfoPage()
 {
     delete ui;
 }
+
+void OpenRGBDeviceInfoPage::UpdateStats()
+{
+    /*-----------------------------------------------------*\
+    | Network devices query the server for their stats, so  |
+    | only refresh while the page is actually shown         |
+    \*-----------------------------------------------------*/
+    if(!isVisible())
+    {
+        return;
+    }
+
+    RGBControllerStatsSnapshot stats = device->GetStats();
+
+    QString stats_text;
+
+    stats_text += QString("LED updates: %1, mode updates: %2 (%3 unchanged, skipped)\n").arg(stats.update_leds_count).arg(stats.update_mode_count).arg(stats.update_mode_skipped);
+    stats_text += QString("Frames coalesced: %1, I/O errors: %2").arg(stats.frames_coalesced).arg(stats.io_errors);
+
+    if(stats.update_leds_count > 0)
+    {
+        stats_text += QString("\nQueue latency: avg %1us, p99 <%2us, max %3us")
+                        .arg(stats.queue_latency_total / stats.update_leds_count)
+                        .arg(RGBControllerStats::GetPercentile(stats.queue_latency_hist, 0.99))
+                        .arg(stats.queue_latency_max);
+
+        stats_text += QString("\nUpdate duration: avg %1us, p99 <%2us, max %3us")
+                        .arg(stats.update_leds_total / stats.update_leds_count)
+                        .arg(RGBControllerStats::GetPercentile(stats.update_leds_hist, 0.99))
+                        .arg(stats.update_leds_max);
+    }
+
+    if(stats.commit_count > 0)
+    {
+        stats_text += QString("\nCommit skew: avg %1us, p99 <%2us, max %3us")
+                        .arg(stats.commit_skew_total / stats.commit_count)
+                        .arg(RGBControllerStats::GetPercentile(stats.commit_skew_hist, 0.99))
+                        .arg(stats.commit_skew_max);
+    }
+
+    ui->StatsValue->setText(stats_text);
+}
@@ -2,6 +2,7 @@
 #define OPENRGBDEVICEINFOPAGE_H
 
 #include <QFrame>
+#include <QTimer>
 #include "RGBController.h"
 #include "ui_OpenRGBDeviceInfoPage.h"
 
@@ -17,8 +18,13 @@ public:
     explicit OpenRGBDeviceInfoPage(RGBController *dev, QWidget *parent = nullptr);
     ~OpenRGBDeviceInfoPage();
 
+private slots:
+    void UpdateStats();
+
 private:
     Ui::OpenRGBDeviceInfoPageUi *ui;
+    RGBController               *device;
+    QTimer                      *stats_timer;
 };
 
 #endif // OPENRGBDEVICEINFOPAGE_H
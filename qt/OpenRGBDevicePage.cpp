@@ -8,7 +8,7 @@ static void UpdateCallback(void * this_ptr)
 {
     OpenRGBDevicePage * this_obj = (OpenRGBDevicePage *)this_ptr;
 
-    QMetaObject::invokeMethod(this_obj, "UpdateInterface", Qt::QueuedConnection);
+    this_obj->QueueUpdateInterface();
 }
 
 OpenRGBDevicePage::OpenRGBDevicePage(RGBController *dev, QWidget *parent) :
@@ -22,6 +22,22 @@ OpenRGBDevicePage::OpenRGBDevicePage(RGBController *dev, QWidget *parent) :
     \*-----------------------------------------------------*/
     device = dev;
 
+    /*-----------------------------------------------------*\
+    | Set up the repaint throttle.  Updates arriving within |
+    | one interval of the last repaint are held back by a   |
+    | single shot timer so at most one repaint happens per  |
+    | display frame.  A coarse timer may fire early, which  |
+    | would only re-arm it for the remaining millisecond    |
+    \*-----------------------------------------------------*/
+    UpdatePending = false;
+
+    UpdateTimer = new QTimer(this);
+    UpdateTimer->setSingleShot(true);
+    UpdateTimer->setTimerType(Qt::PreciseTimer);
+    connect(UpdateTimer, &QTimer::timeout, this, &OpenRGBDevicePage::UpdateInterface);
+
+    UpdateElapsed.start();
+
     /*-----------------------------------------------------*\
     | Register update callback with the device              |
     \*-----------------------------------------------------*/
@@ -280,7 +296,7 @@ void Ui::OpenRGBDevicePage::on_LEDBox_currentIndexChanged(int index)
                     {
                         if((unsigned int)index < device->zones[selected_zone].leds_count)
                         {
-                            color = device->zones[selected_zone].colors[index];
+                            color = device->GetLED(device->zones[selected_zone].start_idx + index);
                             updateColor = 1;
                             int globalIndex = device->zones[selected_zone].leds - &(device->leds[0]) + index;
                             if(!ui->LEDBox->signalsBlocked())
@@ -396,10 +412,47 @@ void Ui::OpenRGBDevicePage::on_DirectionBox_currentIndexChanged(int /*index*/)
     UpdateMode();
 }
 
+void Ui::OpenRGBDevicePage::QueueUpdateInterface()
+{
+    /*-----------------------------------------------------*\
+    | Called from the device thread.  Only queue a call to  |
+    | UpdateInterface if one is not already pending, so a   |
+    | fast stream of updates can't flood the event queue    |
+    \*-----------------------------------------------------*/
+    if(!UpdatePending.exchange(true))
+    {
+        QMetaObject::invokeMethod(this, "UpdateInterface", Qt::QueuedConnection);
+    }
+}
+
 void Ui::OpenRGBDevicePage::UpdateInterface()
 {
-    //UpdateModeUi();
-    ui->DeviceViewBox->repaint();
+    /*-----------------------------------------------------*\
+    | If the last repaint was less than one interval ago,   |
+    | defer until the interval has passed.  Leave the       |
+    | pending flag set so further updates are coalesced     |
+    \*-----------------------------------------------------*/
+    qint64 elapsed = UpdateElapsed.elapsed();
+
+    if(elapsed < DEVICE_PAGE_UPDATE_INTERVAL_MS)
+    {
+        if(!UpdateTimer->isActive())
+        {
+            UpdateTimer->start(DEVICE_PAGE_UPDATE_INTERVAL_MS - elapsed);
+        }
+        return;
+    }
+
+    UpdatePending = false;
+    UpdateElapsed.restart();
+
+    /*-----------------------------------------------------*\
+    | Hidden pages are painted when they are shown again    |
+    \*-----------------------------------------------------*/
+    if(ui->DeviceViewBox->isVisible())
+    {
+        ui->DeviceViewBox->updateColors();
+    }
 }
 
 void Ui::OpenRGBDevicePage::UpdateModeUi()
@@ -756,9 +809,10 @@ void Ui::OpenRGBDevicePage::UpdateMode()
             }
 
             /*-----------------------------------------------------*\
-            | Change device mode                                    |
+            | Change device mode, always sending it as the user may |
+            | be reselecting a mode the device has since lost       |
             \*-----------------------------------------------------*/
-            device->SetMode((unsigned int)current_mode);
+            device->SetMode((unsigned int)current_mode, true);
 
             if(device->modes[(unsigned int)current_mode].color_mode == MODE_COLORS_PER_LED)
             {
@@ -795,6 +849,7 @@ void Ui::OpenRGBDevicePage::SetCustomMode(unsigned char red, unsigned char green
     | Set the selected mode to the custom mode and update UI|
     \*-----------------------------------------------------*/
     device->SetCustomMode();
+    device->InvalidateMode();
     ui->ModeBox->blockSignals(true);
     ui->ModeBox->setCurrentIndex(device->active_mode);
     ui->ModeBox->blockSignals(false);
@@ -1007,7 +1062,7 @@ void Ui::OpenRGBDevicePage::updateDeviceView()
 
                     device->modes[selected_mode].colors[index] = color;
 
-                    device->UpdateMode();
+                    device->ForceUpdateMode();
                 }
                 break;
         }
@@ -1212,7 +1267,7 @@ void Ui::OpenRGBDevicePage::on_ApplyColorsButton_clicked()
 
                 device->modes[selected_mode].colors[index] = color;
 
-                device->UpdateMode();
+                device->ForceUpdateMode();
             }
             break;
     }
@@ -1224,6 +1279,6 @@ void Ui::OpenRGBDevicePage::on_SelectAllLEDsButton_clicked()
     {
         ui->LEDBox->setCurrentIndex(0);
         on_LEDBox_currentIndexChanged(0);
-        ui->DeviceViewBox->repaint();
+        ui->DeviceViewBox->update();
     }
 }
@@ -4,7 +4,15 @@
 #include "ui_OpenRGBDevicePage.h"
 #include "RGBController.h"
 
+#include <atomic>
 #include <QFrame>
+#include <QElapsedTimer>
+#include <QTimer>
+
+/*-----------------------------------------------------*\
+| Minimum interval between device view repaints, ~60Hz  |
+\*-----------------------------------------------------*/
+#define DEVICE_PAGE_UPDATE_INTERVAL_MS  16
 
 namespace Ui {
 class OpenRGBDevicePage;
@@ -26,6 +34,8 @@ public:
     void ShowDeviceView();
     void HideDeviceView();
 
+    void QueueUpdateInterface();
+
 private slots:
     void UpdateInterface();
 
@@ -67,6 +77,10 @@ private:
     bool InvertedSpeed    = false;
     bool MultipleSelected = false;
 
+    std::atomic<bool>   UpdatePending;
+    QElapsedTimer       UpdateElapsed;
+    QTimer*             UpdateTimer;
+
     void updateRGB();
     void updateHSV();
     void updateWheel();
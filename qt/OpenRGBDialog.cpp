@@ -125,6 +125,7 @@ void Ui::OpenRGBDialog::on_ButtonSetAll_clicked()
     for (std::size_t i = 0; i < controllers.size(); i++)
     {
         controllers[i]->SetCustomMode();
+        controllers[i]->InvalidateMode();
         controllers[i]->SetAllLEDs(color);
     }
 }
@@ -194,5 +195,5 @@ void Ui::OpenRGBDialog::on_ComboDevices_currentIndexChanged()
 
 void Ui::OpenRGBDialog::on_ComboModes_currentIndexChanged()
 {
-    controllers[ui->ComboDevices->currentIndex()]->SetMode(ui->ComboModes->currentIndex());
+    controllers[ui->ComboDevices->currentIndex()]->SetMode(ui->ComboModes->currentIndex(), true);
 }
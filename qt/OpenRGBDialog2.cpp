@@ -5,6 +5,7 @@
 #include "OpenRGBProfileSaveDialog.h"
 #include "ResourceManager.h"
 #include <QLabel>
+#include <algorithm>
 #include <QTabBar>
 #include <QMessageBox>
 #include <QCloseEvent>
@@ -62,11 +63,43 @@ static QString GetIconString(device_type type, bool dark)
     return filename;
 }
 
+static QLabel* CreateDeviceTabLabel(RGBController* controller, bool dark)
+{
+    /*-----------------------------------------------------*\
+    | Use Qt's HTML capabilities to display both icon and   |
+    | text in the tab label.  Choose icon based on device   |
+    | type and append device name string.                   |
+    \*-----------------------------------------------------*/
+    QString NewLabelString = "<html><table><tr><td width='30'><img src=':/";
+    NewLabelString += GetIconString(controller->type, dark);
+    NewLabelString += "' height='16' width='16'></td><td>" + QString::fromStdString(controller->name) + "</td></tr></table></html>";
+
+    QLabel *NewTabLabel = new QLabel();
+    NewTabLabel->setText(NewLabelString);
+    NewTabLabel->setIndent(20);
+    NewTabLabel->setGeometry(0, 0, 200, 20);
+
+    return(NewTabLabel);
+}
+
 static void UpdateInfoCallback(void * this_ptr)
 {
     OpenRGBDialog2 * this_obj = (OpenRGBDialog2 *)this_ptr;
 
-    QMetaObject::invokeMethod(this_obj, "on_ClientListUpdated", Qt::QueuedConnection);
+    this_obj->QueueClientListUpdated();
+}
+
+static void UpdateDeltaCallback(void * this_ptr, std::vector<RGBController*>& /*added*/, std::vector<RGBController*>& /*removed*/)
+{
+    OpenRGBDialog2 * this_obj = (OpenRGBDialog2 *)this_ptr;
+
+    /*-----------------------------------------------------*\
+    | Removed controllers stay allocated until the next     |
+    | refresh has dropped their pages and freed them.  The  |
+    | plain change callback that follows queues that        |
+    | refresh                                               |
+    \*-----------------------------------------------------*/
+    this_obj->MarkDeviceListDirty();
 }
 
 OpenRGBDialog2::OpenRGBDialog2(std::vector<i2c_smbus_interface *>& bus, std::vector<RGBController *>& control, ProfileManager* manager, QWidget *parent) : QMainWindow(parent), busses(bus), controllers(control), profile_manager(manager), ui(new OpenRGBDialog2Ui)
@@ -98,6 +131,18 @@ OpenRGBDialog2::OpenRGBDialog2(std::vector<i2c_smbus_interface *>& bus, std::vec
     ui->DetectionProgressBar->setFormat("");
     ui->DetectionProgressBar->setAlignment(Qt::AlignCenter);
 
+    /*-----------------------------------------------------*\
+    | Set up the device list refresh throttle               |
+    \*-----------------------------------------------------*/
+    ClientListUpdatePending = false;
+    DeviceListDirty         = false;
+
+    DeviceListTimer = new QTimer(this);
+    DeviceListTimer->setSingleShot(true);
+    connect(DeviceListTimer, &QTimer::timeout, this, &OpenRGBDialog2::UpdateDevicesList);
+
+    ResourceManager::get()->HoldRemovedControllers();
+    ResourceManager::get()->RegisterDeviceListDeltaCallback(UpdateDeltaCallback, this);
     ResourceManager::get()->RegisterDeviceListChangeCallback(UpdateInfoCallback, this);
 
     /*-----------------------------------------------------*\
@@ -249,7 +294,7 @@ void OpenRGBDialog2::AddClientTab()
         connect(ClientInfoPage,
                 SIGNAL(ClientListUpdated()),
                 this,
-                SLOT(on_ClientListUpdated()));
+                SLOT(on_DeviceListChanged()));
     }
 }
 
@@ -276,109 +321,139 @@ void OpenRGBDialog2::AddServerTab(NetworkServer* network_server)
     }
 }
 
-void OpenRGBDialog2::ClearDevicesList()
+void OpenRGBDialog2::QueueClientListUpdated()
 {
-    for(int tab_idx = 0; tab_idx < ui->InformationTabBar->count(); tab_idx++)
+    /*-----------------------------------------------------*\
+    | Called from the detection thread, which signals at    |
+    | least once per detector.  Only queue a call if one is |
+    | not already pending                                   |
+    \*-----------------------------------------------------*/
+    if(!ClientListUpdatePending.exchange(true))
     {
-        delete ui->DevicesTabBar->widget(tab_idx);
+        QMetaObject::invokeMethod(this, "on_ClientListUpdated", Qt::QueuedConnection);
     }
-    ui->DevicesTabBar->clear();
+}
 
-    for(int tab_idx = 0; tab_idx < ui->InformationTabBar->count(); tab_idx++)
-    {
-        delete ui->InformationTabBar->widget(tab_idx);
-    }
-    ui->InformationTabBar->clear();
+void OpenRGBDialog2::MarkDeviceListDirty()
+{
+    DeviceListDirty = true;
 }
 
-void OpenRGBDialog2::UpdateDevicesList()
+void OpenRGBDialog2::InsertDevicePages(std::size_t dev_idx)
 {
+    RGBController* controller = controllers[dev_idx];
+
     /*-----------------------------------------------------*\
-    | Clear on each update                                  |
+    | Create the device page                                |
     \*-----------------------------------------------------*/
-    ClearDevicesList();
+    OpenRGBDevicePage *NewPage = new OpenRGBDevicePage(controller);
+    ui->DevicesTabBar->insertTab(dev_idx, NewPage, "");
 
     /*-----------------------------------------------------*\
-    | Set up list of devices                                |
+    | Connect the page's Set All button to the Set All slot |
     \*-----------------------------------------------------*/
-    QTabBar *DevicesTabBar = ui->DevicesTabBar->tabBar();
+    connect(NewPage,
+            SIGNAL(SetAllDevices(unsigned char, unsigned char, unsigned char)),
+            this,
+            SLOT(on_SetAllDevices(unsigned char, unsigned char, unsigned char)));
 
-    for(std::size_t dev_idx = 0; dev_idx < controllers.size(); dev_idx++)
-    {
-        OpenRGBDevicePage *NewPage = new OpenRGBDevicePage(controllers[dev_idx]);
-        ui->DevicesTabBar->addTab(NewPage, "");
+    /*-----------------------------------------------------*\
+    | Connect the page's Resize signal to the Save Size slot|
+    \*-----------------------------------------------------*/
+    connect(NewPage,
+            SIGNAL(SaveSizeProfile()),
+            this,
+            SLOT(on_SaveSizeProfile()));
 
-        /*-----------------------------------------------------*\
-        | Connect the page's Set All button to the Set All slot |
-        \*-----------------------------------------------------*/
-        connect(NewPage,
-                SIGNAL(SetAllDevices(unsigned char, unsigned char, unsigned char)),
-                this,
-                SLOT(on_SetAllDevices(unsigned char, unsigned char, unsigned char)));
+    ui->DevicesTabBar->tabBar()->setTabButton(dev_idx, QTabBar::LeftSide, CreateDeviceTabLabel(controller, darkTheme));
 
-        /*-----------------------------------------------------*\
-        | Connect the page's Resize signal to the Save Size slot|
-        \*-----------------------------------------------------*/
-        connect(NewPage,
-                SIGNAL(SaveSizeProfile()),
-                this,
-                SLOT(on_SaveSizeProfile()));
+    /*-----------------------------------------------------*\
+    | Create the information page                           |
+    \*-----------------------------------------------------*/
+    OpenRGBDeviceInfoPage *NewInfoPage = new OpenRGBDeviceInfoPage(controller);
+    ui->InformationTabBar->insertTab(dev_idx, NewInfoPage, "");
 
-        /*-----------------------------------------------------*\
-        | Use Qt's HTML capabilities to display both icon and   |
-        | text in the tab label.  Choose icon based on device   |
-        | type and append device name string.                   |
-        \*-----------------------------------------------------*/
-        QString NewLabelString = "<html><table><tr><td width='30'><img src=':/";
-        NewLabelString += GetIconString(controllers[dev_idx]->type, darkTheme);
-        NewLabelString += "' height='16' width='16'></td><td>" + QString::fromStdString(controllers[dev_idx]->name) + "</td></tr></table></html>";
+    ui->InformationTabBar->tabBar()->setTabButton(dev_idx, QTabBar::LeftSide, CreateDeviceTabLabel(controller, darkTheme));
 
-        QLabel *NewTabLabel = new QLabel();
-        NewTabLabel->setText(NewLabelString);
-        NewTabLabel->setIndent(20);
-        NewTabLabel->setGeometry(0, 0, 200, 20);
+    device_page_controllers.insert(device_page_controllers.begin() + dev_idx, controller);
+}
 
-        DevicesTabBar->setTabButton(dev_idx, QTabBar::LeftSide, NewTabLabel);
-    }
+void OpenRGBDialog2::RemoveDevicePages(std::size_t page_idx)
+{
+    QWidget* device_page = ui->DevicesTabBar->widget(page_idx);
+    QWidget* info_page   = ui->InformationTabBar->widget(page_idx);
+
+    ui->DevicesTabBar->removeTab(page_idx);
+    ui->InformationTabBar->removeTab(page_idx);
+
+    delete device_page;
+    delete info_page;
+
+    device_page_controllers.erase(device_page_controllers.begin() + page_idx);
+}
+
+void OpenRGBDialog2::UpdateDevicesList()
+{
+    DeviceListDirty = false;
+
+    ResourceManager::get()->GetRGBControllersMutex().lock();
 
     /*-----------------------------------------------------*\
-    | Set up list of information                            |
+    | Remove the pages of controllers that are no longer in |
+    | the list                                              |
     \*-----------------------------------------------------*/
-    QTabBar *InformationTabBar = ui->InformationTabBar->tabBar();
+    for(std::size_t page_idx = device_page_controllers.size(); page_idx > 0; page_idx--)
+    {
+        if(std::find(controllers.begin(), controllers.end(), device_page_controllers[page_idx - 1]) == controllers.end())
+        {
+            RemoveDevicePages(page_idx - 1);
+        }
+    }
 
+    /*-----------------------------------------------------*\
+    | Walk the controller list.  Existing pages are kept,   |
+    | moved if their controller moved, and pages are only   |
+    | created for new controllers                           |
+    \*-----------------------------------------------------*/
     for(std::size_t dev_idx = 0; dev_idx < controllers.size(); dev_idx++)
     {
-        OpenRGBDeviceInfoPage *NewPage = new OpenRGBDeviceInfoPage(controllers[dev_idx]);
-        ui->InformationTabBar->addTab(NewPage, "");
+        if((dev_idx < device_page_controllers.size()) && (device_page_controllers[dev_idx] == controllers[dev_idx]))
+        {
+            continue;
+        }
 
-        /*-----------------------------------------------------*\
-        | Use Qt's HTML capabilities to display both icon and   |
-        | text in the tab label.  Choose icon based on device   |
-        | type and append device name string.                   |
-        \*-----------------------------------------------------*/
-        QString NewLabelString = "<html><table><tr><td width='30'><img src=':/";
-        NewLabelString += GetIconString(controllers[dev_idx]->type, darkTheme);
-        NewLabelString += "' height='16' width='16'></td><td>" + QString::fromStdString(controllers[dev_idx]->name) + "</td></tr></table></html>";
+        std::vector<RGBController *>::iterator existing = std::find(device_page_controllers.begin() + dev_idx, device_page_controllers.end(), controllers[dev_idx]);
 
-        QLabel *NewTabLabel = new QLabel();
-        NewTabLabel->setText(NewLabelString);
-        NewTabLabel->setIndent(20);
-        NewTabLabel->setGeometry(0, 0, 200, 20);
+        if(existing != device_page_controllers.end())
+        {
+            int page_idx = existing - device_page_controllers.begin();
 
-        InformationTabBar->setTabButton(dev_idx, QTabBar::LeftSide, NewTabLabel);
+            ui->DevicesTabBar->tabBar()->moveTab(page_idx, dev_idx);
+            ui->InformationTabBar->tabBar()->moveTab(page_idx, dev_idx);
+
+            device_page_controllers.erase(existing);
+            device_page_controllers.insert(device_page_controllers.begin() + dev_idx, controllers[dev_idx]);
+        }
+        else
+        {
+            InsertDevicePages(dev_idx);
+        }
     }
 
     /*-----------------------------------------------------*\
-    | Add the Software Info page                            |
+    | No page points at a removed controller any more       |
     \*-----------------------------------------------------*/
-    AddSoftwareInfoPage();
+    ResourceManager::get()->FreeRemovedControllers();
+
+    ResourceManager::get()->GetRGBControllersMutex().unlock();
 
     /*-----------------------------------------------------*\
-    | Add the SMBus Tools page if enabled                   |
+    | Add the Software Info page after the device pages.    |
+    | The SMBus Tools page, if enabled, is added after it   |
     \*-----------------------------------------------------*/
-    if(ShowI2CTools)
+    if(SoftInfoPage == NULL)
     {
-        AddI2CToolsPage();
+        AddSoftwareInfoPage();
     }
 }
 
@@ -458,13 +533,36 @@ void OpenRGBDialog2::on_QuickWhite()
 
 void OpenRGBDialog2::on_ClientListUpdated()
 {
-    UpdateDevicesList();
+    ClientListUpdatePending = false;
+
+    /*-----------------------------------------------------*\
+    | Only touch the device pages if the list changed       |
+    \*-----------------------------------------------------*/
+    if(DeviceListDirty.load() && !DeviceListTimer->isActive())
+    {
+        DeviceListTimer->start(DEVICE_LIST_UPDATE_INTERVAL_MS);
+    }
 
     ui->DetectionProgressBar->setValue(ResourceManager::get()->GetDetectionPercent());
     ui->DetectionProgressBar->setFormat(QString::fromStdString(ResourceManager::get()->GetDetectionString()));
 
-    if(ResourceManager::get()->GetDetectionPercent() == 100)
+    if(ResourceManager::get()->GetDetectionPercent() != 100)
+    {
+        DetectionComplete = false;
+    }
+    else if(!DetectionComplete)
     {
+        DetectionComplete = true;
+
+        /*-----------------------------------------------------*\
+        | Zone sizes are loaded after the last detector, so     |
+        | refresh the pages that were created before that       |
+        \*-----------------------------------------------------*/
+        for(int device = 0; device < ui->DevicesTabBar->count(); device++)
+        {
+            qobject_cast<OpenRGBDevicePage *>(ui->DevicesTabBar->widget(device))->UpdateModeUi();
+        }
+
         ui->DetectionProgressBar->setVisible(false);
         ui->DetectionProgressLabel->setVisible(false);
         ui->ButtonStopDetection->setVisible(false);
@@ -477,6 +575,16 @@ void OpenRGBDialog2::on_ClientListUpdated()
     }
 }
 
+void OpenRGBDialog2::on_DeviceListChanged()
+{
+    MarkDeviceListDirty();
+
+    if(!DeviceListTimer->isActive())
+    {
+        DeviceListTimer->start(DEVICE_LIST_UPDATE_INTERVAL_MS);
+    }
+}
+
 void OpenRGBDialog2::on_SetAllDevices(unsigned char red, unsigned char green, unsigned char blue)
 {
     for(int device = 0; device < ui->DevicesTabBar->count(); device++)
@@ -492,7 +600,9 @@ void OpenRGBDialog2::on_SaveSizeProfile()
         /*---------------------------------------------------------*\
         | Save the profile                                          |
         \*---------------------------------------------------------*/
+        ResourceManager::get()->GetRGBControllersMutex().lock();
         profile_manager->SaveProfile("sizes.ors");
+        ResourceManager::get()->GetRGBControllersMutex().unlock();
     }
 }
 
@@ -518,9 +628,15 @@ void Ui::OpenRGBDialog2::on_ProfileSelected()
         std::string profile_name = QObject::sender()->objectName().toStdString();
 
         /*---------------------------------------------------------*\
-        | Load the profile                                          |
+        | Load the profile and queue it on every device             |
         \*---------------------------------------------------------*/
-        if(profile_manager->LoadProfile(profile_name))
+        ResourceManager::get()->GetRGBControllersMutex().lock();
+
+        bool activated = profile_manager->ActivateProfile(profile_name);
+
+        ResourceManager::get()->GetRGBControllersMutex().unlock();
+
+        if(activated)
         {
             for(int device = 0; device < ui->DevicesTabBar->count(); device++)
             {
@@ -549,7 +665,13 @@ void Ui::OpenRGBDialog2::on_ButtonSaveProfile_clicked()
         /*---------------------------------------------------------*\
         | Save the profile                                          |
         \*---------------------------------------------------------*/
-        if(profile_manager->SaveProfile(filename))
+        ResourceManager::get()->GetRGBControllersMutex().lock();
+
+        bool saved = profile_manager->SaveProfile(filename);
+
+        ResourceManager::get()->GetRGBControllersMutex().unlock();
+
+        if(saved)
         {
             UpdateProfileList();
         }
@@ -566,9 +688,15 @@ void Ui::OpenRGBDialog2::on_ButtonLoadProfile_clicked()
         std::string profile_name = ui->ProfileBox->currentText().toStdString();
 
         /*---------------------------------------------------------*\
-        | Load the profile                                          |
+        | Load the profile and queue it on every device             |
         \*---------------------------------------------------------*/
-        if(profile_manager->LoadProfile(profile_name))
+        ResourceManager::get()->GetRGBControllersMutex().lock();
+
+        bool activated = profile_manager->ActivateProfile(profile_name);
+
+        ResourceManager::get()->GetRGBControllersMutex().unlock();
+
+        if(activated)
         {
             for(int device = 0; device < ui->DevicesTabBar->count(); device++)
             {
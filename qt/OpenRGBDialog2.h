@@ -7,6 +7,7 @@
 #include "OpenRGBSoftwareInfoPage.h"
 #include "OpenRGBSystemInfoPage.h"
 
+#include <atomic>
 #include <vector>
 #include "i2c_smbus.h"
 #include "RGBController.h"
@@ -19,6 +20,11 @@
 #include <QSystemTrayIcon>
 #include <QMenu>
 
+/*-----------------------------------------------------*\
+| Minimum interval between device list refreshes, ~60Hz |
+\*-----------------------------------------------------*/
+#define DEVICE_LIST_UPDATE_INTERVAL_MS  16
+
 namespace Ui
 {
     class OpenRGBDialog2;
@@ -39,6 +45,9 @@ public:
 
     void setMode(unsigned char mode_val);
 
+    void QueueClientListUpdated();
+    void MarkDeviceListDirty();
+
 protected:
     std::vector<i2c_smbus_interface *>& busses;
     std::vector<RGBController *>&       controllers;
@@ -67,7 +76,21 @@ private:
 
     void AddSoftwareInfoPage();
 
-    void ClearDevicesList();
+    /*-------------------------------------*\
+    | Device pages.  Pages are kept per     |
+    | controller and only created, moved or |
+    | removed when the device list changes. |
+    | Refreshes are throttled to one per    |
+    | DEVICE_LIST_UPDATE_INTERVAL_MS        |
+    \*-------------------------------------*/
+    std::vector<RGBController *>        device_page_controllers;
+    std::atomic<bool>                   ClientListUpdatePending;
+    std::atomic<bool>                   DeviceListDirty;
+    QTimer*                             DeviceListTimer;
+    bool                                DetectionComplete = false;
+
+    void InsertDevicePages(std::size_t dev_idx);
+    void RemoveDevicePages(std::size_t page_idx);
     void UpdateDevicesList();
     void UpdateProfileList();
     void closeEvent(QCloseEvent *event);
@@ -86,6 +109,7 @@ private slots:
     void on_QuickMagenta();
     void on_QuickWhite();
     void on_ClientListUpdated();
+    void on_DeviceListChanged();
     void on_SetAllDevices(unsigned char red, unsigned char green, unsigned char blue);
     void on_SaveSizeProfile();
     void on_ShowHide();
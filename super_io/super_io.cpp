@@ -17,9 +17,235 @@
 #include <sys/types.h>
 #include <fcntl.h>
 
-int dev_port_fd;
+#if !defined(SUPERIO_MOCK) && (defined(__x86_64__) || defined(__i386__))
+#include <sys/io.h>
+#define SUPERIO_DIRECT_IO
 #endif
 
+#ifdef SUPERIO_MOCK
+#include <map>
+#include <vector>
+#endif
+
+/*-----------------------------------------------------*\
+| Session state.  session_fd is the /dev/port handle    |
+| kept open by an active session, session_direct is set |
+| when ioperm was granted for session_ioreg.  ioperm    |
+| only grants access to the calling thread and the fd   |
+| carries a seek position, so each thread has its own   |
+| session and other threads keep opening /dev/port per  |
+| access                                                |
+\*-----------------------------------------------------*/
+static thread_local int     session_count   = 0;
+static thread_local int     session_fd      = -1;
+static thread_local bool    session_direct  = false;
+static thread_local int     session_ioreg   = 0;
+#endif
+
+static superio_stats stats = { 0, 0, 0, 0, 0, 0 };
+
+#if !defined(WIN32)
+#ifdef SUPERIO_MOCK
+/******************************************************************************************\
+*                                                                                          *
+*   Fake port backend                                                                      *
+*                                                                                          *
+*   Models a Super IO index/data register pair at every address.  A write to ioreg        *
+*   selects the configuration register, a read or write to ioreg + 1 accesses it.         *
+*                                                                                          *
+\******************************************************************************************/
+
+#define SUPERIO_MOCK_FD     0x5E10
+
+static int                                  mock_position = 0;
+static std::map<int, unsigned char>         mock_index;
+static std::map<int, std::vector<unsigned char>> mock_config;
+
+static int port_open()
+{
+    stats.opens++;
+    return(SUPERIO_MOCK_FD);
+}
+
+static void port_close(int /*fd*/)
+{
+    stats.closes++;
+}
+
+static void port_seek(int /*fd*/, int port)
+{
+    stats.seeks++;
+    mock_position = port;
+}
+
+static void port_write(int /*fd*/, unsigned char val)
+{
+    stats.writes++;
+
+    if(mock_index.count(mock_position - 1))
+    {
+        std::vector<unsigned char>& config = mock_config[mock_position - 1];
+        config.resize(256);
+        config[mock_index[mock_position - 1]] = val;
+    }
+    else
+    {
+        mock_index[mock_position] = val;
+    }
+
+    mock_position++;
+}
+
+static unsigned char port_read(int /*fd*/)
+{
+    unsigned char val = 0;
+
+    stats.reads++;
+
+    if(mock_index.count(mock_position - 1))
+    {
+        std::vector<unsigned char>& config = mock_config[mock_position - 1];
+        config.resize(256);
+        val = config[mock_index[mock_position - 1]];
+    }
+
+    mock_position++;
+
+    return(val);
+}
+#else
+/******************************************************************************************\
+*                                                                                          *
+*   /dev/port backend                                                                      *
+*                                                                                          *
+\******************************************************************************************/
+
+static int port_open()
+{
+    stats.opens++;
+    return(open("/dev/port", O_RDWR, "rw"));
+}
+
+static void port_close(int fd)
+{
+    stats.closes++;
+    close(fd);
+}
+
+static void port_seek(int fd, int port)
+{
+    stats.seeks++;
+    lseek(fd, port, SEEK_SET);
+}
+
+static void port_write(int fd, unsigned char val)
+{
+    stats.writes++;
+    write(fd, &val, 1);
+}
+
+static unsigned char port_read(int fd)
+{
+    unsigned char val = 0;
+
+    stats.reads++;
+    read(fd, &val, 1);
+
+    return(val);
+}
+#endif
+
+/*-----------------------------------------------------*\
+| Get the handle for an access, either the session's    |
+| handle or a newly opened one                          |
+\*-----------------------------------------------------*/
+static int port_acquire()
+{
+    if(session_fd >= 0)
+    {
+        return(session_fd);
+    }
+
+    return(port_open());
+}
+
+static void port_release(int fd)
+{
+    if(fd != session_fd)
+    {
+        port_close(fd);
+    }
+}
+
+static bool port_direct(int ioreg)
+{
+    return(session_direct && (ioreg == session_ioreg));
+}
+#endif
+
+/******************************************************************************************\
+*                                                                                          *
+*   SuperIOSession                                                                         *
+*                                                                                          *
+*   Open the port I/O handle for the lifetime of the session                               *
+*                                                                                          *
+\******************************************************************************************/
+
+SuperIOSession::SuperIOSession(int ioreg)
+{
+#ifdef WIN32
+    (void)ioreg;
+#else
+    if(session_count++ > 0)
+    {
+        return;
+    }
+
+#ifdef SUPERIO_DIRECT_IO
+    /*-----------------------------------------------------*\
+    | Try to get direct access to the index/data pair       |
+    \*-----------------------------------------------------*/
+    if(ioperm(ioreg, 2, 1) == 0)
+    {
+        session_direct  = true;
+        session_ioreg   = ioreg;
+        return;
+    }
+#else
+    (void)ioreg;
+#endif
+
+    /*-----------------------------------------------------*\
+    | Fall back to keeping /dev/port open                   |
+    \*-----------------------------------------------------*/
+    session_fd = port_open();
+#endif
+}
+
+SuperIOSession::~SuperIOSession()
+{
+#ifndef WIN32
+    if(--session_count > 0)
+    {
+        return;
+    }
+
+#ifdef SUPERIO_DIRECT_IO
+    if(session_direct)
+    {
+        ioperm(session_ioreg, 2, 0);
+        session_direct = false;
+    }
+#endif
+
+    if(session_fd >= 0)
+    {
+        port_close(session_fd);
+        session_fd = -1;
+    }
+#endif
+}
+
 /******************************************************************************************\
 *                                                                                          *
 *   superio_enter                                                                          *
@@ -34,17 +260,26 @@ void superio_enter(int ioreg)
     Out32(ioreg, 0x87);
     Out32(ioreg, 0x87);
 #else
-    unsigned char temp = 0x87;
-    dev_port_fd = open("/dev/port", O_RDWR, "rw");
-    
+#ifdef SUPERIO_DIRECT_IO
+    if(port_direct(ioreg))
+    {
+        stats.direct_io += 2;
+        outb(0x87, ioreg);
+        outb(0x87, ioreg);
+        return;
+    }
+#endif
+
+    int dev_port_fd = port_acquire();
+
     if (dev_port_fd >= 0)
     {
-        lseek(dev_port_fd, ioreg, SEEK_SET);
-        write(dev_port_fd, &temp, 1);
-        lseek(dev_port_fd, ioreg, SEEK_SET);
-        write(dev_port_fd, &temp, 1);
-        close(dev_port_fd);
-    } 
+        port_seek(dev_port_fd, ioreg);
+        port_write(dev_port_fd, 0x87);
+        port_seek(dev_port_fd, ioreg);
+        port_write(dev_port_fd, 0x87);
+        port_release(dev_port_fd);
+    }
 #endif
 }
 
@@ -63,14 +298,24 @@ void superio_outb(int ioreg, int reg, int val)
     Out32(ioreg, reg);
     Out32(ioreg + 1, val);
 #else
-    dev_port_fd = open("/dev/port", O_RDWR, "rw");
-    
+#ifdef SUPERIO_DIRECT_IO
+    if(port_direct(ioreg))
+    {
+        stats.direct_io += 2;
+        outb(reg, ioreg);
+        outb(val, ioreg + 1);
+        return;
+    }
+#endif
+
+    int dev_port_fd = port_acquire();
+
     if (dev_port_fd >= 0)
     {
-        lseek(dev_port_fd, ioreg, SEEK_SET);
-        write(dev_port_fd, &reg, 1);
-        write(dev_port_fd, &val, 1);
-        close(dev_port_fd);
+        port_seek(dev_port_fd, ioreg);
+        port_write(dev_port_fd, reg);
+        port_write(dev_port_fd, val);
+        port_release(dev_port_fd);
     }
 #endif
 }
@@ -90,15 +335,23 @@ int superio_inb(int ioreg, int reg)
     Out32(ioreg, reg);
     return Inp32(ioreg + 1);
 #else
-    unsigned char temp = 0;
-    dev_port_fd = open("/dev/port", O_RDWR, "rw");
+#ifdef SUPERIO_DIRECT_IO
+    if(port_direct(ioreg))
+    {
+        stats.direct_io += 2;
+        outb(reg, ioreg);
+        return((int)inb(ioreg + 1));
+    }
+#endif
+
+    int dev_port_fd = port_acquire();
 
-    if (dev_port_fd >= 0)  
+    if (dev_port_fd >= 0)
     {
-        lseek(dev_port_fd, ioreg, SEEK_SET);
-        write(dev_port_fd, &reg, 1);
-        read(dev_port_fd, &temp, 1);
-        close(dev_port_fd);
+        port_seek(dev_port_fd, ioreg);
+        port_write(dev_port_fd, reg);
+        unsigned char temp = port_read(dev_port_fd);
+        port_release(dev_port_fd);
         return((int)temp);
     }
     else
@@ -107,3 +360,22 @@ int superio_inb(int ioreg, int reg)
     }
 #endif
 }
+
+
+/******************************************************************************************\
+*                                                                                          *
+*   superio_get_stats / superio_reset_stats                                                *
+*                                                                                          *
+*   Read and clear the port access counters                                                *
+*                                                                                          *
+\******************************************************************************************/
+
+superio_stats superio_get_stats()
+{
+    return(stats);
+}
+
+void superio_reset_stats()
+{
+    stats = { 0, 0, 0, 0, 0, 0 };
+}
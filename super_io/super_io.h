@@ -6,6 +6,8 @@
 |  Adam Honse (CalcProgrammer1) 2/11/2020   |
 \*-----------------------------------------*/
 
+#pragma once
+
 /******************************************************************************************\
 *                                                                                          *
 *   Nuvoton Super IO constants                                                             *
@@ -30,3 +32,44 @@ void superio_enter(int ioreg);
 void superio_outb(int ioreg, int reg, int val);
 
 int superio_inb(int ioreg, int reg);
+
+/******************************************************************************************\
+*                                                                                          *
+*   Super IO session                                                                       *
+*                                                                                          *
+*   Keeps the port I/O handle open across a sequence of register accesses.  On Linux this  *
+*   uses ioperm with direct inb/outb when permitted, otherwise /dev/port is opened once    *
+*   for the lifetime of the session instead of once per access.  Sessions may be nested.   *
+*   A session only applies to the thread that created it and must be destroyed there.      *
+*                                                                                          *
+\******************************************************************************************/
+
+class SuperIOSession
+{
+public:
+    SuperIOSession(int ioreg);
+    ~SuperIOSession();
+};
+
+/******************************************************************************************\
+*                                                                                          *
+*   Port access statistics                                                                 *
+*                                                                                          *
+*   Counts the system calls made by the Super IO functions.  Building with SUPERIO_MOCK    *
+*   replaces /dev/port with an in-memory fake so these can be measured without hardware.   *
+*                                                                                          *
+\******************************************************************************************/
+
+typedef struct
+{
+    unsigned int    opens;
+    unsigned int    closes;
+    unsigned int    seeks;
+    unsigned int    reads;
+    unsigned int    writes;
+    unsigned int    direct_io;
+} superio_stats;
+
+superio_stats superio_get_stats();
+
+void superio_reset_stats();
@@ -0,0 +1,69 @@
+#!/bin/bash
+
+#-----------------------------------------------------------------------#
+# OpenRGB Tool Build Script                                             #
+#                                                                       #
+# Builds the standalone tests in tools/<name>/<name>.cpp against the    #
+# RGBController sources.  Tools with a .pro file use Qt and are built   #
+# with qmake instead.  Set CXXFLAGS to build with a sanitizer, e.g.     #
+#                                                                       #
+#   CXXFLAGS="-O1 -g -fsanitize=thread" tools/build.sh build-tsan       #
+#                                                                       #
+#   tools/build.sh [build dir] [tool name...]                           #
+#-----------------------------------------------------------------------#
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+ROOT_DIR=$(dirname "$TOOLS_DIR")
+BUILD_DIR=${1:-build}
+shift || true
+
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:--O2 -g}
+
+INCLUDES="-I$ROOT_DIR -I$ROOT_DIR/RGBController"
+
+#-----------------------------------------------------------------------#
+# Sources needed by a controller without any detectors                  #
+#-----------------------------------------------------------------------#
+CORE_SOURCES="
+    RGBController/RGBController.cpp
+    RGBController/RGBControllerStats.cpp
+    RGBController/RGBColorTransform.cpp
+    RGBController/RGBController_Dummy.cpp
+    RGBController/RGBDescriptionCodec.cpp
+    RGBController/RGBOutputStage.cpp
+"
+
+LIBS="-lpthread"
+
+mkdir -p "$BUILD_DIR"
+
+#-----------------------------------------------------------------------#
+# Build the core sources once and link every tool against them          #
+#-----------------------------------------------------------------------#
+CORE_OBJECTS=""
+
+for SOURCE in $CORE_SOURCES; do
+    OBJECT="$BUILD_DIR/$(echo "$SOURCE" | tr '/' '_' | sed 's/\.cpp$/.o/')"
+
+    $CXX -std=c++17 $CXXFLAGS $INCLUDES -c "$ROOT_DIR/$SOURCE" -o "$OBJECT"
+
+    CORE_OBJECTS="$CORE_OBJECTS $OBJECT"
+done
+
+if [ $# -eq 0 ]; then
+    for TOOL_PATH in "$TOOLS_DIR"/*/; do
+        TOOL=$(basename "$TOOL_PATH")
+
+        if [ ! -f "$TOOL_PATH/$TOOL.pro" ]; then
+            set -- "$@" "$TOOL"
+        fi
+    done
+fi
+
+for TOOL in "$@"; do
+    echo "Building $TOOL"
+    $CXX -std=c++17 $CXXFLAGS $INCLUDES "$TOOLS_DIR/$TOOL/$TOOL.cpp" $CORE_OBJECTS $LIBS -o "$BUILD_DIR/$TOOL"
+done
@@ -0,0 +1,433 @@
+/*-----------------------------------------*\
+|  color_transform_test.cpp                 |
+|                                           |
+|  Checks every RGBColorTransform routine   |
+|  against a plain per-color reference over |
+|  all 256 values of each channel, every    |
+|  order, brightness and lookup table, and  |
+|  every length around the vector widths    |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "RGBColorTransform.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#define TEST_CHUNK          65536
+#define TEST_MAX_LENGTH     69
+#define TEST_MAX_OFFSET     4
+#define TEST_GUARD          16
+#define TEST_GUARD_BYTE     0xA5
+#define TEST_SEED           1234
+
+static int failures = 0;
+
+/*---------------------------------------------------------*\
+| Output order of each RGB_ORDER_* value, spelled out so    |
+| the reference does not share the transform's tables       |
+\*---------------------------------------------------------*/
+static const char* order_names[6] =
+{
+    "RGB",
+    "RBG",
+    "GRB",
+    "GBR",
+    "BRG",
+    "BGR",
+};
+
+static void Fail(const char* test, const char* detail, unsigned int value)
+{
+    if(failures < 20)
+    {
+        printf("FAIL: %s %s %u\n", test, detail, value);
+    }
+
+    failures++;
+}
+
+static unsigned char RefChannel(RGBColor color, char channel)
+{
+    switch(channel)
+    {
+        case 'R':
+            return(RGBGetRValue(color));
+
+        case 'G':
+            return(RGBGetGValue(color));
+
+        default:
+            return(RGBGetBValue(color));
+    }
+}
+
+/*---------------------------------------------------------*\
+| c * brightness / 255 rounded to nearest.  2 * c * b is    |
+| even and 255 is odd, so there are no ties to break        |
+\*---------------------------------------------------------*/
+static unsigned char RefScale(unsigned int c, unsigned int brightness)
+{
+    return((unsigned char)(((2 * c * brightness) + 255) / 510));
+}
+
+/*---------------------------------------------------------*\
+| Colors where each channel takes every value from 0 to 255 |
+| at a different position, with a varying unused top byte   |
+| that the routines must ignore                             |
+\*---------------------------------------------------------*/
+static std::vector<RGBColor> ChannelSweep()
+{
+    std::vector<RGBColor> colors;
+
+    for(unsigned int value = 0; value < 256; value++)
+    {
+        RGBColor color = ToRGBColor(value, (value + 85) & 0xFF, (value + 170) & 0xFF);
+
+        colors.push_back(color | ((value * 37) << 24));
+    }
+
+    return(colors);
+}
+
+static bool GuardIntact(const std::vector<unsigned char>& buffer, std::size_t start)
+{
+    for(std::size_t idx = start; idx < buffer.size(); idx++)
+    {
+        if(buffer[idx] != TEST_GUARD_BYTE)
+        {
+            return(false);
+        }
+    }
+
+    return(true);
+}
+
+/*---------------------------------------------------------*\
+| Every 24-bit color through every order, in chunks large   |
+| enough to run the vector loops                            |
+\*---------------------------------------------------------*/
+static void TestBytesExhaustive()
+{
+    std::vector<RGBColor>       colors(TEST_CHUNK);
+    std::vector<unsigned char>  out(TEST_CHUNK * 3);
+
+    for(int order = RGB_ORDER_RGB; order <= RGB_ORDER_BGR; order++)
+    {
+        for(unsigned int base = 0; base < 0x01000000; base += TEST_CHUNK)
+        {
+            for(unsigned int idx = 0; idx < TEST_CHUNK; idx++)
+            {
+                colors[idx] = (base + idx) | ((idx & 0xFF) << 24);
+            }
+
+            RGBColorsToBytes(colors.data(), colors.size(), out.data(), order);
+
+            for(unsigned int idx = 0; idx < TEST_CHUNK; idx++)
+            {
+                for(int pos = 0; pos < 3; pos++)
+                {
+                    if(out[(idx * 3) + pos] != RefChannel(colors[idx], order_names[order][pos]))
+                    {
+                        Fail("bytes", order_names[order], base + idx);
+                        return;
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void TestPlanarExhaustive()
+{
+    std::vector<RGBColor>       colors(TEST_CHUNK);
+    std::vector<unsigned char>  red(TEST_CHUNK);
+    std::vector<unsigned char>  grn(TEST_CHUNK);
+    std::vector<unsigned char>  blu(TEST_CHUNK);
+
+    for(unsigned int base = 0; base < 0x01000000; base += TEST_CHUNK)
+    {
+        for(unsigned int idx = 0; idx < TEST_CHUNK; idx++)
+        {
+            colors[idx] = (base + idx) | ((idx & 0xFF) << 24);
+        }
+
+        RGBColorsToPlanar(colors.data(), colors.size(), red.data(), grn.data(), blu.data());
+
+        for(unsigned int idx = 0; idx < TEST_CHUNK; idx++)
+        {
+            if((red[idx] != RGBGetRValue(colors[idx]))
+            || (grn[idx] != RGBGetGValue(colors[idx]))
+            || (blu[idx] != RGBGetBValue(colors[idx])))
+            {
+                Fail("planar", "color", base + idx);
+                return;
+            }
+        }
+    }
+}
+
+/*---------------------------------------------------------*\
+| Every length up to TEST_MAX_LENGTH at every start offset  |
+| within a vector, so each vector loop hands a different    |
+| tail to the scalar loop, and nothing is written past the  |
+| end of the output                                         |
+\*---------------------------------------------------------*/
+static void TestLengths()
+{
+    std::vector<RGBColor> sweep = ChannelSweep();
+
+    for(std::size_t offset = 0; offset < TEST_MAX_OFFSET; offset++)
+    {
+        for(std::size_t count = 0; count <= TEST_MAX_LENGTH; count++)
+        {
+            const RGBColor* colors = &sweep[offset * 17];
+
+            for(int order = RGB_ORDER_RGB; order <= RGB_ORDER_BGR; order++)
+            {
+                std::vector<unsigned char> out((count * 3) + offset + TEST_GUARD, TEST_GUARD_BYTE);
+
+                RGBColorsToBytes(colors, count, &out[offset], order);
+
+                for(std::size_t idx = 0; idx < (count * 3); idx++)
+                {
+                    if(out[offset + idx] != RefChannel(colors[idx / 3], order_names[order][idx % 3]))
+                    {
+                        Fail("bytes length", order_names[order], (unsigned int)count);
+                        break;
+                    }
+                }
+
+                if(!GuardIntact(out, offset + (count * 3)))
+                {
+                    Fail("bytes length overrun", order_names[order], (unsigned int)count);
+                }
+            }
+
+            std::vector<unsigned char> planar(((count + TEST_GUARD) * 3) + offset, TEST_GUARD_BYTE);
+            unsigned char* red = &planar[offset];
+            unsigned char* grn = red + count + TEST_GUARD;
+            unsigned char* blu = grn + count + TEST_GUARD;
+
+            RGBColorsToPlanar(colors, count, red, grn, blu);
+
+            for(std::size_t idx = 0; idx < count; idx++)
+            {
+                if((red[idx] != RGBGetRValue(colors[idx]))
+                || (grn[idx] != RGBGetGValue(colors[idx]))
+                || (blu[idx] != RGBGetBValue(colors[idx])))
+                {
+                    Fail("planar length", "count", (unsigned int)count);
+                    break;
+                }
+            }
+
+            for(std::size_t idx = 0; idx < TEST_GUARD; idx++)
+            {
+                if((red[count + idx] != TEST_GUARD_BYTE)
+                || (grn[count + idx] != TEST_GUARD_BYTE)
+                || (blu[count + idx] != TEST_GUARD_BYTE))
+                {
+                    Fail("planar length overrun", "count", (unsigned int)count);
+                    break;
+                }
+            }
+
+            std::vector<RGBColor> scaled(count + TEST_GUARD, 0xA5A5A5A5);
+
+            RGBColorsScale(colors, count, scaled.data(), 100);
+
+            for(std::size_t idx = 0; idx < count; idx++)
+            {
+                RGBColor expected = ToRGBColor(RefScale(RGBGetRValue(colors[idx]), 100),
+                                               RefScale(RGBGetGValue(colors[idx]), 100),
+                                               RefScale(RGBGetBValue(colors[idx]), 100));
+
+                if(scaled[idx] != expected)
+                {
+                    Fail("scale length", "count", (unsigned int)count);
+                    break;
+                }
+            }
+
+            for(std::size_t idx = count; idx < scaled.size(); idx++)
+            {
+                if(scaled[idx] != 0xA5A5A5A5)
+                {
+                    Fail("scale length overrun", "count", (unsigned int)count);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/*---------------------------------------------------------*\
+| Every brightness over every channel value, as one call    |
+| through the vector loop, one call per color through the   |
+| scalar loop, and in place                                 |
+\*---------------------------------------------------------*/
+static void TestScale()
+{
+    std::vector<RGBColor> sweep = ChannelSweep();
+
+    for(unsigned int brightness = 0; brightness < 256; brightness++)
+    {
+        std::vector<RGBColor> bulk(sweep.size());
+        std::vector<RGBColor> single(sweep.size());
+        std::vector<RGBColor> in_place = sweep;
+
+        RGBColorsScale(sweep.data(), sweep.size(), bulk.data(), (unsigned char)brightness);
+        RGBColorsScale(in_place.data(), in_place.size(), in_place.data(), (unsigned char)brightness);
+
+        for(std::size_t idx = 0; idx < sweep.size(); idx++)
+        {
+            RGBColorsScale(&sweep[idx], 1, &single[idx], (unsigned char)brightness);
+        }
+
+        for(std::size_t idx = 0; idx < sweep.size(); idx++)
+        {
+            RGBColor expected = ToRGBColor(RefScale(RGBGetRValue(sweep[idx]), brightness),
+                                           RefScale(RGBGetGValue(sweep[idx]), brightness),
+                                           RefScale(RGBGetBValue(sweep[idx]), brightness));
+
+            if(bulk[idx] != expected)
+            {
+                Fail("scale", "brightness", brightness);
+                break;
+            }
+
+            if(single[idx] != expected)
+            {
+                Fail("scale scalar", "brightness", brightness);
+                break;
+            }
+
+            if(in_place[idx] != expected)
+            {
+                Fail("scale in place", "brightness", brightness);
+                break;
+            }
+        }
+    }
+}
+
+/*---------------------------------------------------------*\
+| Lookup tables that pass through, invert, clamp to either  |
+| end, apply gamma, or are random, with the same and with   |
+| different tables per channel                              |
+\*---------------------------------------------------------*/
+static void TestLUT()
+{
+    std::vector<RGBColor>   sweep = ChannelSweep();
+    std::mt19937            rng(TEST_SEED);
+    unsigned char           tables[7][256];
+    const char*             table_names[7] = { "identity", "invert", "zero", "full", "gamma", "random a", "random b" };
+
+    for(unsigned int value = 0; value < 256; value++)
+    {
+        tables[0][value] = (unsigned char)value;
+        tables[1][value] = (unsigned char)(255 - value);
+        tables[2][value] = 0;
+        tables[3][value] = 255;
+        tables[4][value] = (unsigned char)(pow(value / 255.0, 2.2) * 255.0 + 0.5);
+        tables[5][value] = (unsigned char)(rng() & 0xFF);
+        tables[6][value] = (unsigned char)(rng() & 0xFF);
+    }
+
+    for(unsigned int red_idx = 0; red_idx < 7; red_idx++)
+    {
+        for(unsigned int grn_idx = 0; grn_idx < 7; grn_idx++)
+        {
+            for(unsigned int blu_idx = 0; blu_idx < 7; blu_idx++)
+            {
+                const unsigned char* lut_red = tables[red_idx];
+                const unsigned char* lut_grn = tables[grn_idx];
+                const unsigned char* lut_blu = tables[blu_idx];
+
+                std::vector<RGBColor> bulk(sweep.size());
+                std::vector<RGBColor> single(sweep.size());
+                std::vector<RGBColor> in_place = sweep;
+
+                RGBColorsApplyLUT(sweep.data(), sweep.size(), bulk.data(), lut_red, lut_grn, lut_blu);
+                RGBColorsApplyLUT(in_place.data(), in_place.size(), in_place.data(), lut_red, lut_grn, lut_blu);
+
+                for(std::size_t idx = 0; idx < sweep.size(); idx++)
+                {
+                    RGBColorsApplyLUT(&sweep[idx], 1, &single[idx], lut_red, lut_grn, lut_blu);
+                }
+
+                for(std::size_t idx = 0; idx < sweep.size(); idx++)
+                {
+                    RGBColor expected = ToRGBColor((unsigned int)lut_red[RGBGetRValue(sweep[idx])],
+                                                   (unsigned int)lut_grn[RGBGetGValue(sweep[idx])],
+                                                   (unsigned int)lut_blu[RGBGetBValue(sweep[idx])]);
+
+                    if((bulk[idx] != expected) || (single[idx] != expected) || (in_place[idx] != expected))
+                    {
+                        Fail("lut", table_names[red_idx], (unsigned int)idx);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void TestPlanarIndexed()
+{
+    std::vector<RGBColor>       sweep = ChannelSweep();
+    std::vector<unsigned int>   index(sweep.size());
+    std::mt19937                rng(TEST_SEED);
+
+    for(std::size_t idx = 0; idx < index.size(); idx++)
+    {
+        index[idx] = (unsigned int)idx;
+    }
+
+    std::shuffle(index.begin(), index.end(), rng);
+
+    std::vector<unsigned char> red(sweep.size());
+    std::vector<unsigned char> grn(sweep.size());
+    std::vector<unsigned char> blu(sweep.size());
+
+    RGBColorsToPlanarIndexed(sweep.data(), sweep.size(), index.data(), red.data(), grn.data(), blu.data());
+
+    for(std::size_t idx = 0; idx < sweep.size(); idx++)
+    {
+        if((red[index[idx]] != RGBGetRValue(sweep[idx]))
+        || (grn[index[idx]] != RGBGetGValue(sweep[idx]))
+        || (blu[index[idx]] != RGBGetBValue(sweep[idx])))
+        {
+            Fail("planar indexed", "color", (unsigned int)idx);
+            break;
+        }
+    }
+}
+
+int main()
+{
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    printf("Vector path: NEON\n");
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    printf("Vector path: SSE2%s\n", __builtin_cpu_supports("ssse3") ? ", SSSE3" : "");
+#else
+    printf("Vector path: none\n");
+#endif
+
+    TestBytesExhaustive();
+    TestPlanarExhaustive();
+    TestLengths();
+    TestScale();
+    TestLUT();
+    TestPlanarIndexed();
+
+    printf(failures == 0 ? "PASS\n" : "FAIL\n");
+
+    return(failures == 0 ? 0 : 1);
+}
@@ -0,0 +1,305 @@
+/*-----------------------------------------*\
+|  description_parser_test.cpp              |
+|                                           |
+|  Truncation, size boundary and mutation   |
+|  tests for ReadDeviceDescription in both  |
+|  formats.  Build with AddressSanitizer:   |
+|                                           |
+|  CXXFLAGS="-O1 -g -fsanitize=address"     |
+|      tools/build.sh build-asan            |
+|      description_parser_test              |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "RGBController_Dummy.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#define TEST_MUTATIONS      100000
+#define TEST_SEED           1234
+
+static int failures = 0;
+
+static void Fail(const char* format, const char* description, unsigned int value)
+{
+    printf("FAIL: %s ", description);
+    printf(format, value);
+    printf("\n");
+
+    failures++;
+}
+
+/*---------------------------------------------------------*\
+| A keyboard with a matrix zone and a linear zone, numbered |
+| LED names and modes with and without colors, so every     |
+| section of both formats is present                        |
+\*---------------------------------------------------------*/
+static RGBController_Dummy* CreateTestDevice()
+{
+    RGBController_Dummy* dummy = new RGBController_Dummy();
+
+    dummy->name         = "Parser Test Keyboard";
+    dummy->type         = DEVICE_TYPE_KEYBOARD;
+    dummy->description  = "Parser Test Device";
+    dummy->location     = "Parser Test Location";
+    dummy->version      = "1.0";
+    dummy->serial       = "PARSER0";
+
+    mode direct_mode = {};
+
+    direct_mode.name        = "Direct";
+    direct_mode.flags       = MODE_FLAG_HAS_PER_LED_COLOR;
+    direct_mode.color_mode  = MODE_COLORS_PER_LED;
+
+    dummy->modes.push_back(direct_mode);
+
+    mode wave_mode = {};
+
+    wave_mode.name          = "Wave";
+    wave_mode.value         = 3;
+    wave_mode.flags         = MODE_FLAG_HAS_SPEED | MODE_FLAG_HAS_MODE_SPECIFIC_COLOR;
+    wave_mode.speed_min     = 1;
+    wave_mode.speed_max     = 5;
+    wave_mode.speed         = 3;
+    wave_mode.colors_min    = 1;
+    wave_mode.colors_max    = 4;
+    wave_mode.color_mode    = MODE_COLORS_MODE_SPECIFIC;
+    wave_mode.colors        = { 0x000000FF, 0x0000FF00, 0x00FF0000 };
+
+    dummy->modes.push_back(wave_mode);
+
+    zone matrix_zone = {};
+
+    matrix_zone.name        = "Keyboard";
+    matrix_zone.type        = ZONE_TYPE_MATRIX;
+    matrix_zone.leds_min    = 12;
+    matrix_zone.leds_max    = 12;
+    matrix_zone.leds_count  = 12;
+    matrix_zone.matrix_map  = dummy->NewMatrixMap(3, 5);
+
+    for(unsigned int led_idx = 0; led_idx < 12; led_idx++)
+    {
+        matrix_zone.matrix_map->map[led_idx] = led_idx;
+    }
+
+    dummy->zones.push_back(matrix_zone);
+
+    zone linear_zone = {};
+
+    linear_zone.name        = "Underglow";
+    linear_zone.type        = ZONE_TYPE_LINEAR;
+    linear_zone.leds_min    = 0;
+    linear_zone.leds_max    = 20;
+    linear_zone.leds_count  = 8;
+    linear_zone.matrix_map  = NULL;
+
+    dummy->zones.push_back(linear_zone);
+
+    for(unsigned int led_idx = 0; led_idx < 12; led_idx++)
+    {
+        led new_led = {};
+
+        new_led.name    = "Key: " + std::string(1, (char)('A' + led_idx));
+        new_led.value   = led_idx;
+
+        dummy->leds.push_back(new_led);
+    }
+
+    for(unsigned int led_idx = 0; led_idx < 8; led_idx++)
+    {
+        led new_led = {};
+
+        new_led.name    = "Underglow LED " + std::to_string(led_idx);
+        new_led.value   = 100 + led_idx;
+
+        dummy->leds.push_back(new_led);
+    }
+
+    dummy->SetupColors();
+
+    for(unsigned int led_idx = 0; led_idx < dummy->colors.size(); led_idx++)
+    {
+        dummy->colors[led_idx] = ToRGBColor(led_idx, 255 - led_idx, 7);
+    }
+
+    dummy->active_mode = 1;
+
+    return(dummy);
+}
+
+static std::vector<unsigned char> TakeDescription(unsigned char* description)
+{
+    unsigned int description_size;
+
+    memcpy(&description_size, description, sizeof(description_size));
+
+    std::vector<unsigned char> bytes(description, description + description_size);
+
+    delete[] description;
+
+    return(bytes);
+}
+
+/*---------------------------------------------------------*\
+| Read size bytes from a heap copy of exactly that size, so |
+| the sanitizer catches any read past the end               |
+\*---------------------------------------------------------*/
+static bool ReadExact(RGBController* target, const unsigned char* data, unsigned int size)
+{
+    unsigned char*  copy    = new unsigned char[size > 0 ? size : 1];
+    bool            result;
+
+    memcpy(copy, data, size);
+
+    result = target->ReadDeviceDescription(size > 0 ? copy : NULL, size);
+
+    delete[] copy;
+
+    return(result);
+}
+
+static void TestFormat(const char* format_name, std::vector<unsigned char>& description, std::vector<unsigned char>& legacy_reference)
+{
+    RGBController_Dummy*        target      = new RGBController_Dummy();
+    unsigned int                size        = (unsigned int)description.size();
+    std::vector<unsigned char>  untouched;
+
+    /*---------------------------------------------------------*\
+    | A complete description reads and describes the device as |
+    | the original does                                         |
+    \*---------------------------------------------------------*/
+    if(!ReadExact(target, description.data(), size))
+    {
+        Fail("(%u bytes)", (std::string(format_name) + " full read failed").c_str(), size);
+    }
+    else if(TakeDescription(target->GetDeviceDescription()) != legacy_reference)
+    {
+        Fail("(%u bytes)", (std::string(format_name) + " round trip differs").c_str(), size);
+    }
+
+    untouched = TakeDescription(target->GetDeviceDescription());
+
+    /*---------------------------------------------------------*\
+    | Every shorter buffer, and every shorter size field with   |
+    | the full buffer, is rejected without changing the target  |
+    \*---------------------------------------------------------*/
+    for(unsigned int truncated = 0; truncated < size; truncated++)
+    {
+        if(ReadExact(target, description.data(), truncated))
+        {
+            Fail("at %u bytes", (std::string(format_name) + " truncated buffer accepted").c_str(), truncated);
+        }
+
+        std::vector<unsigned char> short_size = description;
+
+        memcpy(short_size.data(), &truncated, sizeof(truncated));
+
+        if(ReadExact(target, short_size.data(), size))
+        {
+            Fail("at %u bytes", (std::string(format_name) + " short size field accepted").c_str(), truncated);
+        }
+
+        if(TakeDescription(target->GetDeviceDescription()) != untouched)
+        {
+            Fail("at %u bytes", (std::string(format_name) + " rejected read changed the target").c_str(), truncated);
+            break;
+        }
+    }
+
+    /*---------------------------------------------------------*\
+    | Random byte changes either read or are rejected, never    |
+    | read out of bounds                                        |
+    \*---------------------------------------------------------*/
+    std::mt19937                        rng(TEST_SEED);
+    std::uniform_int_distribution<int>  byte_value(0, 255);
+    unsigned int                        accepted = 0;
+
+    for(unsigned int mutation_idx = 0; mutation_idx < TEST_MUTATIONS; mutation_idx++)
+    {
+        std::vector<unsigned char> mutated = description;
+        unsigned int               changes = 1 + (rng() % 4);
+
+        for(unsigned int change_idx = 0; change_idx < changes; change_idx++)
+        {
+            mutated[rng() % size] = (unsigned char)byte_value(rng);
+        }
+
+        /*---------------------------------------------------------*\
+        | Keep the size field intact half the time so mutations     |
+        | reach past the header checks                              |
+        \*---------------------------------------------------------*/
+        if(mutation_idx & 1)
+        {
+            memcpy(mutated.data(), &size, sizeof(size));
+        }
+
+        if(ReadExact(target, mutated.data(), size))
+        {
+            accepted++;
+        }
+    }
+
+    printf("%s: %u bytes, %u truncations rejected, %u of %d mutations read\n", format_name, size, size, accepted, TEST_MUTATIONS);
+
+    delete target;
+}
+
+static void TestHeaderBoundaries()
+{
+    RGBController_Dummy*    target  = new RGBController_Dummy();
+    unsigned char           header[2 * sizeof(unsigned int)];
+    unsigned int            magic   = RGBCONTROLLER_COMPACT_MAGIC;
+
+    /*---------------------------------------------------------*\
+    | A compact header with nothing after it, and every shorter |
+    | prefix of it                                              |
+    \*---------------------------------------------------------*/
+    for(unsigned int size = 0; size <= sizeof(header); size++)
+    {
+        memcpy(&header[0], &size, sizeof(size));
+        memcpy(&header[sizeof(unsigned int)], &magic, sizeof(magic));
+
+        if(ReadExact(target, header, size))
+        {
+            Fail("at %u bytes", "compact header accepted", size);
+        }
+    }
+
+    /*---------------------------------------------------------*\
+    | A size field larger than the buffer is limited to the     |
+    | buffer                                                    |
+    \*---------------------------------------------------------*/
+    unsigned int oversized = 0xFFFFFFFF;
+
+    memcpy(&header[0], &oversized, sizeof(oversized));
+
+    if(ReadExact(target, header, sizeof(header)))
+    {
+        Fail("(%u)", "oversized compact header accepted", oversized);
+    }
+
+    delete target;
+}
+
+int main()
+{
+    RGBController_Dummy*        device      = CreateTestDevice();
+    std::vector<unsigned char>  legacy      = TakeDescription(device->GetDeviceDescription());
+    std::vector<unsigned char>  compact     = TakeDescription(device->GetDeviceDescriptionCompact());
+
+    TestHeaderBoundaries();
+    TestFormat("legacy", legacy, legacy);
+    TestFormat("compact", compact, legacy);
+
+    delete device;
+
+    printf(failures == 0 ? "PASS\n" : "FAIL\n");
+
+    return(failures == 0 ? 0 : 1);
+}
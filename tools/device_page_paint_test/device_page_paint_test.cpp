@@ -0,0 +1,200 @@
+/*-----------------------------------------*\
+|  device_page_paint_test.cpp               |
+|                                           |
+|  Streams frames to a device page and      |
+|  checks the number of device view paints  |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "DeviceView.h"
+#include "OpenRGBDevicePage.h"
+#include "RGBController_Dummy.h"
+
+#include <QApplication>
+#include <QEvent>
+#include <QTimer>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+#define TEST_STREAM_MS      2000
+#define TEST_FRAME_US       1000
+#define TEST_LEDS           120
+
+/*---------------------------------------------------------*\
+| Allow a few repaints over one per interval for the first  |
+| update and timer jitter                                   |
+\*---------------------------------------------------------*/
+#define TEST_MAX_PAINTS     ((TEST_STREAM_MS / DEVICE_PAGE_UPDATE_INTERVAL_MS) + 10)
+
+class PaintCounter : public QObject
+{
+public:
+    std::atomic<unsigned int> paints;
+
+    PaintCounter() : paints(0) {}
+
+protected:
+    bool eventFilter(QObject* object, QEvent* event) override
+    {
+        if(event->type() == QEvent::Paint)
+        {
+            paints++;
+        }
+
+        return(QObject::eventFilter(object, event));
+    }
+};
+
+static RGBController_Dummy* CreateTestDevice()
+{
+    RGBController_Dummy* dummy = new RGBController_Dummy();
+
+    dummy->name     = "Paint Test Device";
+    dummy->type     = DEVICE_TYPE_LEDSTRIP;
+
+    mode direct_mode = {};
+
+    direct_mode.name        = "Direct";
+    direct_mode.flags       = MODE_FLAG_HAS_PER_LED_COLOR;
+    direct_mode.color_mode  = MODE_COLORS_PER_LED;
+
+    dummy->modes.push_back(direct_mode);
+
+    zone linear_zone = {};
+
+    linear_zone.name        = "Linear Zone";
+    linear_zone.type        = ZONE_TYPE_LINEAR;
+    linear_zone.leds_min    = TEST_LEDS;
+    linear_zone.leds_max    = TEST_LEDS;
+    linear_zone.leds_count  = TEST_LEDS;
+    linear_zone.matrix_map  = NULL;
+
+    dummy->zones.push_back(linear_zone);
+
+    for(unsigned int led_idx = 0; led_idx < TEST_LEDS; led_idx++)
+    {
+        led new_led = {};
+
+        new_led.name = "LED " + std::to_string(led_idx);
+
+        dummy->leds.push_back(new_led);
+    }
+
+    dummy->SetupColors();
+
+    return(dummy);
+}
+
+/*---------------------------------------------------------*\
+| Stream one frame per TEST_FRAME_US from another thread    |
+| for TEST_STREAM_MS while the event loop runs, and return  |
+| the number of frames sent                                 |
+\*---------------------------------------------------------*/
+static unsigned int StreamFrames(QApplication& app, RGBController* device)
+{
+    std::atomic<unsigned int>   frames(0);
+    std::atomic<bool>           streaming(true);
+
+    std::thread stream_thread([&]()
+    {
+        while(streaming.load())
+        {
+            device->SetAllLEDs(ToRGBColor(frames.load() & 0xFF, 0, 0));
+            device->UpdateLEDs();
+
+            frames++;
+
+            std::this_thread::sleep_for(std::chrono::microseconds(TEST_FRAME_US));
+        }
+    });
+
+    QTimer::singleShot(TEST_STREAM_MS, [&]()
+    {
+        streaming = false;
+        app.quit();
+    });
+
+    app.exec();
+
+    stream_thread.join();
+
+    /*---------------------------------------------------------*\
+    | Let the last queued update and its timer run out before   |
+    | the next pass starts counting                             |
+    \*---------------------------------------------------------*/
+    QTimer::singleShot(100, &app, &QApplication::quit);
+
+    app.exec();
+
+    return(frames.load());
+}
+
+int main(int argc, char* argv[])
+{
+    QApplication                app(argc, argv);
+    RGBController_Dummy*        device = CreateTestDevice();
+    Ui::OpenRGBDevicePage*      page   = new Ui::OpenRGBDevicePage(device);
+    DeviceView*                 view   = page->findChild<DeviceView*>();
+    PaintCounter                counter;
+    int                         result = 0;
+
+    if(view == NULL)
+    {
+        printf("FAIL: device page has no device view\n");
+        return(1);
+    }
+
+    view->installEventFilter(&counter);
+
+    page->resize(800, 600);
+    page->show();
+    page->ShowDeviceView();
+
+    /*---------------------------------------------------------*\
+    | Visible page: repaints are coalesced to at most one per   |
+    | interval, but the view must still be repainted            |
+    \*---------------------------------------------------------*/
+    counter.paints      = 0;
+    unsigned int frames = StreamFrames(app, device);
+    unsigned int paints = counter.paints.load();
+
+    printf("Visible: %u frames, %u paints, limit %u\n", frames, paints, TEST_MAX_PAINTS);
+
+    if((paints == 0) || (paints > TEST_MAX_PAINTS))
+    {
+        printf("FAIL: visible page paint count out of range\n");
+        result = 1;
+    }
+
+    /*---------------------------------------------------------*\
+    | Hidden device view: nothing is painted                    |
+    \*---------------------------------------------------------*/
+    page->HideDeviceView();
+
+    counter.paints  = 0;
+    frames          = StreamFrames(app, device);
+    paints          = counter.paints.load();
+
+    printf("Hidden: %u frames, %u paints\n", frames, paints);
+
+    if(paints != 0)
+    {
+        printf("FAIL: hidden device view was painted\n");
+        result = 1;
+    }
+
+    delete page;
+
+    device->StopDeviceThread();
+    delete device;
+
+    printf(result == 0 ? "PASS\n" : "FAIL\n");
+
+    return(result);
+}
@@ -0,0 +1,55 @@
+#-----------------------------------------------------------------------#
+# OpenRGB device page paint count test                                  #
+#                                                                       #
+#   qmake tools/device_page_paint_test && make                          #
+#   ./device_page_paint_test                                            #
+#-----------------------------------------------------------------------#
+
+QT +=                                                                   \
+    core                                                                \
+    gui                                                                 \
+    widgets                                                             \
+
+CONFIG +=                                                               \
+    c++17                                                               \
+    console                                                             \
+
+TEMPLATE    = app
+TARGET      = device_page_paint_test
+
+ROOT        = $$PWD/../..
+
+INCLUDEPATH +=                                                          \
+    $$ROOT                                                              \
+    $$ROOT/RGBController                                                \
+    $$ROOT/qt                                                           \
+    $$ROOT/dependencies/ColorWheel                                      \
+
+HEADERS +=                                                              \
+    $$ROOT/dependencies/ColorWheel/ColorWheel.h                         \
+    $$ROOT/qt/DeviceView.h                                              \
+    $$ROOT/qt/OpenRGBDevicePage.h                                       \
+    $$ROOT/qt/OpenRGBZoneResizeDialog.h                                 \
+    $$ROOT/qt/hsv.h                                                     \
+    $$ROOT/RGBController/RGBController.h                                \
+    $$ROOT/RGBController/RGBController_Dummy.h                          \
+
+SOURCES +=                                                              \
+    device_page_paint_test.cpp                                          \
+    $$ROOT/dependencies/ColorWheel/ColorWheel.cpp                       \
+    $$ROOT/qt/DeviceView.cpp                                            \
+    $$ROOT/qt/OpenRGBDevicePage.cpp                                     \
+    $$ROOT/qt/OpenRGBZoneResizeDialog.cpp                               \
+    $$ROOT/qt/hsv.cpp                                                   \
+    $$ROOT/RGBController/RGBColorTransform.cpp                          \
+    $$ROOT/RGBController/RGBController.cpp                              \
+    $$ROOT/RGBController/RGBControllerStats.cpp                         \
+    $$ROOT/RGBController/RGBController_Dummy.cpp                        \
+    $$ROOT/RGBController/RGBDescriptionCodec.cpp                        \
+    $$ROOT/RGBController/RGBOutputStage.cpp                             \
+
+FORMS +=                                                                \
+    $$ROOT/qt/OpenRGBDevicePage.ui                                      \
+    $$ROOT/qt/OpenRGBZoneResizeDialog.ui                                \
+
+unix:LIBS += -lpthread
@@ -0,0 +1,243 @@
+/*-----------------------------------------*\
+|  frame_stress_test.cpp                    |
+|                                           |
+|  Hammers one controller's frame, staging  |
+|  and output stage paths from several      |
+|  threads.  Build with ThreadSanitizer:    |
+|                                           |
+|  CXXFLAGS="-O1 -g -fsanitize=thread"      |
+|      tools/build.sh build-tsan            |
+|      frame_stress_test                    |
+|                                           |
+|  agent 10/19/2026                         |
+\*-----------------------------------------*/
+
+#include "RGBController_Dummy.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+#define TEST_DURATION_MS    2000
+#define TEST_LEDS           64
+#define TEST_ZONES          4
+#define TEST_FINAL_COLOR    0x00123456
+
+/*---------------------------------------------------------*\
+| A device that reads colors from the "hardware" when it is |
+| set up, like the SMBus drivers do, and reads every color  |
+| on each device call                                       |
+\*---------------------------------------------------------*/
+class StressDevice : public RGBController_Dummy
+{
+public:
+    std::atomic<unsigned int>   device_calls;
+    RGBColor                    last_sent;
+
+    StressDevice() : device_calls(0), last_sent(0)
+    {
+        name    = "Frame Stress Device";
+        type    = DEVICE_TYPE_LEDSTRIP;
+
+        mode direct_mode = {};
+
+        direct_mode.name        = "Direct";
+        direct_mode.flags       = MODE_FLAG_HAS_PER_LED_COLOR;
+        direct_mode.color_mode  = MODE_COLORS_PER_LED;
+
+        modes.push_back(direct_mode);
+
+        for(unsigned int zone_idx = 0; zone_idx < TEST_ZONES; zone_idx++)
+        {
+            zone new_zone = {};
+
+            new_zone.name       = "Zone " + std::to_string(zone_idx);
+            new_zone.type       = ZONE_TYPE_LINEAR;
+            new_zone.leds_min   = TEST_LEDS / TEST_ZONES;
+            new_zone.leds_max   = TEST_LEDS / TEST_ZONES;
+            new_zone.leds_count = TEST_LEDS / TEST_ZONES;
+            new_zone.matrix_map = NULL;
+
+            zones.push_back(new_zone);
+        }
+
+        for(unsigned int led_idx = 0; led_idx < TEST_LEDS; led_idx++)
+        {
+            led new_led = {};
+
+            new_led.name = "LED " + std::to_string(led_idx);
+
+            leds.push_back(new_led);
+        }
+
+        SetupColors();
+        ReadHardwareColors();
+    }
+
+    void ReadHardwareColors()
+    {
+        for(unsigned int led_idx = 0; led_idx < colors.size(); led_idx++)
+        {
+            colors[led_idx] = ToRGBColor(led_idx, 0, 0);
+        }
+    }
+
+    void DeviceUpdateLEDs()
+    {
+        RGBColor last = 0;
+
+        for(unsigned int led_idx = 0; led_idx < colors.size(); led_idx++)
+        {
+            last = colors[led_idx];
+        }
+
+        last_sent = last;
+
+        device_calls++;
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    int                         duration_ms = (argc > 1) ? atoi(argv[1]) : TEST_DURATION_MS;
+    StressDevice*               device      = new StressDevice();
+    std::atomic<bool>           running(true);
+    std::vector<std::thread>    threads;
+    int                         result      = 0;
+
+    /*---------------------------------------------------------*\
+    | Published frames, one LED or all LEDs at a time.  Zone    |
+    | writes are left out as SetupColors below rewrites the     |
+    | zone layout, which callers only do with writers stopped   |
+    \*---------------------------------------------------------*/
+    threads.push_back(std::thread([&]()
+    {
+        for(unsigned int frame = 0; running.load(); frame++)
+        {
+            if(frame & 1)
+            {
+                device->SetLED(frame % TEST_LEDS, ToRGBColor(0, frame & 0xFF, 0));
+            }
+            else
+            {
+                device->SetAllLEDs(ToRGBColor(frame & 0xFF, 0, 0));
+            }
+
+            device->UpdateLEDs();
+        }
+    }));
+
+    /*---------------------------------------------------------*\
+    | Staged frames committed on their own                      |
+    \*---------------------------------------------------------*/
+    threads.push_back(std::thread([&]()
+    {
+        for(unsigned int frame = 0; running.load(); frame++)
+        {
+            RGBColor* staged = device->BeginStagedFrame();
+
+            for(unsigned int led_idx = 0; led_idx < TEST_LEDS; led_idx += 2)
+            {
+                staged[led_idx] = ToRGBColor(frame & 0xFF, frame & 0xFF, 0);
+            }
+
+            device->StageLEDs();
+
+            device->CommitLEDs(std::chrono::steady_clock::now());
+        }
+    }));
+
+    /*---------------------------------------------------------*\
+    | Readers of the last color written                         |
+    \*---------------------------------------------------------*/
+    threads.push_back(std::thread([&]()
+    {
+        RGBColor sum = 0;
+
+        for(unsigned int led_idx = 0; running.load(); led_idx++)
+        {
+            sum += device->GetLED(led_idx % (TEST_LEDS + 1));
+
+            if((led_idx % TEST_LEDS) == 0)
+            {
+                sum += device->GetLEDs()[0];
+            }
+        }
+
+        (void)sum;
+    }));
+
+    /*---------------------------------------------------------*\
+    | Turn the output stage on and off, so the device thread    |
+    | keeps swapping the corrected frame in and out of colors,  |
+    | and make the next writer start its frame from colors      |
+    \*---------------------------------------------------------*/
+    threads.push_back(std::thread([&]()
+    {
+        RGBOutputStageParams corrected  = { 220, 0xFFC0E0, 200 };
+        RGBOutputStageParams identity   = { 100, 0xFFFFFF, 255 };
+
+        for(unsigned int pass = 0; running.load(); pass++)
+        {
+            device->SetOutputStage((pass & 1) ? identity : corrected);
+
+            device->SetupColors();
+
+            std::this_thread::sleep_for(100us);
+        }
+    }));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(duration_ms));
+
+    running = false;
+
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    /*---------------------------------------------------------*\
+    | With the output stage off, the last frame written must be |
+    | the one read back and the one sent to the device          |
+    \*---------------------------------------------------------*/
+    RGBOutputStageParams identity = { 100, 0xFFFFFF, 255 };
+
+    device->SetOutputStage(identity);
+    device->SetAllLEDs(TEST_FINAL_COLOR);
+    device->UpdateLEDs();
+
+    while(device->GetUpdatePending())
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    printf("%u device calls in %d ms\n", device->device_calls.load(), duration_ms);
+
+    for(unsigned int led_idx = 0; led_idx < TEST_LEDS; led_idx++)
+    {
+        if(device->GetLED(led_idx) != TEST_FINAL_COLOR)
+        {
+            printf("FAIL: LED %u reads back %06X\n", led_idx, device->GetLED(led_idx));
+            result = 1;
+            break;
+        }
+    }
+
+    if(device->last_sent != TEST_FINAL_COLOR)
+    {
+        printf("FAIL: device was last sent %06X\n", device->last_sent);
+        result = 1;
+    }
+
+    delete device;
+
+    printf(result == 0 ? "PASS\n" : "FAIL\n");
+
+    return(result);
+}